@@ -30,6 +30,8 @@
 
 #import <MachOKit/MKOffsetNode.h>
 
+#include <mach-o/fat.h>
+
 //----------------------------------------------------------------------------//
 //! An instance of \c MKFatArch represents the structure identifying a
 //! slice of a fat binary.
@@ -43,6 +45,10 @@
     uint32_t _align;
 }
 
+//! Initializes the receiver with a \c fat_arch that has already been copied
+//! out of the memory map of \a parent, from \a offset.
+- (instancetype)initWithFatArch:(const struct fat_arch*)fatArch atOffset:(mk_vm_offset_t)offset fromParent:(MKBackedNode*)parent error:(NSError**)error NS_DESIGNATED_INITIALIZER;
+
 //◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
 #pragma mark -  fat_arch Values
 //! @name       fat_arch Values
@@ -34,22 +34,30 @@
 @implementation MKFatArch
 
 //|++++++++++++++++++++++++++++++++++++|//
-- (instancetype)initWithOffset:(mk_vm_offset_t)offset fromParent:(MKBackedNode*)parent error:(NSError**)error
+- (instancetype)initWithFatArch:(const struct fat_arch*)fatArch atOffset:(mk_vm_offset_t)offset fromParent:(MKBackedNode*)parent error:(NSError**)error
 {
+    NSParameterAssert(fatArch);
+    
     self = [super initWithOffset:offset fromParent:parent error:error];
     if (self == nil) return nil;
     
+    _cputype = MKSwapLValue32(fatArch->cputype, self.dataModel);
+    _cpusubtype = MKSwapLValue32(fatArch->cpusubtype, self.dataModel);
+    _offset = MKSwapLValue32(fatArch->offset, self.dataModel);
+    _size = MKSwapLValue32(fatArch->size, self.dataModel);
+    _align = 1 << MKSwapLValue32(fatArch->align, self.dataModel);
+    
+    return self;
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+- (instancetype)initWithOffset:(mk_vm_offset_t)offset fromParent:(MKBackedNode*)parent error:(NSError**)error
+{
     struct fat_arch slice;
-    if ([self.memoryMap copyBytesAtOffset:offset fromAddress:parent.nodeContextAddress into:&slice length:sizeof(slice) requireFull:YES error:error] < sizeof(slice))
+    if ([parent.memoryMap copyBytesAtOffset:offset fromAddress:parent.nodeContextAddress into:&slice length:sizeof(slice) requireFull:YES error:error] < sizeof(slice))
     { [self release]; return nil; }
     
-    _cputype = MKSwapLValue32(slice.cputype, self.dataModel);
-    _cpusubtype = MKSwapLValue32(slice.cpusubtype, self.dataModel);
-    _offset = MKSwapLValue32(slice.offset, self.dataModel);
-    _size = MKSwapLValue32(slice.size, self.dataModel);
-    _align = 1 << MKSwapLValue32(slice.align, self.dataModel);
-    
-    return self;
+    return [self initWithFatArch:&slice atOffset:offset fromParent:parent error:error];
 }
 
 //◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
@@ -51,6 +51,24 @@
 //! present in this fat binary.
 @property (nonatomic, readonly) NSArray /*MKFatArch*/ *architectures;
 
+//◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
+#pragma mark -  Parsing Architectures
+//! @name       Parsing Architectures
+//◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
+
+//! Initializes an \ref MKMachOImage for the slice identified by each of the
+//! \ref architectures.  Every image shares the memory map of the receiver,
+//! has the receiver as its parent, and is named after the mapped file when
+//! it is known.  If \a concurrently is \c YES, the slices are parsed in
+//! parallel.
+//!
+//! @return     An array with one element for each of the \ref architectures,
+//!             in the same order.  Each element is either the
+//!             \ref MKMachOImage for the architecture, or an \c NSError
+//!             describing why it could not be initialized.  Test the class
+//!             of each element before using it.
+- (NSArray /*MKMachOImage or NSError*/ *)parseAllArchitecturesConcurrently:(BOOL)concurrently;
+
 //◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
 #pragma mark -  fat_header Values
 //! @name       fat_header Values
@@ -29,9 +29,15 @@
 #import "NSError+MK.h"
 
 #import "MKFatArch.h"
+#import "MKMachO.h"
+#import "_MKFileMemoryMap.h"
 
+#import <objc/runtime.h>
 #include <mach-o/fat.h>
 
+//! The number of fat_arch structures copied by each batch.
+#define MKFatBinaryArchitectureBatchSize 16
+
 //----------------------------------------------------------------------------//
 @implementation MKFatBinary
 
@@ -65,23 +71,49 @@
     // Load Architectures
     {
         NSMutableArray *architectures = [[NSMutableArray alloc] init];
-        mk_vm_offset_t offset = sizeof(header);
+        uint32_t index = 0;
+        BOOL truncated = NO;
+        
+        // The fat_arch structures follow the header back to back.  Copy them
+        // a batch at a time rather than remapping the table for each one.
+        struct fat_arch slices[MKFatBinaryArchitectureBatchSize];
+        mk_memory_map_copy_request_t requests[MKFatBinaryArchitectureBatchSize];
         
-        // Cast to mk_vm_size_t is safe; nodeSize can't be larger than UINT32_MAX.
-        while ((mk_vm_size_t)offset < sizeof(struct fat_arch) * _nfat_arch)
+        while (index < _nfat_arch && !truncated)
         {
-            NSError *e = nil;
-            MKFatArch *arch = [[MKFatArch alloc] initWithOffset:offset fromParent:self error:&e];
-            
-            if (arch == nil) {
-                MK_PUSH_UNDERLYING_WARNING(MK_PROPERTY(pointers), e, @"Could not load architecture at offset %" MK_VM_PRIiOFFSET ".", offset);
-                break;
+            uint32_t batchSize = MIN(_nfat_arch - index, (uint32_t)MKFatBinaryArchitectureBatchSize);
+            for (uint32_t i = 0; i < batchSize; i++) {
+                requests[i] = (mk_memory_map_copy_request_t){
+                    .offset = sizeof(header) + (mk_vm_offset_t)(index + i) * sizeof(struct fat_arch),
+                    .address = self.nodeContextAddress,
+                    .length = sizeof(struct fat_arch),
+                    .buffer = &slices[i]
+                };
             }
             
-            [architectures addObject:arch];
+            // On failure, copyError describes the first request which could
+            // not be copied.  The requests before it are still valid.
+            NSError *copyError = nil;
+            [self.memoryMap copyBytesWithRequests:requests count:batchSize requireFull:YES error:&copyError];
             
-            // Safe.  Architecture node size is constant.
-            offset += arch.nodeSize;
+            for (uint32_t i = 0; i < batchSize; i++, index++)
+            {
+                mk_vm_offset_t offset = requests[i].offset;
+                NSError *e = copyError;
+                MKFatArch *arch = nil;
+                
+                if (requests[i].error == MK_ESUCCESS)
+                    arch = [[MKFatArch alloc] initWithFatArch:&slices[i] atOffset:offset fromParent:self error:&e];
+                
+                if (arch == nil) {
+                    MK_PUSH_UNDERLYING_WARNING(MK_PROPERTY(pointers), e, @"Could not load architecture at offset %" MK_VM_PRIiOFFSET ".", offset);
+                    truncated = YES;
+                    break;
+                }
+                
+                [architectures addObject:arch];
+                [arch release];
+            }
         }
         
         _architectures = [architectures copy];
@@ -95,6 +127,64 @@
 - (instancetype)initWithParent:(MKNode*)parent error:(NSError **)error
 { return [self initWithMemoryMap:parent.memoryMap error:error]; }
 
+//◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
+#pragma mark - Parsing Architectures
+//◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
+
+//|++++++++++++++++++++++++++++++++++++|//
+- (NSArray /*MKMachOImage or NSError*/ *)parseAllArchitecturesConcurrently:(BOOL)concurrently
+{
+    NSArray *architectures = self.architectures;
+    MKMemoryMap *memoryMap = self.memoryMap;
+    size_t count = architectures.count;
+    
+    // Slices are named after the file they were loaded from, if known.
+    const char *name = NULL;
+    if ([memoryMap isKindOfClass:_MKFileMemoryMap.class])
+        name = [(_MKFileMemoryMap*)memoryMap fileURL].path.fileSystemRepresentation;
+    
+    // Each slice writes only its own element.
+    id *results = calloc(count, sizeof(id));
+    if (results == NULL && count > 0)
+        return nil;
+    
+    void (^parseArchitecture)(size_t) = ^(size_t i) {
+        @autoreleasepool {
+            MKFatArch *architecture = architectures[i];
+            NSError *e = nil;
+            
+            MKMachOImage *image = [[MKMachOImage alloc] initWithName:name slide:0 flags:0 atAddress:architecture.offset inMapping:memoryMap error:&e];
+            if (image) {
+                // Like -[MKMachOImage initWithParent:error:], so that the
+                // slice inherits the delegate of the receiver.  The delegate
+                // may have been resolved, without a parent, during
+                // initialization; resolve it again.
+                objc_storeWeak(&image->_parent, self);
+                atomic_store_explicit(&image->_delegateGeneration, -1, memory_order_release);
+                results[i] = image;
+            }
+            else if (e)
+                results[i] = [e retain];
+            else
+                results[i] = [[NSError mk_errorWithDomain:MKErrorDomain code:MK_EINTERNAL_ERROR description:@"Could not initialize the image for architecture %@.", architecture] retain];
+        }
+    };
+    
+    // The global queue balances the slices across the available cores.
+    if (concurrently && count > 1)
+        dispatch_apply(count, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), parseArchitecture);
+    else
+        for (size_t i = 0; i < count; i++)
+            parseArchitecture(i);
+    
+    NSArray *retValue = [NSArray arrayWithObjects:results count:count];
+    for (size_t i = 0; i < count; i++)
+        [results[i] release];
+    free(results);
+    
+    return retValue;
+}
+
 //◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
 #pragma mark - MKNode
 //◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
@@ -52,6 +52,7 @@
     uint32_t _lazy_bind_size;
     uint32_t _export_off;
     uint32_t _export_size;
+    NSData *_exportTrie;
 }
 
 @property (nonatomic, readonly) uint32_t rebase_off;
@@ -69,4 +70,23 @@
 @property (nonatomic, readonly) uint32_t export_off;
 @property (nonatomic, readonly) uint32_t export_size;
 
+//◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
+#pragma mark -  Exports
+//! @name       Exports
+//◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
+
+//! The export trie, copied from the \c __LINKEDIT segment the first time
+//! it is accessed.
+@property (nonatomic, readonly) NSData *exportTrie;
+
+//! Looks up the export named \a name without enumerating the other
+//! exports.  Returns \c NO if \a name is not exported.  Pointers in
+//! \a export are valid for the lifetime of the receiver.
+- (BOOL)findExportNamed:(const char*)name export:(mk_export_t*)export;
+
+//! Enumerates all exports, in the order they appear in the export trie.
+//! The name of each export is only valid for the duration of the call to
+//! \a block.
+- (void)enumerateExportsUsingBlock:(void (^)(const mk_export_t *export, BOOL *stop))block;
+
 @end
@@ -28,6 +28,8 @@
 #import "MKLCDyldInfo.h"
 #import "MKMachO.h"
 #import "NSError+MK.h"
+#import "MKLinkEditNode.h"
+#import "MKMemoryMap.h"
 
 //----------------------------------------------------------------------------//
 @implementation MKLCDyldInfo
@@ -75,6 +77,124 @@
     return self;
 }
 
+//|++++++++++++++++++++++++++++++++++++|//
+- (void)dealloc
+{
+    [_exportTrie release];
+    [super dealloc];
+}
+
+//◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
+#pragma mark - Exports
+//◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
+
+//|++++++++++++++++++++++++++++++++++++|//
+- (NSData*)_copyExportTrie
+{
+    NSError *e = nil;
+    
+    if (self.export_size == 0)
+        return nil;
+    
+    MKLinkEditNode *trie = [[MKLinkEditNode alloc] initWithSize:self.export_size offset:self.export_off inImage:self.macho error:&e];
+    if (trie == nil) {
+        MK_PUSH_UNDERLYING_WARNING(exportTrie, e, @"Could not locate the export trie.");
+        return nil;
+    }
+    
+    NSMutableData *trieData = [[NSMutableData alloc] initWithLength:self.export_size];
+    mk_vm_size_t copied = [trie.memoryMap copyBytesAtOffset:0 fromAddress:trie.nodeContextAddress into:trieData.mutableBytes length:self.export_size requireFull:NO error:&e];
+    [trie release];
+    
+    if (copied < self.export_size) {
+        MK_PUSH_UNDERLYING_WARNING(exportTrie, e, @"Export trie truncated after %" MK_VM_PRIuSIZE " bytes.", copied);
+        trieData.length = (NSUInteger)copied;
+    }
+    
+    return trieData;
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+- (NSData*)exportTrie
+{
+    @synchronized (self) {
+        if (_exportTrie == nil)
+            _exportTrie = [self _copyExportTrie] ?: [[NSData alloc] init];
+        
+        return [[_exportTrie retain] autorelease];
+    }
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+- (BOOL)findExportNamed:(const char*)name export:(mk_export_t*)export
+{
+    NSData *trieData = self.exportTrie;
+    mk_export_trie_t trie;
+    
+    if (name == NULL || export == NULL)
+        return NO;
+    if (mk_export_trie_init_with_bytes(trieData.bytes, trieData.length, &trie))
+        return NO;
+    
+    mk_error_t err = mk_export_trie_find(&trie, name, export);
+    if (err != MK_ESUCCESS && err != MK_ENOT_FOUND) {
+        // The name may not outlive the call.
+        NSString *exportName = @(name);
+        MK_PUSH_WARNING(exportTrie, err, @"Could not look up export %@.", exportName);
+    }
+    
+    return (err == MK_ESUCCESS);
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+- (void)enumerateExportsUsingBlock:(void (^)(const mk_export_t *export, BOOL *stop))block
+{
+    NSData *trieData = self.exportTrie;
+    mk_export_trie_t trie;
+    
+    if (mk_export_trie_init_with_bytes(trieData.bytes, trieData.length, &trie))
+        return;
+    
+    // Start with storage for typical names and trie depths.  If the trie
+    // needs more, grow the storage and skip the exports already reported.
+    size_t nameSize = 1024;
+    uint32_t frameCapacity = 128;
+    NSUInteger reported = 0;
+    
+    while (true) {
+        NSMutableData *storage = [[NSMutableData alloc] initWithLength:nameSize + frameCapacity * sizeof(mk_export_iterator_frame_t)];
+        mk_export_iterator_t iterator;
+        mk_export_t export;
+        mk_error_t err = MK_ESUCCESS;
+        NSUInteger index = 0;
+        BOOL stop = NO;
+        
+        mk_export_iterator_init(&trie, (char*)storage.mutableBytes + frameCapacity * sizeof(mk_export_iterator_frame_t), nameSize, storage.mutableBytes, frameCapacity, &iterator);
+        
+        while (!stop && mk_export_iterator_next(&iterator, &export, &err)) {
+            if (index++ < reported)
+                continue;
+            block(&export, &stop);
+            reported++;
+        }
+        
+        [storage release];
+        
+        if (stop || err == MK_ESUCCESS)
+            break;
+        
+        // A valid trie can not have a name or depth longer than the trie.
+        if (err == MK_EOVERFLOW && (nameSize <= trieData.length || frameCapacity <= trieData.length)) {
+            nameSize *= 2;
+            frameCapacity *= 2;
+            continue;
+        }
+        
+        MK_PUSH_WARNING(exportTrie, err, @"Could not enumerate the exports after %" PRIuPTR " exports.", (uintptr_t)reported);
+        break;
+    }
+}
+
 //|++++++++++++++++++++++++++++++++++++|//
 - (MKNodeDescription*)layout
 {
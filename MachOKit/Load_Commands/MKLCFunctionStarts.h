@@ -32,6 +32,23 @@
 
 //----------------------------------------------------------------------------//
 //! Parser for \c LC_FUNCTION_STARTS.
+//!
+//! The function starts command identifies a table in the __LINKEDIT segment
+//! listing the start address of each function in the binary.  The table is
+//! present in stripped binaries, and can be used to determine the bounds
+//! of functions without symbols.
 //
-@interface MKLCFunctionStarts : MKLinkEditDataLoadCommand
+@interface MKLCFunctionStarts : MKLinkEditDataLoadCommand {
+@package
+    NSData *_functionStarts;
+}
+
+//! An \c NSData containing the start address of each function, as an array
+//! of \c mk_vm_address_t, in ascending order.  Addresses are in the unslid
+//! address space of the image.
+//!
+//! The function starts table is decoded the first time this property is
+//! accessed.
+@property (nonatomic, readonly) NSData *functionStarts;
+
 @end
@@ -26,6 +26,12 @@
 //----------------------------------------------------------------------------//
 
 #import "MKLCFunctionStarts.h"
+#import "NSError+MK.h"
+#import "MKMachO.h"
+#import "MKMachO+Segments.h"
+#import "MKSegment.h"
+#import "MKLinkEditNode.h"
+#import "MKMemoryMap.h"
 
 //----------------------------------------------------------------------------//
 @implementation MKLCFunctionStarts
@@ -34,4 +40,73 @@
 + (uint32_t)ID
 { return LC_FUNCTION_STARTS; }
 
+//|++++++++++++++++++++++++++++++++++++|//
+- (void)dealloc
+{
+    [_functionStarts release];
+    [super dealloc];
+}
+
+//◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
+#pragma mark - Function Starts
+//◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
+
+//|++++++++++++++++++++++++++++++++++++|//
+- (NSData*)_decodeFunctionStarts
+{
+    MKMachOImage *image = self.macho;
+    NSError *e = nil;
+    
+    // The first delta in the table is from the start of __TEXT.
+    MKSegment *textSegment = [image segmentsWithName:@SEG_TEXT].firstObject;
+    if (textSegment == nil) {
+        MK_PUSH_WARNING(functionStarts, MK_ENOT_FOUND, @"Image does not have a __TEXT segment.");
+        return nil;
+    }
+    
+    MKLinkEditNode *table = [[MKLinkEditNode alloc] initWithSize:self.datasize offset:self.dataoff inImage:image error:&e];
+    if (table == nil) {
+        MK_PUSH_UNDERLYING_WARNING(functionStarts, e, @"Could not locate the function starts table.");
+        return nil;
+    }
+    
+    NSMutableData *tableData = [[NSMutableData alloc] initWithLength:self.datasize];
+    mk_vm_size_t copied = [table.memoryMap copyBytesAtOffset:0 fromAddress:table.nodeContextAddress into:tableData.mutableBytes length:self.datasize requireFull:NO error:&e];
+    [table release];
+    
+    if (copied < self.datasize)
+        MK_PUSH_UNDERLYING_WARNING(functionStarts, e, @"Function starts table truncated after %" MK_VM_PRIuSIZE " bytes.", copied);
+    
+    // Every function start is encoded in at least one byte, so the table
+    // can not hold more than copied function starts.
+    NSMutableData *functionStarts = [[NSMutableData alloc] initWithLength:(NSUInteger)copied * sizeof(mk_vm_address_t)];
+    mk_function_starts_decoder_t decoder;
+    mk_function_starts_decoder_init(&decoder, textSegment.vmAddress);
+    
+    uint32_t count = 0;
+    mk_error_t err = MK_ESUCCESS;
+    // Cast is safe; datasize is a uint32_t.
+    mk_function_starts_decode(&decoder, tableData.bytes, (size_t)copied, functionStarts.mutableBytes, (uint32_t)copied, &count, &err);
+    [tableData release];
+    
+    if (err != MK_ESUCCESS)
+        MK_PUSH_WARNING(functionStarts, err, @"Could not decode function start %" PRIu32 ".", count);
+    else if (decoder.finished == NO && copied == self.datasize)
+        MK_PUSH_WARNING(functionStarts, MK_EINVALID_DATA, @"Function starts table is not terminated.");
+    
+    functionStarts.length = count * sizeof(mk_vm_address_t);
+    return [functionStarts autorelease];
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+- (NSData*)functionStarts
+{
+    @synchronized (self) {
+        if (_functionStarts == nil)
+            _functionStarts = [[self _decodeFunctionStarts] copy] ?: [[NSData alloc] init];
+        
+        return [[_functionStarts retain] autorelease];
+    }
+}
+
 @end
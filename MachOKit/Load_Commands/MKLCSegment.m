@@ -107,7 +107,8 @@
                 // If we fail to instantiate an instance of the MKLCSection64 it
                 // means we've walked off the end of memory that can be mapped
                 // by our MKMemoryMap.
-                MK_PUSH_UNDERLYING_WARNING(sections, sectionError, @"Failed to instantiate section at index " PRIi32 "", (self.nsects - sectionCount));
+                uint32_t index = self.nsects - sectionCount;
+                MK_PUSH_UNDERLYING_WARNING(sections, sectionError, @"Failed to instantiate section at index %" PRIi32 "", index);
                 break;
             }
                 
@@ -119,7 +120,8 @@
                 // number of sections specifed would not fit within the load
                 // command's size.  We will match this behavior and throw away
                 // any section which straddles the boundary.
-                MK_PUSH_WARNING(sections, MK_EINVALID_DATA, @"Part of section at index " PRIi32 " is outside the enclosing load command.", (self.nsects - sectionCount));
+                uint32_t index = self.nsects - sectionCount;
+                MK_PUSH_WARNING(sections, MK_EINVALID_DATA, @"Part of section at index %" PRIi32 " is outside the enclosing load command.", index);
                 break;
             }
                 
@@ -41,6 +41,14 @@ extern const uint32_t _mk_load_command_classes_count;
 + (id*)_subclassesCache
 { static __weak NSSet *subclasses; return &subclasses; }
 
+//|++++++++++++++++++++++++++++++++++++|//
++ (MKNodeSubclassCache*)_subclassLookupCache
+{
+    static MKNodeSubclassCache cache;
+    // Subclasses rank their own subclasses.
+    return (self == MKLoadCommand.class) ? &cache : NULL;
+}
+
 //|++++++++++++++++++++++++++++++++++++|//
 + (uint32_t)canInstantiateWithLoadCommandID:(uint32_t)commandID
 {
@@ -54,6 +62,22 @@ extern const uint32_t _mk_load_command_classes_count;
 
 //|++++++++++++++++++++++++++++++++++++|//
 + (Class)classForCommandID:(uint32_t)commandID
+{
+    // Load command IDs fit in the low byte, optionally with LC_REQ_DYLD
+    // set.  Any other ID is looked up without caching.
+    uint32_t discriminator = commandID & ~LC_REQ_DYLD;
+    if (discriminator > 0xFF)
+        discriminator = UINT32_MAX;
+    else if (commandID & LC_REQ_DYLD)
+        discriminator |= 0x100;
+    
+    return [self subclassForDiscriminator:discriminator lookup:^{
+        return [self _classForCommandID:commandID];
+    }];
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
++ (Class)_classForCommandID:(uint32_t)commandID
 {
     // If we have one or more compatible subclasses, return the best match.
     {
@@ -162,8 +186,9 @@ extern const uint32_t _mk_load_command_classes_count;
     _cmdId = MKSwapLValue32(lc.cmd, self.macho.dataModel);
     _cmdSize = MKSwapLValue32(lc.cmdsize, self.macho.dataModel);
     
-    if (self.class != [MKLoadCommand classForCommandID:_cmdId]) {
-        NSString *reason = [NSString stringWithFormat:@"Cannot initialize %@ with load command data for %@", NSStringFromClass(self.class), NSStringFromClass([MKLoadCommand classForCommandID:_cmdId])];
+    Class commandClass = [MKLoadCommand classForCommandID:_cmdId];
+    if (self.class != commandClass) {
+        NSString *reason = [NSString stringWithFormat:@"Cannot initialize %@ with load command data for %@", NSStringFromClass(self.class), NSStringFromClass(commandClass)];
         @throw [NSException exceptionWithName:NSInvalidArgumentException reason:reason userInfo:nil];
     }
     
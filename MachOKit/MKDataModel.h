@@ -29,11 +29,11 @@
 @import Foundation;
 
 #define MKSwapLValue16(LVALUE, DATA_MODEL) \
-    (LVALUE = DATA_MODEL.byteOrder->swap16( LVALUE ))
+    (LVALUE = mk_byteorder_swap16(DATA_MODEL.byteOrder, LVALUE))
 #define MKSwapLValue32(LVALUE, DATA_MODEL) \
-    (LVALUE = DATA_MODEL.byteOrder->swap32( LVALUE ))
+    (LVALUE = mk_byteorder_swap32(DATA_MODEL.byteOrder, LVALUE))
 #define MKSwapLValue64(LVALUE, DATA_MODEL) \
-    (LVALUE = DATA_MODEL.byteOrder->swap64( LVALUE ))
+    (LVALUE = mk_byteorder_swap64(DATA_MODEL.byteOrder, LVALUE))
 
 
 
@@ -0,0 +1,217 @@
+//----------------------------------------------------------------------------//
+//|
+//|             MachOKit - A Lightweight Mach-O Parsing Library
+//! @file       MKImageScanner.h
+//!
+//! @author     D.V.
+//! @copyright  Copyright (c) 2014-2015 D.V. All rights reserved.
+//|
+//| Permission is hereby granted, free of charge, to any person obtaining a
+//| copy of this software and associated documentation files (the "Software"),
+//| to deal in the Software without restriction, including without limitation
+//| the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//| and/or sell copies of the Software, and to permit persons to whom the
+//| Software is furnished to do so, subject to the following conditions:
+//|
+//| The above copyright notice and this permission notice shall be included
+//| in all copies or substantial portions of the Software.
+//|
+//| THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+//| OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+//| MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+//| IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+//| CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+//| TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//| SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//----------------------------------------------------------------------------//
+
+#include <MachOKit/macho.h>
+@import Foundation;
+
+#include <stdatomic.h>
+
+//----------------------------------------------------------------------------//
+//! An instance of \c MKScannedImage summarizes a single Mach-O image found
+//! by an \ref MKImageScanner.  Thin files contain one image; fat files
+//! contain one image for each architecture.
+//
+@interface MKScannedImage : NSObject {
+@package
+    mk_vm_address_t _offset;
+    cpu_type_t _cputype;
+    cpu_subtype_t _cpusubtype;
+    uint32_t _filetype;
+    uint32_t _ncmds;
+    uint32_t _sizeofcmds;
+    uint32_t _flags;
+    NSUUID *_uuid;
+    uint32_t _nsyms;
+    uint32_t _nlocalsym;
+    uint32_t _nextdefsym;
+    uint32_t _nundefsym;
+}
+
+//! The offset of the image's Mach-O header from the start of the file.
+@property (nonatomic, readonly) mk_vm_address_t offset;
+
+@property (nonatomic, readonly) cpu_type_t cputype;
+@property (nonatomic, readonly) cpu_subtype_t cpusubtype;
+@property (nonatomic, readonly) uint32_t filetype;
+@property (nonatomic, readonly) uint32_t ncmds;
+@property (nonatomic, readonly) uint32_t sizeofcmds;
+@property (nonatomic, readonly) uint32_t flags;
+
+//! The UUID from the image's LC_UUID load command, or \c nil if the image
+//! does not have one.
+@property (nonatomic, readonly) NSUUID *uuid;
+
+//! The number of entries in the symbol table, from the image's LC_SYMTAB
+//! load command.  \c 0 if the image does not have one.
+@property (nonatomic, readonly) uint32_t nsyms;
+//! The number of local symbols, from the image's LC_DYSYMTAB load command.
+@property (nonatomic, readonly) uint32_t nlocalsym;
+//! The number of externally defined symbols, from the image's LC_DYSYMTAB
+//! load command.
+@property (nonatomic, readonly) uint32_t nextdefsym;
+//! The number of undefined symbols, from the image's LC_DYSYMTAB load
+//! command.
+@property (nonatomic, readonly) uint32_t nundefsym;
+
+@end
+
+
+
+//----------------------------------------------------------------------------//
+//! An instance of \c MKImageScanResult describes the outcome of scanning a
+//! single file.
+//
+@interface MKImageScanResult : NSObject {
+@package
+    NSURL *_fileURL;
+    mk_vm_size_t _fileSize;
+    NSArray *_images;
+    NSArray *_warnings;
+    NSError *_error;
+    NSTimeInterval _latency;
+}
+
+@property (nonatomic, readonly) NSURL *fileURL;
+
+//! The size of the file, in bytes.  \c 0 if the file could not be mapped.
+@property (nonatomic, readonly) mk_vm_size_t fileSize;
+
+//! An array of \ref MKScannedImage instances, one for each image that was
+//! parsed successfully, in the order they appear in the file.
+@property (nonatomic, readonly) NSArray /*MKScannedImage*/ *images;
+
+//! Errors for the architectures of a fat file that could not be parsed.
+@property (nonatomic, readonly) NSArray /*NSError*/ *warnings;
+
+//! If the file could not be mapped, or does not contain any image that could
+//! be parsed, an error describing why.  Otherwise \c nil.
+@property (nonatomic, readonly) NSError *error;
+
+//! The time spent mapping and parsing the file.
+@property (nonatomic, readonly) NSTimeInterval latency;
+
+@end
+
+
+
+//----------------------------------------------------------------------------//
+//! An instance of \c MKImageScanner parses the header, load commands, UUID
+//! and symbol counts of each Mach-O image in a list of files.
+//!
+//! Files are scanned in parallel by a pool of workers, each of which maps
+//! at most one file at a time.  The number of workers therefore bounds the
+//! number of files mapped into the process.  Each file is unmapped before
+//! its result is delivered.
+//!
+//! Results are delivered serially, in completion order, to the handler
+//! passed to \ref -scanWithHandler:.  At most \ref maximumPendingResults
+//! results may be waiting for the handler; once this limit is reached, the
+//! workers stop scanning until the handler catches up.
+//
+@interface MKImageScanner : NSObject {
+@package
+    NSArray *_fileURLs;
+    NSUInteger _maximumConcurrentMappings;
+    NSUInteger _maximumPendingResults;
+    /// Statistics ///
+    uint64_t _filesScanned;
+    uint64_t _imagesScanned;
+    uint64_t _failedFiles;
+    uint64_t _bytesScanned;
+    uint64_t _startTime;
+    uint64_t _endTime;
+    uint64_t _stallTime;
+    _Atomic(NSUInteger) _stalledWorkers;
+    NSTimeInterval _totalLatency;
+    NSTimeInterval _maximumLatency;
+}
+
+//! Initializes the receiver with an array of file URLs to scan.
+- (instancetype)initWithFileURLs:(NSArray /*NSURL*/ *)fileURLs NS_DESIGNATED_INITIALIZER;
+
+@property (nonatomic, readonly) NSArray /*NSURL*/ *fileURLs;
+
+//! The maximum number of files that may be mapped at the same time.  This is
+//! also the number of workers.  Defaults to the number of active processors.
+@property (nonatomic) NSUInteger maximumConcurrentMappings;
+
+//! The maximum number of results that may be waiting to be delivered to the
+//! handler.  Defaults to twice the \ref maximumConcurrentMappings.
+@property (nonatomic) NSUInteger maximumPendingResults;
+
+//◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
+#pragma mark -  Scanning
+//! @name       Scanning
+//◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
+
+//! Scans each of the \ref fileURLs, invoking the \a handler with the result
+//! for each file.  The \a handler is never invoked concurrently with itself.
+//! Setting \a stop to \c YES stops the scan; the \a handler is not invoked
+//! again.
+//!
+//! This method returns once every result has been delivered.  It resets the
+//! statistics before it begins.
+- (void)scanWithHandler:(void (^)(MKImageScanResult *result, BOOL *stop))handler;
+
+//◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
+#pragma mark -  Statistics
+//! @name       Statistics
+//!
+//! @brief      These values are updated as each result is delivered.  They
+//!             may be read from the scan handler, or once
+//!             \ref -scanWithHandler: returns.
+//◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
+
+//! The number of results that have been delivered.
+@property (nonatomic, readonly) uint64_t filesScanned;
+//! The number of images that have been parsed.
+@property (nonatomic, readonly) uint64_t imagesScanned;
+//! The number of results that have been delivered with an error.
+@property (nonatomic, readonly) uint64_t failedFiles;
+//! The total size of the files that have been mapped.
+@property (nonatomic, readonly) uint64_t bytesScanned;
+
+//! The time since the scan began.  Once the scan completes, the duration of
+//! the scan.
+@property (nonatomic, readonly) NSTimeInterval elapsedTime;
+//! The mean \ref MKImageScanResult.latency of the delivered results.
+@property (nonatomic, readonly) NSTimeInterval averageLatency;
+//! The largest \ref MKImageScanResult.latency of the delivered results.
+@property (nonatomic, readonly) NSTimeInterval maximumLatency;
+//! The total time workers have spent waiting for the handler to accept
+//! a result.
+@property (nonatomic, readonly) NSTimeInterval stallTime;
+//! The number of workers that are currently waiting for the handler to
+//! accept a result.
+@property (nonatomic, readonly) NSUInteger stalledWorkers;
+
+//! \ref filesScanned divided by \ref elapsedTime.
+@property (nonatomic, readonly) double filesPerSecond;
+//! \ref bytesScanned divided by \ref elapsedTime.
+@property (nonatomic, readonly) double bytesPerSecond;
+
+@end
@@ -0,0 +1,428 @@
+//----------------------------------------------------------------------------//
+//|
+//|             MachOKit - A Lightweight Mach-O Parsing Library
+//|             MKImageScanner.m
+//|
+//|             D.V.
+//|             Copyright (c) 2014-2015 D.V. All rights reserved.
+//|
+//| Permission is hereby granted, free of charge, to any person obtaining a
+//| copy of this software and associated documentation files (the "Software"),
+//| to deal in the Software without restriction, including without limitation
+//| the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//| and/or sell copies of the Software, and to permit persons to whom the
+//| Software is furnished to do so, subject to the following conditions:
+//|
+//| The above copyright notice and this permission notice shall be included
+//| in all copies or substantial portions of the Software.
+//|
+//| THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+//| OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+//| MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+//| IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+//| CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+//| TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//| SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//----------------------------------------------------------------------------//
+
+#import "MKImageScanner.h"
+#import "NSError+MK.h"
+
+#include <mach/mach_time.h>
+#include <mach-o/fat.h>
+#include <stdatomic.h>
+
+//|++++++++++++++++++++++++++++++++++++|//
+static NSTimeInterval
+MKImageScannerSeconds(uint64_t ticks)
+{
+    static mach_timebase_info_data_t timebase;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        mach_timebase_info(&timebase);
+    });
+    
+    return ((NSTimeInterval)ticks * timebase.numer / timebase.denom) / NSEC_PER_SEC;
+}
+
+
+
+//----------------------------------------------------------------------------//
+@implementation MKScannedImage
+
+@synthesize offset = _offset;
+@synthesize cputype = _cputype;
+@synthesize cpusubtype = _cpusubtype;
+@synthesize filetype = _filetype;
+@synthesize ncmds = _ncmds;
+@synthesize sizeofcmds = _sizeofcmds;
+@synthesize flags = _flags;
+@synthesize uuid = _uuid;
+@synthesize nsyms = _nsyms;
+@synthesize nlocalsym = _nlocalsym;
+@synthesize nextdefsym = _nextdefsym;
+@synthesize nundefsym = _nundefsym;
+
+//|++++++++++++++++++++++++++++++++++++|//
+- (instancetype)initWithMemoryMap:(mk_memory_map_file_t*)memoryMap name:(const char*)name offset:(mk_vm_address_t)offset error:(NSError**)error
+{
+    self = [super init];
+    if (self == nil) return nil;
+    
+    mk_macho_t macho;
+    mk_error_t err;
+    
+    if ((err = mk_macho_init(NULL, name, 0, offset, memoryMap, &macho))) {
+        MK_ERROR_OUT = [NSError mk_errorWithDomain:MKErrorDomain code:err description:@"Could not initialize the image at offset 0x%" MK_VM_PRIxADDR ".", offset];
+        [self release]; return nil;
+    }
+    
+    _offset = offset;
+    _cputype = mk_macho_get_cpu_type(&macho);
+    _cpusubtype = mk_macho_get_cpu_subtype(&macho);
+    _filetype = mk_macho_get_filetype(&macho);
+    _ncmds = mk_macho_get_ncmds(&macho);
+    _sizeofcmds = mk_macho_get_sizeofcmds(&macho);
+    _flags = mk_macho_get_flags(&macho);
+    
+    // A single pass over the load commands collects everything else.  The
+    // commands are in the byte order of the image.
+    const mk_byteorder_t *byte_order = mk_macho_get_byte_order(&macho);
+    struct load_command *lc = NULL;
+    
+    while ((lc = mk_macho_next_command(&macho, lc, NULL)))
+    {
+        uint32_t cmdsize = mk_byteorder_swap32(byte_order, lc->cmdsize);
+        
+        switch (mk_byteorder_swap32(byte_order, lc->cmd)) {
+            case LC_UUID:
+                if (_uuid == nil && cmdsize >= sizeof(struct uuid_command))
+                    _uuid = [[NSUUID alloc] initWithUUIDBytes:((struct uuid_command*)lc)->uuid];
+                break;
+            case LC_SYMTAB:
+                if (cmdsize >= sizeof(struct symtab_command))
+                    _nsyms = mk_byteorder_swap32(byte_order, ((struct symtab_command*)lc)->nsyms);
+                break;
+            case LC_DYSYMTAB:
+                if (cmdsize >= sizeof(struct dysymtab_command)) {
+                    struct dysymtab_command *dysymtab = (struct dysymtab_command*)lc;
+                    _nlocalsym = mk_byteorder_swap32(byte_order, dysymtab->nlocalsym);
+                    _nextdefsym = mk_byteorder_swap32(byte_order, dysymtab->nextdefsym);
+                    _nundefsym = mk_byteorder_swap32(byte_order, dysymtab->nundefsym);
+                }
+                break;
+            default:
+                break;
+        }
+    }
+    
+    mk_macho_free(&macho);
+    
+    return self;
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+- (void)dealloc
+{
+    [_uuid release];
+    
+    [super dealloc];
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+- (NSString*)description
+{ return [NSString stringWithFormat:@"<%@ %p; offset = 0x%" MK_VM_PRIxADDR ", cputype = %i, filetype = %" PRIu32 ", uuid = %@>", self.class, self, _offset, _cputype, _filetype, _uuid.UUIDString]; }
+
+@end
+
+
+
+//----------------------------------------------------------------------------//
+@implementation MKImageScanResult
+
+@synthesize fileURL = _fileURL;
+@synthesize fileSize = _fileSize;
+@synthesize images = _images;
+@synthesize warnings = _warnings;
+@synthesize error = _error;
+@synthesize latency = _latency;
+
+//|++++++++++++++++++++++++++++++++++++|//
+- (instancetype)initWithFileURL:(NSURL*)fileURL
+{
+    self = [super init];
+    if (self == nil) return nil;
+    
+    _fileURL = [fileURL retain];
+    
+    uint64_t start = mach_absolute_time();
+    NSMutableArray *images = [[NSMutableArray alloc] init];
+    NSMutableArray *warnings = [[NSMutableArray alloc] init];
+    
+    const char *path = fileURL.fileSystemRepresentation;
+    mk_memory_map_file_t memoryMap;
+    mk_error_t err;
+    
+    if (path == NULL) {
+        _error = [[NSError mk_errorWithDomain:MKErrorDomain code:MK_EINVAL description:@"%@ is not a file URL.", fileURL] retain];
+    } else if ((err = mk_memory_map_file_init(path, NULL, &memoryMap))) {
+        _error = [[NSError mk_errorWithDomain:MKErrorDomain code:err description:@"Could not map %s.", path] retain];
+    } else {
+        _fileSize = mk_memory_map_file_get_size(&memoryMap);
+        
+        struct fat_header header;
+        uint32_t magic = 0;
+        if (mk_memory_map_copy_bytes(&memoryMap, 0, 0, &header, sizeof(header), true, NULL) == sizeof(header))
+            magic = OSSwapBigToHostInt32(header.magic);
+        
+        if (magic == FAT_MAGIC || magic == FAT_MAGIC_64)
+        {
+            uint32_t nfat_arch = OSSwapBigToHostInt32(header.nfat_arch);
+            bool fat64 = (magic == FAT_MAGIC_64);
+            mk_vm_size_t archSize = fat64 ? sizeof(struct fat_arch_64) : sizeof(struct fat_arch);
+            
+            for (uint32_t i = 0; i < nfat_arch; i++)
+            {
+                union {
+                    struct fat_arch arch32;
+                    struct fat_arch_64 arch64;
+                } arch;
+                mk_vm_offset_t offset = sizeof(header) + (mk_vm_offset_t)i * archSize;
+                
+                if (mk_memory_map_copy_bytes(&memoryMap, offset, 0, &arch, archSize, true, &err) < archSize) {
+                    [warnings addObject:[NSError mk_errorWithDomain:MKErrorDomain code:err description:@"Could not read architecture %" PRIu32 ".", i]];
+                    break;
+                }
+                
+                mk_vm_address_t archOffset = fat64 ? OSSwapBigToHostInt64(arch.arch64.offset) : OSSwapBigToHostInt32(arch.arch32.offset);
+                
+                NSError *e = nil;
+                MKScannedImage *image = [[MKScannedImage alloc] initWithMemoryMap:&memoryMap name:path offset:archOffset error:&e];
+                if (image)
+                    [images addObject:image];
+                else
+                    [warnings addObject:e];
+                [image release];
+            }
+            
+            if (images.count == 0)
+                _error = [[NSError mk_errorWithDomain:MKErrorDomain code:MK_EINVALID_DATA description:@"None of the %" PRIu32 " architectures in %s could be parsed.", nfat_arch, path] retain];
+        }
+        else
+        {
+            NSError *e = nil;
+            MKScannedImage *image = [[MKScannedImage alloc] initWithMemoryMap:&memoryMap name:path offset:0 error:&e];
+            if (image)
+                [images addObject:image];
+            else
+                _error = [e retain];
+            [image release];
+        }
+        
+        mk_memory_map_file_free(&memoryMap);
+    }
+    
+    _images = [images copy];
+    _warnings = [warnings copy];
+    [images release];
+    [warnings release];
+    
+    _latency = MKImageScannerSeconds(mach_absolute_time() - start);
+    
+    return self;
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+- (void)dealloc
+{
+    [_fileURL release];
+    [_images release];
+    [_warnings release];
+    [_error release];
+    
+    [super dealloc];
+}
+
+@end
+
+
+
+//----------------------------------------------------------------------------//
+@implementation MKImageScanner
+
+@synthesize fileURLs = _fileURLs;
+@synthesize maximumConcurrentMappings = _maximumConcurrentMappings;
+@synthesize maximumPendingResults = _maximumPendingResults;
+@synthesize filesScanned = _filesScanned;
+@synthesize imagesScanned = _imagesScanned;
+@synthesize failedFiles = _failedFiles;
+@synthesize bytesScanned = _bytesScanned;
+@synthesize maximumLatency = _maximumLatency;
+
+//|++++++++++++++++++++++++++++++++++++|//
+- (instancetype)initWithFileURLs:(NSArray*)fileURLs
+{
+    NSParameterAssert(fileURLs);
+    
+    self = [super init];
+    if (self == nil) return nil;
+    
+    _fileURLs = [fileURLs copy];
+    _maximumConcurrentMappings = MAX(NSProcessInfo.processInfo.activeProcessorCount, (NSUInteger)1);
+    _maximumPendingResults = _maximumConcurrentMappings * 2;
+    
+    return self;
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+- (instancetype)init
+{ return [self initWithFileURLs:@[]]; }
+
+//|++++++++++++++++++++++++++++++++++++|//
+- (void)dealloc
+{
+    [_fileURLs release];
+    
+    [super dealloc];
+}
+
+//◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
+#pragma mark -  Scanning
+//◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
+
+//|++++++++++++++++++++++++++++++++++++|//
+- (void)scanWithHandler:(void (^)(MKImageScanResult *result, BOOL *stop))handler
+{
+    NSParameterAssert(handler);
+    
+    NSArray *fileURLs = self.fileURLs;
+    NSUInteger count = fileURLs.count;
+    // Each worker maps one file at a time.
+    size_t workers = MIN(MAX(self.maximumConcurrentMappings, (NSUInteger)1), count);
+    
+    _filesScanned = 0;
+    _imagesScanned = 0;
+    _failedFiles = 0;
+    _bytesScanned = 0;
+    _stallTime = 0;
+    atomic_store_explicit(&_stalledWorkers, 0, memory_order_relaxed);
+    _totalLatency = 0;
+    _maximumLatency = 0;
+    _startTime = mach_absolute_time();
+    _endTime = 0;
+    
+    // Shared by the workers.  Lives on the stack, which is safe because this
+    // method does not return until every worker and delivery has finished.
+    // The blocks capture a pointer so the atomics always operate on the
+    // same storage.
+    struct {
+        atomic_uint_fast64_t next;
+        atomic_uint stopped;
+        atomic_uint_fast64_t stallTime;
+    } state;
+    atomic_init(&state.next, 0);
+    atomic_init(&state.stopped, 0);
+    atomic_init(&state.stallTime, 0);
+    typeof(state) *shared = &state;
+    
+    dispatch_queue_t deliveryQueue = dispatch_queue_create("com.DeVaukz.MachOKit.MKImageScanner", DISPATCH_QUEUE_SERIAL);
+    dispatch_semaphore_t pendingResults = dispatch_semaphore_create((long)MAX(self.maximumPendingResults, (NSUInteger)1));
+    dispatch_group_t deliveries = dispatch_group_create();
+    
+    dispatch_apply(workers, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^(size_t __unused worker) {
+        while (atomic_load_explicit(&shared->stopped, memory_order_acquire) == 0) @autoreleasepool {
+            uint64_t i = atomic_fetch_add_explicit(&shared->next, 1, memory_order_relaxed);
+            if (i >= count)
+                break;
+            
+            MKImageScanResult *result = [[MKImageScanResult alloc] initWithFileURL:fileURLs[(NSUInteger)i]];
+            
+            // Back-pressure.  Wait for the handler to drain the pending
+            // results before scanning another file.
+            uint64_t stallStart = mach_absolute_time();
+            if (dispatch_semaphore_wait(pendingResults, DISPATCH_TIME_NOW) != 0) {
+                atomic_fetch_add_explicit(&self->_stalledWorkers, 1, memory_order_release);
+                dispatch_semaphore_wait(pendingResults, DISPATCH_TIME_FOREVER);
+                atomic_fetch_sub_explicit(&self->_stalledWorkers, 1, memory_order_relaxed);
+            }
+            atomic_fetch_add_explicit(&shared->stallTime, mach_absolute_time() - stallStart, memory_order_relaxed);
+            
+            dispatch_group_async(deliveries, deliveryQueue, ^{
+                if (atomic_load_explicit(&shared->stopped, memory_order_acquire) == 0) {
+                    [self _recordResult:result];
+                    
+                    BOOL stop = NO;
+                    handler(result, &stop);
+                    if (stop)
+                        atomic_store_explicit(&shared->stopped, 1, memory_order_release);
+                }
+                
+                [result release];
+                dispatch_semaphore_signal(pendingResults);
+            });
+        }
+    });
+    
+    dispatch_group_wait(deliveries, DISPATCH_TIME_FOREVER);
+    _stallTime = atomic_load_explicit(&shared->stallTime, memory_order_relaxed);
+    _endTime = mach_absolute_time();
+    
+    dispatch_release(deliveries);
+    dispatch_release(pendingResults);
+    dispatch_release(deliveryQueue);
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+- (void)_recordResult:(MKImageScanResult*)result
+{
+    _filesScanned++;
+    _imagesScanned += result.images.count;
+    _bytesScanned += result.fileSize;
+    if (result.error)
+        _failedFiles++;
+    
+    _totalLatency += result.latency;
+    _maximumLatency = MAX(_maximumLatency, result.latency);
+}
+
+//◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
+#pragma mark -  Statistics
+//◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
+
+//|++++++++++++++++++++++++++++++++++++|//
+- (NSTimeInterval)elapsedTime
+{
+    if (_startTime == 0)
+        return 0;
+    
+    uint64_t endTime = _endTime ? _endTime : mach_absolute_time();
+    return MKImageScannerSeconds(endTime - _startTime);
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+- (NSTimeInterval)averageLatency
+{ return _filesScanned ? _totalLatency / _filesScanned : 0; }
+
+//|++++++++++++++++++++++++++++++++++++|//
+- (NSTimeInterval)stallTime
+{ return MKImageScannerSeconds(_stallTime); }
+
+//|++++++++++++++++++++++++++++++++++++|//
+- (NSUInteger)stalledWorkers
+{ return atomic_load_explicit(&_stalledWorkers, memory_order_acquire); }
+
+//|++++++++++++++++++++++++++++++++++++|//
+- (double)filesPerSecond
+{
+    NSTimeInterval elapsedTime = self.elapsedTime;
+    return elapsedTime > 0 ? _filesScanned / elapsedTime : 0;
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+- (double)bytesPerSecond
+{
+    NSTimeInterval elapsedTime = self.elapsedTime;
+    return elapsedTime > 0 ? _bytesScanned / elapsedTime : 0;
+}
+
+@end
@@ -33,12 +33,26 @@
 #import "MKLCSymtab.h"
 #import "MKSegment.h"
 #import "MKSection.h"
+#import "_MKSectionDictionary.h"
 
 _mk_internal NSString * const MKAllSegments = @"MKAllSegments";
 _mk_internal NSString * const MKSegmentsByLoadCommand = @"MKSegmentsByLoadCommand";
+_mk_internal NSString * const MKSegmentsByName = @"MKSegmentsByName";
+_mk_internal NSString * const MKSectionsBySegment = @"MKSectionsBySegment";
 _mk_internal NSString * const MKAllSections = @"MKAllSections";
 _mk_internal NSString * const MKIndexedSections = @"MKIndexedSections";
 
+//|++++++++++++++++++++++++++++++++++++|//
+//! Returns a copy of \a arraysByName in which each array is immutable.
+static NSDictionary*
+MKFreezeArraysByName(NSDictionary *arraysByName)
+{
+    NSMutableDictionary *frozen = [NSMutableDictionary dictionaryWithCapacity:arraysByName.count];
+    for (NSString *name in arraysByName)
+        frozen[name] = [[arraysByName[name] copy] autorelease];
+    return [NSDictionary dictionaryWithDictionary:frozen];
+}
+
 //----------------------------------------------------------------------------//
 @implementation MKMachOImage (Segments)
 
@@ -53,9 +67,11 @@ _mk_internal NSString * const MKIndexedSections = @"MKIndexedSections";
     @autoreleasepool {
         NSMutableArray *segments = [[NSMutableArray alloc] initWithCapacity:4];
         NSMapTable *segmentsByLoadCommand = [[NSMapTable alloc] initWithKeyOptions:NSMapTableObjectPointerPersonality valueOptions:NSMapTableStrongMemory capacity:4];
+        NSMutableDictionary *segmentsByName = [[NSMutableDictionary alloc] initWithCapacity:4];
+        NSMapTable *sectionsBySegment = [[NSMapTable alloc] initWithKeyOptions:NSMapTableObjectPointerPersonality valueOptions:NSMapTableStrongMemory capacity:4];
         
         NSMutableArray *sections = [[NSMutableArray alloc] init];
-        NSMutableDictionary *sectionsByIndex = [[NSMutableDictionary alloc] init];
+        NSMutableData *sectionIndices = [[NSMutableData alloc] init];
         // Use a uint64_t to avoid overflow issues if we have bad data.
         uint64_t sectionBaseIndex = 0;
         
@@ -75,6 +91,11 @@ _mk_internal NSString * const MKIndexedSections = @"MKIndexedSections";
             [segments addObject:segment];
             [segmentsByLoadCommand setObject:segment forKey:lc];
             
+            NSMutableArray *namedSegments = segmentsByName[segment.name];
+            if (namedSegments == nil && segment.name)
+                segmentsByName[segment.name] = namedSegments = [NSMutableArray arrayWithCapacity:1];
+            [namedSegments addObject:segment];
+            
             // Copy all sections from the segment into the sections dictionary
             // for the image.  The index of the section is derived from
             // the position of the segment's load command in the list of
@@ -82,33 +103,82 @@ _mk_internal NSString * const MKIndexedSections = @"MKIndexedSections";
             // command within its parent segment load command.
             {
                 NSArray *sectionLoadCommands = segment.loadCommand.sections;
+                NSMutableDictionary *sectionsByName = [NSMutableDictionary dictionaryWithCapacity:sectionLoadCommands.count];
                 
                 for (uint32_t i=0; i<sectionLoadCommands.count; i++) {
-                    id section = [segment sectionForLoadCommand:sectionLoadCommands[i]];
+                    MKSection *section = [segment sectionForLoadCommand:sectionLoadCommands[i]];
+                    uint64_t index = sectionBaseIndex + i;
                     [sections addObject:section];
-                    sectionsByIndex[@(sectionBaseIndex + i)] = section;
+                    [sectionIndices appendBytes:&index length:sizeof(index)];
+                    
+                    NSMutableArray *namedSections = sectionsByName[section.name];
+                    if (namedSections == nil && section.name)
+                        sectionsByName[section.name] = namedSections = [NSMutableArray arrayWithCapacity:1];
+                    [namedSections addObject:section];
                 }
                 
+                [sectionsBySegment setObject:MKFreezeArraysByName(sectionsByName) forKey:segment];
                 sectionBaseIndex += segment.loadCommand.nsects;
             }
         }
         
+        // The arrays are handed out by the accessors below.  Store immutable
+        // copies so that callers can not modify the index.
         _segments = [@{
-            MKAllSegments: segments,
+            MKAllSegments: [[segments copy] autorelease],
             MKSegmentsByLoadCommand: segmentsByLoadCommand,
-            MKAllSections: sections,
-            MKIndexedSections: [NSDictionary dictionaryWithDictionary:sectionsByIndex]
+            MKSegmentsByName: MKFreezeArraysByName(segmentsByName),
+            MKSectionsBySegment: sectionsBySegment,
+            MKAllSections: [[sections copy] autorelease],
+            MKIndexedSections: [self _indexedSections:sections indices:sectionIndices.bytes]
         } retain];
         
         [segments release];
         [segmentsByLoadCommand release];
+        [segmentsByName release];
+        [sectionsBySegment release];
         [sections release];
-        [sectionsByIndex release];
+        [sectionIndices release];
     }
     
     return _segments;
 }
 
+//|++++++++++++++++++++++++++++++++++++|//
+- (NSDictionary*)_indexedSections:(NSArray*)sections indices:(const uint64_t *)indices
+{
+    NSUInteger count = sections.count;
+    uint64_t capacity = 0;
+    
+    for (NSUInteger i = 0; i < count; i++)
+        capacity = MAX(capacity, indices[i] + 1);
+    
+    // A segment that claims more sections than its load command holds leaves
+    // a gap in the section numbering.  Only back the dictionary with a C
+    // array when the gaps are small; otherwise fall back to hashing.
+    if (capacity > 2 * (uint64_t)count + MAX_SECT) {
+        NSMutableDictionary *sectionsByIndex = [NSMutableDictionary dictionaryWithCapacity:count];
+        for (NSUInteger i = 0; i < count; i++)
+            sectionsByIndex[@(indices[i])] = sections[i];
+        return [NSDictionary dictionaryWithDictionary:sectionsByIndex];
+    }
+    
+    MKSection * __unsafe_unretained *objects = (MKSection * __unsafe_unretained *)calloc(count ?: 1, sizeof(*objects));
+    uint32_t *slots = calloc(count ?: 1, sizeof(*slots));
+    
+    [sections getObjects:objects range:NSMakeRange(0, count)];
+    // Cast is safe; capacity was checked above.
+    for (NSUInteger i = 0; i < count; i++)
+        slots[i] = (uint32_t)indices[i];
+    
+    _MKSectionDictionary *sectionsByIndex = [[_MKSectionDictionary alloc] initWithSections:objects indices:slots count:count capacity:(NSUInteger)capacity];
+    
+    free(slots);
+    free(objects);
+    
+    return [sectionsByIndex autorelease];
+}
+
 //|++++++++++++++++++++++++++++++++++++|//
 - (NSSet*)segments
 { return [NSSet setWithArray:self._segments[MKAllSegments]]; }
@@ -117,6 +187,19 @@ _mk_internal NSString * const MKIndexedSections = @"MKIndexedSections";
 - (NSArray*)segmentsWithName:(NSString*)name
 {
     // TODO - verify what DYLD would do with duplicate segments.
+    static NSCharacterSet *metacharacters;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        metacharacters = [[NSCharacterSet characterSetWithCharactersInString:@"\\^$.|?*+()[]{}"] retain];
+    });
+    
+    // A name without regular expression metacharacters can only match
+    // itself, so it is looked up directly.
+    if (name == nil || [name rangeOfCharacterFromSet:metacharacters].location == NSNotFound) {
+        NSArray *segments = name ? self._segments[MKSegmentsByName][name] : nil;
+        return segments ?: @[];
+    }
+    
     return [self._segments[MKAllSegments] filteredArrayUsingPredicate:[NSPredicate predicateWithFormat:@"name MATCHES %@", name]];
 }
 
@@ -128,14 +211,9 @@ _mk_internal NSString * const MKIndexedSections = @"MKIndexedSections";
 - (NSArray*)sectionsWithName:(NSString*)sectName inSegment:(MKSegment*)segment
 {
     // TODO - verify what DYLD would do with duplicate sections.
-    NSMutableArray *sections = [NSMutableArray arrayWithCapacity:1];
-    
-    for (MKSection *section in self._segments[MKAllSections]) {
-        if (section.parent == segment && [section.name isEqualToString:sectName])
-            [sections addObject:section];
-    }
-    
-    return sections;
+    NSDictionary *sectionsByName = segment ? [self._segments[MKSectionsBySegment] objectForKey:segment] : nil;
+    NSArray *sections = sectName ? sectionsByName[sectName] : nil;
+    return sections ?: @[];
 }
 
 //|++++++++++++++++++++++++++++++++++++|//
@@ -68,6 +68,7 @@ typedef NS_OPTIONS(NSUInteger, MKMachOImageFlags) {
     // Header //
     MKMachHeader *_header;
     NSArray *_loadCommands;
+    NSDictionary *_loadCommandsByType;
     // Segments //
     NSDictionary *_segments;
     // Symbols //
@@ -122,7 +123,8 @@ typedef NS_OPTIONS(NSUInteger, MKMachOImageFlags) {
 
 //! Filters the \ref loadCommands array to those of the specified \a type
 //! and returns the result.  The relative ordering of the returned load
-//! commands is preserved.
+//! commands is preserved.  The load commands are grouped by type when the
+//! image is initialized, so this method does not search \ref loadCommands.
 - (NSArray*)loadCommandsOfType:(uint32_t)type;
 
 @end
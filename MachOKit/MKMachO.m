@@ -116,6 +116,7 @@
         @autoreleasepool {
                 
             NSError *loadCommandError = nil;
+            uint32_t index = _header.ncmds - loadCommandCount;
                 
             // It is safe to pass the mach_vm_offset_t offset as the offset
             // parameter because the offset can not grow beyond the header size,
@@ -127,7 +128,7 @@
                 // If we fail to instantiate an instance of the MKLoadCommand it
                 // means we've walked off the end of memory that can be mapped by
                 // our MKMemoryMap.
-                MK_PUSH_UNDERLYING_WARNING(loadCommands, loadCommandError, @"Failed to instantiate load command at index %" PRIi32 "", _header.ncmds - loadCommandCount);
+                MK_PUSH_UNDERLYING_WARNING(loadCommands, loadCommandError, @"Failed to instantiate load command at index %" PRIi32 "", index);
                 break;
             }
                 
@@ -142,16 +143,39 @@
             // + mach_header->sizeofcmds).  However, we don't care as long as there
             // was not an overflow.
             if (oldOffset > offset) {
-                MK_PUSH_WARNING(loadCommands, MK_EOVERFLOW, @"Adding size of load command at index %" PRIi32 " to offset into load commands triggered an overflow.", _header.ncmds - loadCommandCount);
+                MK_PUSH_WARNING(loadCommands, MK_EOVERFLOW, @"Adding size of load command at index %" PRIi32 " to offset into load commands triggered an overflow.", index);
                 break;
             }
             // We will add a warning however.
             if (offset > _header.nodeSize + (mach_vm_size_t)loadCommandLength)
-                MK_PUSH_WARNING(loadCommands, MK_EINVALID_DATA, @"Part of load command at index %" PRIi32 " is beyond sizeofcmds for this image.  This is invalid.", _header.ncmds - loadCommandCount);
+                MK_PUSH_WARNING(loadCommands, MK_EINVALID_DATA, @"Part of load command at index %" PRIi32 " is beyond sizeofcmds for this image.  This is invalid.", index);
         }}
         
         _loadCommands = [loadCommands copy];
         [loadCommands release];
+        
+        // Group the load commands by type for -loadCommandsOfType:.
+        NSMutableDictionary *loadCommandsByType = [[NSMutableDictionary alloc] init];
+        for (MKLoadCommand *lc in _loadCommands) {
+            NSNumber *type = @([lc.class ID]);
+            NSMutableArray *commands = loadCommandsByType[type];
+            if (commands == nil) {
+                commands = [[NSMutableArray alloc] initWithCapacity:1];
+                loadCommandsByType[type] = commands;
+                [commands release];
+            }
+            [commands addObject:lc];
+        }
+        
+        // Freeze the per-type arrays so they can be returned directly.
+        for (NSNumber *type in loadCommandsByType.allKeys) {
+            NSArray *commands = [loadCommandsByType[type] copy];
+            loadCommandsByType[type] = commands;
+            [commands release];
+        }
+        
+        _loadCommandsByType = [loadCommandsByType copy];
+        [loadCommandsByType release];
     }
     
     // Determine the file and VM address of this image
@@ -194,6 +218,23 @@
     return self;
 }
 
+//|++++++++++++++++++++++++++++++++++++|//
+- (void)dealloc
+{
+    [_indirectSymbolTable release];
+    [_symbolTable release];
+    [_stringTable release];
+    [_segments release];
+    [_loadCommandsByType release];
+    [_loadCommands release];
+    [_header release];
+    [_dataModel release];
+    [_name release];
+    [_mapping release];
+    
+    [super dealloc];
+}
+
 //◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
 #pragma mark - Retrieving the Initialization Context
 //◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
@@ -234,7 +275,7 @@
 
 //|++++++++++++++++++++++++++++++++++++|//
 - (NSArray*)loadCommandsOfType:(uint32_t)type
-{ return [self.loadCommands filteredArrayUsingPredicate:[NSPredicate predicateWithFormat:@"class.ID == %@", @(type)]]; }
+{ return _loadCommandsByType[@(type)] ?: @[]; }
 
 //◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
 #pragma mark - MKNode
@@ -244,6 +285,10 @@
 - (MKMemoryMap*)memoryMap
 { return _mapping; }
 
+//|++++++++++++++++++++++++++++++++++++|//
+- (MKMachOImage*)macho
+{ return self; }
+
 //|++++++++++++++++++++++++++++++++++++|//
 - (mk_vm_size_t)nodeSize
 { return 0; }
@@ -88,6 +88,17 @@
 
 - (vm_size_t)copyBytesAtOffset:(mk_vm_offset_t)offset fromAddress:(mk_vm_address_t)contextAddress into:(void*)buffer length:(mk_vm_size_t)length requireFull:(BOOL)requireFull error:(NSError**)error;
 
+//! Copies the memory described by each of the \a count \a requests into the
+//! request's buffer.  Requests that overlap, or are separated by less than a
+//! page, are serviced by a single remapping, as by
+//! \ref mk_memory_map_copy_requests.  The \c copied and \c error
+//! fields of every request are set on return.
+//!
+//! @return
+//! \c YES if every request succeeded.  Otherwise, \c NO and \a error is
+//! set to the error of the first request which failed.
+- (BOOL)copyBytesWithRequests:(mk_memory_map_copy_request_t*)requests count:(NSUInteger)count requireFull:(BOOL)requireFull error:(NSError**)error;
+
 - (uint8_t)readByteAtOffset:(mk_vm_offset_t)offset fromAddress:(mk_vm_address_t)contextAddress withDataModel:(id<MKDataModel>)dataModel error:(NSError**)error;
 
 - (uint16_t)readWordAtOffset:(mk_vm_offset_t)offset fromAddress:(mk_vm_address_t)contextAddress withDataModel:(id<MKDataModel>)dataModel error:(NSError**)error;
@@ -126,6 +126,40 @@
     return retValue;
 }
 
+//|++++++++++++++++++++++++++++++++++++|//
+static void
+MKMemoryMapMapRun(void *context, mk_vm_address_t address, mk_vm_size_t length, mk_memory_map_copy_run_c copy, void *state)
+{
+    MKMemoryMap *self = (MKMemoryMap*)context;
+    __block BOOL copied = NO;
+    
+    // The remapping may be short; mk_memory_map_copy_requests() checks each
+    // request against requireFull.
+    [self remapBytesAtOffset:0 fromAddress:address length:length requireFull:NO withHandler:^(vm_address_t mapping, vm_size_t mappingLength, NSError *error) {
+        if (copied)
+            return;
+        copied = YES;
+        copy(state, mapping, mappingLength, error ? (mk_error_t)(error.code & ~MK_EMEMORY_ERROR) : MK_ESUCCESS);
+    }];
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+- (BOOL)copyBytesWithRequests:(mk_memory_map_copy_request_t*)requests count:(NSUInteger)count requireFull:(BOOL)requireFull error:(NSError**)error
+{
+    if (mk_memory_map_copy_requests(requests, count, requireFull, &MKMemoryMapMapRun, self) == MK_ESUCCESS)
+        return YES;
+    
+    for (NSUInteger i = 0; i < count; i++) {
+        if (requests[i].error == MK_ESUCCESS)
+            continue;
+        
+        MK_ERROR_OUT = [NSError mk_errorWithDomain:MKErrorDomain code:(requests[i].error | MK_EMEMORY_ERROR) description:@"Failed to copy request %lu (offset = %" MK_VM_PRIiOFFSET ", address = 0x%" MK_VM_PRIxADDR ", length = %" MK_VM_PRIuSIZE ") from %@.  Error %s.", (unsigned long)i, requests[i].offset, requests[i].address, requests[i].length, self, mk_error_string(requests[i].error)];
+        break;
+    }
+    
+    return NO;
+}
+
 //|++++++++++++++++++++++++++++++++++++|//
 - (uint8_t)readByteAtOffset:(mk_vm_offset_t)offset fromAddress:(mk_vm_address_t)contextAddress withDataModel:(id<MKDataModel>)dataModel error:(NSError**)error
 {
@@ -152,7 +186,7 @@
         return 0;
     
     if (dataModel.byteOrder)
-        return dataModel.byteOrder->swap16( retValue );
+        return mk_byteorder_swap16(dataModel.byteOrder, retValue);
     else
         return retValue;
 }
@@ -168,7 +202,7 @@
         return 0;
     
     if (dataModel.byteOrder)
-        return dataModel.byteOrder->swap32( retValue );
+        return mk_byteorder_swap32(dataModel.byteOrder, retValue);
     else
         return retValue;
 }
@@ -184,7 +218,7 @@
         return 0;
     
     if (dataModel.byteOrder)
-        return dataModel.byteOrder->swap64( retValue );
+        return mk_byteorder_swap64(dataModel.byteOrder, retValue);
     else
         return retValue;
 }
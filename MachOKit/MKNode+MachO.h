@@ -38,6 +38,9 @@
 @interface MKNode (MachO)
 
 //! The nearest \ref MKMachOImage ancestor node.
+//!
+//! Resolved when the node is initialized.  Returns \c nil once the image
+//! has been deallocated.
 @property (nonatomic, readonly) MKMachOImage *macho;
 
 @end
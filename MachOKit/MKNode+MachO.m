@@ -28,11 +28,13 @@
 #import "MKNode+MachO.h"
 #import "MKMachO.h"
 
+#import <objc/runtime.h>
+
 //----------------------------------------------------------------------------//
 @implementation MKNode (MachO)
 
 //|++++++++++++++++++++++++++++++++++++|//
 - (MKMachOImage*)macho
-{ return [self nearestAncestorOfType:MKMachOImage.class]; }
+{ return objc_loadWeak(&_nodeMachO); }
 
 @end
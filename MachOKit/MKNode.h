@@ -31,8 +31,21 @@
 #import <MachOKit/MKNodeDescription.h>
 #import <MachOKit/MKMemoryMap.h>
 #import <MachOKit/MKDataModel.h>
+#include <stdatomic.h>
 @class MKNode;
 
+//! The number of discriminators a \ref MKNodeSubclassCache holds.
+#define MK_NODE_SUBCLASS_CACHE_SIZE 512
+
+//! Storage for the classes returned by
+//! \ref +subclassForDiscriminator:lookup:, indexed by discriminator.  A
+//! class that caches its lookups returns a pointer to a zero-initialized
+//! static instance from \c +_subclassLookupCache.
+typedef struct MKNodeSubclassCache {
+    _Atomic(int32_t) generation;
+    _Atomic(Class) classes[MK_NODE_SUBCLASS_CACHE_SIZE];
+} MKNodeSubclassCache;
+
 //----------------------------------------------------------------------------//
 @protocol MKNodeDelegate <NSObject>
 - (void)logMessageFromNode:(MKNode*)node atLevel:(mk_logging_level_t)level inFile:(const char*)file line:(int)line function:(const char*)function message:(NSString*)message;
@@ -49,6 +62,16 @@
 @interface MKNode : NSObject {
 @package
     __weak MKNode *_parent;
+    struct MKNodeWarnings *_warnings;
+    // Resolved from the parent when the node is initialized.
+    MKMemoryMap *_nodeMemoryMap;
+    id<MKDataModel> _nodeDataModel;
+    __weak MKNode *_nodeMachO;
+    // The delegate set on this node, and the delegate resolved for it as
+    // of _delegateGeneration.  Both are unretained id<MKNodeDelegate>.
+    _Atomic(void*) _delegate;
+    _Atomic(void*) _resolvedDelegate;
+    _Atomic(int32_t) _delegateGeneration;
 }
 
 //! Initializes the receiver with the provided \a parent node.  Subclasses
@@ -76,23 +99,45 @@
 
 //! The delegate for this node.  If no delegate has been set for this node,
 //! the delegate of this node's ancestor.
+//!
+//! The inherited delegate is cached by each node.  Setting the delegate of
+//! any node invalidates every cached delegate.  A read that races with
+//! setting a delegate on another thread may return the previous delegate.
 @property (nonatomic, assign) id<MKNodeDelegate> delegate;
 
 //! The memory map for this node.  By default this is the memory map of this
 //! node's parent.  Subclasses should override the getter for this property
 //! to provide the \ref MKMemoryMap that is to be used by their child nodes.
+//!
+//! The default memory map is read from the parent once, when the node is
+//! initialized, and is retained by the node.  A subclass must therefore
+//! return its memory map before it initializes any child nodes.
 @property (nonatomic, readonly) MKMemoryMap *memoryMap;
 
 //! The data model used for accessing memory in this node.  By default this is
 //! the data model of this node's parent.  Subclasses should override the
 //! getter for this property to provide the \ref MKDataModel that is to be used
 //! by their child nodes.
+//!
+//! Like \ref memoryMap, the default data model is read from the parent when
+//! the node is initialized.
 @property (nonatomic, readonly) id<MKDataModel> dataModel;
 
 //! An array of warnings raised while initiaizing this node.  Each warning
 //! is represented by an instance of \c NSError.
 @property (nonatomic, copy) NSArray /*NSError*/ *warnings;
 
+//! Appends a warning to \ref warnings without copying the existing
+//! warnings.  The \c NSError for the warning is not created until
+//! \ref warnings is next read.  Use \ref MK_PUSH_WARNING or
+//! \ref MK_PUSH_UNDERLYING_WARNING rather than calling this directly.
+- (void)pushWarningWithCode:(NSInteger)code property:(NSString*)property underlyingError:(NSError*)underlyingError description:(NSString*)description;
+//! Like \ref -pushWarningWithCode:property:underlyingError:description:,
+//! but the description is not created until \ref warnings is next read.
+//! The \a descriptionBlock is invoked at most once, while the warnings are
+//! locked; it must not access the warnings of the receiver.
+- (void)pushWarningWithCode:(NSInteger)code property:(NSString*)property underlyingError:(NSError*)underlyingError descriptionBlock:(NSString* (^)(void))descriptionBlock;
+
 //◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
 #pragma mark -  Navigating the Node Tree
 //! @name       Navigating the Node Tree
@@ -119,4 +164,16 @@
 //! provided block.
 + (Class)bestSubclassWithRanking:(uint32_t (^)(Class cls))rank;
 
+//! Returns the class previously found by \a lookup for \a discriminator,
+//! calling \a lookup if there is none.  The result of \a lookup must
+//! depend only on the discriminator.
+//!
+//! Lookups are cached only if the receiver returns storage from
+//! \c +_subclassLookupCache and \a discriminator is less than
+//! \ref MK_NODE_SUBCLASS_CACHE_SIZE.  Reading the cache does not take a
+//! lock.  The cache is emptied when a new image is loaded into the process,
+//! as it may contain additional subclasses.  A lookup that overlaps the
+//! load of an image is returned but not cached.
++ (Class)subclassForDiscriminator:(uint32_t)discriminator lookup:(Class (^)(void))lookup;
+
 @end
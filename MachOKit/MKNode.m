@@ -26,15 +26,77 @@
 //----------------------------------------------------------------------------//
 
 #import "MKNode.h"
+#import "MKNode+MachO.h"
+#import "NSError+MK.h"
 
 #import <objc/runtime.h>
+#include <mach-o/dyld.h>
+#include <pthread.h>
 
-_mk_internal const char * const AssociatedDelegate = "AssociatedDelegate";
-_mk_internal const char * const AssociatedWarnings = "AssociatedWarnings";
+//! A warning which has been pushed but not yet turned into an \c NSError.
+typedef struct MKNodePendingWarning {
+    NSInteger code;
+    NSString *property;
+    //! The description, or \c nil if \c descriptionBlock has not been
+    //! invoked yet.
+    NSString *description;
+    NSString* (^descriptionBlock)(void);
+    NSError *underlyingError;
+} MKNodePendingWarning;
+
+//! The warnings of a node.  Allocated when the first warning is pushed.
+struct MKNodeWarnings {
+    pthread_mutex_t lock;
+    //! The warnings which have been turned into an \c NSError, in order.
+    NSMutableArray *errors;
+    //! An immutable copy of \c errors, or \c nil if it is out of date.
+    NSArray *snapshot;
+    //! Warnings pushed after the last element of \c errors.
+    MKNodePendingWarning *pending;
+    NSUInteger pendingCount;
+    NSUInteger pendingCapacity;
+};
+
+//|++++++++++++++++++++++++++++++++++++|//
+static void
+MKNodeReleasePendingWarning(MKNodePendingWarning *pending)
+{
+    [pending->property release];
+    [pending->description release];
+    [pending->descriptionBlock release];
+    [pending->underlyingError release];
+}
+
+//! Incremented each time an image is loaded.  Subclass lookup caches filled
+//! in an earlier generation are emptied before they are next read.
+static _Atomic(int32_t) MKNodeSubclassGeneration = 0;
+
+//|++++++++++++++++++++++++++++++++++++|//
+static void MKNodeImageAdded(const struct mach_header *mh, intptr_t slide)
+{
+#pragma unused (mh)
+#pragma unused (slide)
+    atomic_fetch_add_explicit(&MKNodeSubclassGeneration, 1, memory_order_release);
+}
+
+//! Incremented each time the delegate of any node is set.  A node's
+//! resolved delegate is only valid in the generation it was resolved in.
+//! Starts at 1 so that a zeroed node never matches.
+static _Atomic(int32_t) MKNodeDelegateGeneration = 1;
 
 //----------------------------------------------------------------------------//
 @implementation MKNode
 
+//|++++++++++++++++++++++++++++++++++++|//
++ (void)initialize
+{
+    if (self != MKNode.class)
+        return;
+    
+    // Called once for each image that is already loaded.
+    _dyld_register_func_for_add_image(MKNodeImageAdded);
+}
+
 //|++++++++++++++++++++++++++++++++++++|//
 - (instancetype)initWithParent:(MKNode*)parent error:(NSError**)error
 {
@@ -44,6 +106,12 @@ _mk_internal const char * const AssociatedWarnings = "AssociatedWarnings";
     
     objc_storeWeak(&_parent, parent);
     
+    // Resolve the values a node inherits from its ancestors once, rather
+    // than walking the parent chain on each access.
+    _nodeMemoryMap = [parent.memoryMap retain];
+    _nodeDataModel = [parent.dataModel retain];
+    objc_storeWeak(&_nodeMachO, parent.macho);
+    
     return self;
 }
 
@@ -54,8 +122,22 @@ _mk_internal const char * const AssociatedWarnings = "AssociatedWarnings";
 //|++++++++++++++++++++++++++++++++++++|//
 - (void)dealloc
 {
-    self.delegate = nil;
+    if (_warnings) {
+        for (NSUInteger i = 0; i < _warnings->pendingCount; i++)
+            MKNodeReleasePendingWarning(&_warnings->pending[i]);
+        free(_warnings->pending);
+        [_warnings->errors release];
+        [_warnings->snapshot release];
+        pthread_mutex_destroy(&_warnings->lock);
+        free(_warnings);
+    }
+    
+    if (atomic_load_explicit(&_delegate, memory_order_relaxed))
+        self.delegate = nil;
+    objc_storeWeak(&_nodeMachO, nil);
     objc_storeWeak(&_parent, nil);
+    [_nodeDataModel release];
+    [_nodeMemoryMap release];
     [super dealloc];
 }
 
@@ -74,30 +156,167 @@ _mk_internal const char * const AssociatedWarnings = "AssociatedWarnings";
 //|++++++++++++++++++++++++++++++++++++|//
 - (id<MKNodeDelegate>)delegate
 {
-    id<MKNodeDelegate> delegate = objc_getAssociatedObject(self, AssociatedDelegate);
-    if (delegate)
-        return delegate;
-    else
-        return self.parent.delegate;
+    int32_t generation = atomic_load_explicit(&MKNodeDelegateGeneration, memory_order_acquire);
+    if (atomic_load_explicit(&_delegateGeneration, memory_order_acquire) == generation)
+        return (id<MKNodeDelegate>)atomic_load_explicit(&_resolvedDelegate, memory_order_relaxed);
+    
+    id<MKNodeDelegate> delegate = (id<MKNodeDelegate>)atomic_load_explicit(&_delegate, memory_order_acquire);
+    if (delegate == nil)
+        delegate = self.parent.delegate;
+    
+    // Publish the delegate before the generation that validates it.  The
+    // acquire load of the generation above pairs with this release store.
+    atomic_store_explicit(&_resolvedDelegate, (void*)delegate, memory_order_relaxed);
+    atomic_store_explicit(&_delegateGeneration, generation, memory_order_release);
+    
+    return delegate;
 }
 
 //|++++++++++++++++++++++++++++++++++++|//
 - (void)setDelegate:(id<MKNodeDelegate>)delegate
-{ objc_setAssociatedObject(self, AssociatedDelegate, delegate, OBJC_ASSOCIATION_ASSIGN); }
+{
+    atomic_store_explicit(&_delegate, (void*)delegate, memory_order_release);
+    // Descendants may have cached the previous delegate.
+    atomic_fetch_add_explicit(&MKNodeDelegateGeneration, 1, memory_order_acq_rel);
+}
 
 //|++++++++++++++++++++++++++++++++++++|//
 - (MKMemoryMap*)memoryMap
-{ return self.parent.memoryMap; }
+{ return _nodeMemoryMap; }
 
 //|++++++++++++++++++++++++++++++++++++|//
 - (id<MKDataModel>)dataModel
-{ return self.parent.dataModel; }
+{ return _nodeDataModel; }
+
+//|++++++++++++++++++++++++++++++++++++|//
+- (struct MKNodeWarnings*)_warningsBuffer
+{
+    struct MKNodeWarnings *warnings = _warnings;
+    if (warnings)
+        return warnings;
+    
+    warnings = calloc(1, sizeof(*warnings));
+    if (warnings == NULL)
+        @throw [NSException exceptionWithName:NSMallocException reason:@"Failed to allocate the warnings buffer." userInfo:nil];
+    pthread_mutex_init(&warnings->lock, NULL);
+    warnings->errors = [[NSMutableArray alloc] init];
+    
+    // Another thread may have pushed the first warning at the same time.
+    if (!__sync_bool_compare_and_swap(&_warnings, NULL, warnings)) {
+        [warnings->errors release];
+        pthread_mutex_destroy(&warnings->lock);
+        free(warnings);
+    }
+    
+    return _warnings;
+}
 
 //|++++++++++++++++++++++++++++++++++++|//
 - (NSArray*)warnings
-{ return objc_getAssociatedObject(self, AssociatedWarnings) ?: @[]; }
-- (void)setWarnings:(NSArray *)warnings
-{ objc_setAssociatedObject(self, AssociatedWarnings, warnings, OBJC_ASSOCIATION_COPY); }
+{
+    struct MKNodeWarnings *warnings = _warnings;
+    if (warnings == NULL)
+        return @[];
+    
+    NSArray *retValue;
+    pthread_mutex_lock(&warnings->lock);
+    {
+        for (NSUInteger i = 0; i < warnings->pendingCount; i++) {
+            MKNodePendingWarning *pending = &warnings->pending[i];
+            NSString *description = pending->description ?: pending->descriptionBlock();
+            NSError *error;
+            if (pending->underlyingError)
+                error = [NSError mk_errorWithDomain:MKErrorDomain code:pending->code property:pending->property underlyingError:pending->underlyingError description:@"%@", description];
+            else
+                error = [NSError mk_errorWithDomain:MKErrorDomain code:pending->code property:pending->property description:@"%@", description];
+            [warnings->errors addObject:error];
+            
+            MKNodeReleasePendingWarning(pending);
+        }
+        
+        if (warnings->pendingCount) {
+            warnings->pendingCount = 0;
+            [warnings->snapshot release];
+            warnings->snapshot = nil;
+        }
+        
+        if (warnings->snapshot == nil)
+            warnings->snapshot = [warnings->errors copy];
+        retValue = [[warnings->snapshot retain] autorelease];
+    }
+    pthread_mutex_unlock(&warnings->lock);
+    
+    return retValue;
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+- (void)setWarnings:(NSArray *)newWarnings
+{
+    struct MKNodeWarnings *warnings = [self _warningsBuffer];
+    
+    pthread_mutex_lock(&warnings->lock);
+    {
+        for (NSUInteger i = 0; i < warnings->pendingCount; i++)
+            MKNodeReleasePendingWarning(&warnings->pending[i]);
+        warnings->pendingCount = 0;
+        
+        [warnings->errors setArray:newWarnings ?: @[]];
+        [warnings->snapshot release];
+        warnings->snapshot = nil;
+    }
+    pthread_mutex_unlock(&warnings->lock);
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+- (void)pushWarningWithCode:(NSInteger)code property:(NSString*)property underlyingError:(NSError*)underlyingError description:(NSString*)description
+{
+    NSParameterAssert(property);
+    
+    [self _pushWarning:(MKNodePendingWarning){
+        .code = code,
+        .property = [property copy],
+        .description = [description copy],
+        .underlyingError = [underlyingError retain]
+    }];
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+- (void)pushWarningWithCode:(NSInteger)code property:(NSString*)property underlyingError:(NSError*)underlyingError descriptionBlock:(NSString* (^)(void))descriptionBlock
+{
+    NSParameterAssert(property);
+    NSParameterAssert(descriptionBlock);
+    
+    [self _pushWarning:(MKNodePendingWarning){
+        .code = code,
+        .property = [property copy],
+        .descriptionBlock = [descriptionBlock copy],
+        .underlyingError = [underlyingError retain]
+    }];
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+- (void)_pushWarning:(MKNodePendingWarning)warning
+{
+    struct MKNodeWarnings *warnings = [self _warningsBuffer];
+    
+    pthread_mutex_lock(&warnings->lock);
+    {
+        if (warnings->pendingCount == warnings->pendingCapacity) {
+            NSUInteger capacity = warnings->pendingCapacity ? warnings->pendingCapacity * 2 : 4;
+            MKNodePendingWarning *pending = realloc(warnings->pending, capacity * sizeof(*pending));
+            if (pending == NULL) {
+                pthread_mutex_unlock(&warnings->lock);
+                MKNodeReleasePendingWarning(&warning);
+                @throw [NSException exceptionWithName:NSMallocException reason:@"Failed to grow the warnings buffer." userInfo:nil];
+            }
+            warnings->pending = pending;
+            warnings->pendingCapacity = capacity;
+        }
+        
+        warnings->pending[warnings->pendingCount++] = warning;
+    }
+    pthread_mutex_unlock(&warnings->lock);
+}
 
 //◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
 #pragma mark -   Navigating the Node Tree
@@ -205,4 +424,38 @@ _mk_internal const char * const AssociatedWarnings = "AssociatedWarnings";
     return self;
 }
 
+//|++++++++++++++++++++++++++++++++++++|//
++ (MKNodeSubclassCache*)_subclassLookupCache
+{ return NULL; }
+
+//|++++++++++++++++++++++++++++++++++++|//
++ (Class)subclassForDiscriminator:(uint32_t)discriminator lookup:(Class (^)(void))lookup
+{
+    MKNodeSubclassCache *cache = [self _subclassLookupCache];
+    if (cache == NULL || discriminator >= MK_NODE_SUBCLASS_CACHE_SIZE)
+        return lookup();
+    
+    int32_t generation = atomic_load_explicit(&MKNodeSubclassGeneration, memory_order_acquire);
+    if (atomic_load_explicit(&cache->generation, memory_order_acquire) != generation) {
+        for (size_t i = 0; i < MK_NODE_SUBCLASS_CACHE_SIZE; i++)
+            atomic_store_explicit(&cache->classes[i], Nil, memory_order_relaxed);
+        // Publish the cleared entries with the generation they belong to.
+        atomic_store_explicit(&cache->generation, generation, memory_order_release);
+    }
+    
+    // Threads racing to fill the same entry store the same class.
+    Class retValue = atomic_load_explicit(&cache->classes[discriminator], memory_order_acquire);
+    if (retValue == Nil) {
+        retValue = lookup();
+        
+        // Don't cache a class found before an image was loaded.  The image
+        // may contain a better subclass.
+        if (atomic_load_explicit(&MKNodeSubclassGeneration, memory_order_acquire) == generation &&
+            atomic_load_explicit(&cache->generation, memory_order_acquire) == generation)
+            atomic_store_explicit(&cache->classes[discriminator], retValue, memory_order_release);
+    }
+    
+    return retValue;
+}
+
 @end
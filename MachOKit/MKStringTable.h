@@ -31,20 +31,52 @@
 #import <MachOKit/MKLinkEditNode.h>
 
 @class MKMachOImage;
+@class MKCString;
 
 //----------------------------------------------------------------------------//
 //! The \c MKStringTable class parses the link-edit string table.
 //
+//! The contents of the string table are copied out of the memory map once,
+//! when the string table is initialized.  Strings are looked up by offset
+//! directly in that copy; \ref MKCString instances are only created when
+//! requested.
+//
 @interface MKStringTable : MKLinkEditNode {
 @package
+    NSData *_stringData;
     NSDictionary *_strings;
+    NSCache *_stringCache;
+    NSUInteger _cacheLimit;
 }
 
 //! Initializes the receiver with the provided Mach-O image.
 - (instancetype)initWithImage:(MKMachOImage*)image error:(NSError**)error;
 
+//! Returns a pointer to the \c NULL terminated string at \a offset from the
+//! start of the string table, or \c NULL if \a offset is not within the
+//! string table.  If \a length is not \c NULL, it is set to the length of
+//! the string, not including the \c NULL byte.
+//!
+//! The returned pointer is valid for the lifetime of the receiver.
+- (const char*)cStringAtOffset:(uint32_t)offset length:(size_t*)length;
+
+//! Returns an \ref MKCString for the string at \a offset from the start of
+//! the string table, or \c nil if \a offset is not within the string table.
+//! \a offset need not be the start of a string in the table; the linker
+//! may share the tail of a string between multiple symbols.
+- (MKCString*)stringAtOffset:(uint32_t)offset;
+
+//! The maximum number of \ref MKCString instances returned by
+//! \ref stringAtOffset: that are kept for reuse.  The default value of \c 0
+//! disables reuse, and a new instance is created for every call.
+@property (nonatomic) NSUInteger cacheLimit;
+
 //! An \c NSDictionary mapping offsets from the start of this node node to
 //! string entries, represented by instances of \c MKCString.
+//!
+//! This dictionary is built the first time it is accessed, and contains an
+//! entry for every string in the table.  Prefer \ref stringAtOffset: for
+//! looking up individual strings.
 @property (nonatomic, readonly) NSDictionary /*NSNumber -> MKCString*/ *strings;
 
 @end
@@ -36,8 +36,6 @@
 //----------------------------------------------------------------------------//
 @implementation MKStringTable
 
-@synthesize strings = _strings;
-
 //|++++++++++++++++++++++++++++++++++++|//
 - (instancetype)initWithSize:(mk_vm_size_t)size offset:(mk_vm_offset_t)offset inImage:(MKMachOImage*)image error:(NSError**)error
 {
@@ -50,29 +48,22 @@
     if (self.nodeSize == 0)
         return self;
     
-    NSMutableDictionary *strings = [[NSMutableDictionary alloc] init];
-    
-    offset = 0;
+    // Copy the string table once.  An extra NULL byte is appended so that
+    // every string handed out by -cStringAtOffset:length: is terminated, even
+    // if the last string in the table is not.
+    //
+    // Cast to NSUInteger is safe; nodeSize can't be larger than UINT32_MAX.
+    NSMutableData *stringData = [[NSMutableData alloc] initWithLength:(NSUInteger)self.nodeSize + 1];
+    NSError *e = nil;
     
-    // Cast to mk_vm_size_t is safe; nodeSize can't be larger than UINT32_MAX.
-    while ((mk_vm_size_t)offset < self.nodeSize)
-    {
-        NSError *e = nil;
-        MKCString *string = [[MKCString alloc] initWithOffset:offset fromParent:self error:&e];
-        if (string == nil) {
-            MK_PUSH_UNDERLYING_WARNING(MK_PROPERTY(strings), e, @"Could not load CString at offset %" MK_VM_PRIiOFFSET ".", offset);
-            break;
-        }
-        
-        [strings setObject:string forKey:@(offset)];
-        [string release];
-        
-        // Safe.  All string nodes must be within the size of this node.
-        offset += string.nodeSize;
+    mk_vm_size_t copied = [self.memoryMap copyBytesAtOffset:0 fromAddress:self.nodeContextAddress into:stringData.mutableBytes length:self.nodeSize requireFull:NO error:&e];
+    if (copied < self.nodeSize) {
+        MK_PUSH_UNDERLYING_WARNING(strings, e, @"String table truncated after %" MK_VM_PRIiSIZE " bytes.", copied);
+        stringData.length = (NSUInteger)copied + 1;
+        ((uint8_t*)stringData.mutableBytes)[copied] = '\0';
     }
     
-    _strings = [strings copy];
-    [strings release];
+    _stringData = stringData;
     
     return self;
 }
@@ -107,10 +98,111 @@
 //|++++++++++++++++++++++++++++++++++++|//
 - (void)dealloc
 {
+    [_stringCache release];
     [_strings release];
+    [_stringData release];
     [super dealloc];
 }
 
+//◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
+#pragma mark - Looking Up Strings
+//◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
+
+@synthesize cacheLimit = _cacheLimit;
+
+//|++++++++++++++++++++++++++++++++++++|//
+- (const char*)cStringAtOffset:(uint32_t)offset length:(size_t*)length
+{
+    // _stringData is one byte longer than the string table.
+    NSUInteger tableLength = _stringData.length ? _stringData.length - 1 : 0;
+    if (offset >= tableLength)
+        return NULL;
+    
+    const char *string = (const char*)_stringData.bytes + offset;
+    if (length)
+        *length = strlen(string);
+    
+    return string;
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+- (MKCString*)stringAtOffset:(uint32_t)offset
+{
+    if ([self cStringAtOffset:offset length:NULL] == NULL)
+        return nil;
+    
+    NSCache *cache = nil;
+    @synchronized (self) {
+        cache = [[_stringCache retain] autorelease];
+    }
+    
+    MKCString *string = [cache objectForKey:@(offset)];
+    if (string)
+        return string;
+    
+    NSError *e = nil;
+    string = [[[MKCString alloc] initWithOffset:offset fromParent:self error:&e] autorelease];
+    if (string == nil) {
+        MK_PUSH_UNDERLYING_WARNING(strings, e, @"Could not load CString at offset %" PRIu32 ".", offset);
+        return nil;
+    }
+    
+    [cache setObject:string forKey:@(offset)];
+    return string;
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+- (void)setCacheLimit:(NSUInteger)cacheLimit
+{
+    @synchronized (self) {
+        _cacheLimit = cacheLimit;
+        
+        if (cacheLimit == 0) {
+            [_stringCache release];
+            _stringCache = nil;
+            return;
+        }
+        
+        if (_stringCache == nil)
+            _stringCache = [[NSCache alloc] init];
+        _stringCache.countLimit = cacheLimit;
+    }
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+- (NSDictionary*)strings
+{
+    @synchronized (self) {
+        if (_strings || _stringData == nil)
+            return [[_strings retain] autorelease];
+        
+        NSMutableDictionary *strings = [[NSMutableDictionary alloc] init];
+        NSUInteger tableLength = _stringData.length - 1;
+        uint32_t offset = 0;
+        
+        while (offset < tableLength)
+        {
+            NSError *e = nil;
+            MKCString *string = [[MKCString alloc] initWithOffset:offset fromParent:self error:&e];
+            if (string == nil) {
+                MK_PUSH_UNDERLYING_WARNING(strings, e, @"Could not load CString at offset %" PRIu32 ".", offset);
+                break;
+            }
+            
+            [strings setObject:string forKey:@(offset)];
+            [string release];
+            
+            // Safe.  All string nodes must be within the size of this node.
+            offset += (uint32_t)string.nodeSize;
+        }
+        
+        _strings = [strings copy];
+        [strings release];
+        
+        return [[_strings retain] autorelease];
+    }
+}
+
 //◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
 #pragma mark - MKNode
 //◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
@@ -31,6 +31,8 @@
 #import <MachOKit/MKLinkEditNode.h>
 
 @class MKMachOImage;
+@class MKSymbol;
+@class _MKLazySymbolStorage;
 
 //----------------------------------------------------------------------------//
 //! The \c MKSymbolTable class parses the link-edit symbol table, building
@@ -40,10 +42,12 @@
 //
 @interface MKSymbolTable : MKLinkEditNode {
 @package
-    NSArray *_symbols;
+    _MKLazySymbolStorage *_symbolStorage;
     NSRange _localSymbols;
     NSRange _externalSymbols;
     NSRange _undefinedSymbols;
+    NSMutableData *_addressIndexStorage;
+    mk_symbol_address_index_t _addressIndex;
 }
 
 //! Initializes the receiver with the provided \ref MKMachOImage.
@@ -52,8 +56,32 @@
 //! An array of \ref MKSymbol instances, each representing an entry in the
 //! symbol table.  The order of this array matches the ordering of the
 //! symbol structures in the Mach-O image.
+//!
+//! Each \ref MKSymbol is instantiated the first time it is accessed from
+//! this array.  Enumerating the array instantiates every symbol.  An entry
+//! which could not be loaded is represented by \c NSNull, and a warning is
+//! pushed on the receiver.  The array retains the receiver.
 @property (nonatomic, readonly) NSArray /*MKSymbol*/ *symbols;
 
+//! The number of entries in the symbol table.  Equivalent to
+//! \c symbols.count.
+@property (nonatomic, readonly) NSUInteger symbolCount;
+
+//! Returns the symbol at \a index in the symbol table, or \c nil if
+//! \a index is beyond the end of the symbol table or the symbol could not
+//! be loaded.
+- (MKSymbol*)symbolAtIndex:(NSUInteger)index;
+
+//! Returns the symbol defined in a section which contains \a address, or
+//! \c nil if there is no such symbol.  \a address is in the unslid address
+//! space of the image, like the \c value of each \ref MKSymbol.  The extent
+//! of a symbol is inferred from the start of the next symbol, or the end of
+//! its section.
+//!
+//! An index of the symbol addresses is built the first time this method
+//! is called.  Subsequent lookups are a binary search of that index.
+- (MKSymbol*)symbolContainingAddress:(mk_vm_address_t)address;
+
 //! The range of indexes in the \ref symbols array which correspond to
 //! local symbols.  These symbols are typically included for debugging.
 @property (nonatomic, readonly) NSRange localSymbols;
@@ -31,6 +31,9 @@
 #import "MKLCSymtab.h"
 #import "MKLCDysymtab.h"
 #import "MKSymbol.h"
+#import "MKMachO+Segments.h"
+#import "MKSection.h"
+#import "_MKLazySymbolArray.h"
 
 #include <mach-o/nlist.h>
 #include <mach-o/stab.h>
@@ -38,7 +41,6 @@
 //----------------------------------------------------------------------------//
 @implementation MKSymbolTable
 
-@synthesize symbols = _symbols;
 @synthesize localSymbols = _localSymbols;
 @synthesize externalSymbols = _externalSymbols;
 @synthesize undefinedSymbols = _undefinedSymbols;
@@ -75,32 +77,21 @@
     
     // Load Symbols
     {
-        NSMutableArray *symbols = [[NSMutableArray alloc] init];
-        mk_vm_offset_t offset = 0;
+        size_t nlistSize = (self.dataModel.pointerSize == 8) ? sizeof(struct nlist_64) : sizeof(struct nlist);
+        // Cast to size_t is safe; nodeSize can't be larger than UINT32_MAX.
+        NSMutableData *nlistData = [[NSMutableData alloc] initWithLength:(NSUInteger)self.nodeSize];
+        NSError *e = nil;
         
-        // Cast to mk_vm_size_t is safe; nodeSize can't be larger than UINT32_MAX.
-        while ((mk_vm_size_t)offset < self.nodeSize)
-        {
-            NSError *e = nil;
-            MKSymbol *symbol = [MKSymbol symbolWithOffset:offset fromParent:self error:&e];
-            
-            // If we failed, try creating a regular MKsymbol.
-            if (symbol == nil)
-                symbol = [[[MKSymbol alloc] initWithOffset:offset fromParent:self error:&e] autorelease];
-            
-            if (symbol == nil) {
-                MK_PUSH_UNDERLYING_WARNING(MK_PROPERTY(pointers), e, @"Could not load symbol at offset %" MK_VM_PRIiOFFSET ".", offset);
-                break;
-            }
-            
-            [symbols addObject:symbol];
-            
-            // Safe.  All symbol nodes must be within the size of this node.
-            offset += symbol.nodeSize;
-        }
+        // Copy the raw nlist entries once.  Symbols are instantiated from
+        // this copy as they are accessed.
+        mk_vm_size_t copied = [self.memoryMap copyBytesAtOffset:0 fromAddress:self.nodeContextAddress into:nlistData.mutableBytes length:self.nodeSize requireFull:NO error:&e];
+        NSUInteger count = (NSUInteger)(copied / nlistSize);
+        
+        if (copied < self.nodeSize)
+            MK_PUSH_UNDERLYING_WARNING(symbols, e, @"Could not load symbol at offset %" MK_VM_PRIiOFFSET ".", (mk_vm_offset_t)(count * nlistSize));
         
-        _symbols = [symbols copy];
-        [symbols release];
+        _symbolStorage = [[_MKLazySymbolStorage alloc] initWithDataModel:self.dataModel nlistData:nlistData nlistSize:nlistSize count:count];
+        [nlistData release];
     }
     
     return self;
@@ -144,10 +135,90 @@
 //|++++++++++++++++++++++++++++++++++++|//
 - (void)dealloc
 {
-    [_symbols release];
+    [_addressIndexStorage release];
+    [_symbolStorage release];
     [super dealloc];
 }
 
+//◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
+#pragma mark - Accessing Symbols
+//◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
+
+//|++++++++++++++++++++++++++++++++++++|//
+- (NSArray*)symbols
+{
+    if (_symbolStorage == nil)
+        return nil;
+    return [[[_MKLazySymbolArray alloc] initWithSymbolTable:self storage:_symbolStorage] autorelease];
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+- (NSUInteger)symbolCount
+{ return _symbolStorage.count; }
+
+//|++++++++++++++++++++++++++++++++++++|//
+- (MKSymbol*)symbolAtIndex:(NSUInteger)index
+{
+    if (index >= _symbolStorage.count)
+        return nil;
+    
+    id symbol = [_symbolStorage symbolAtIndex:index inSymbolTable:self];
+    return [symbol isKindOfClass:MKSymbol.class] ? symbol : nil;
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+- (BOOL)_buildAddressIndex
+{
+    _MKLazySymbolStorage *symbols = _symbolStorage;
+    MKMachOImage *image = self.macho;
+    
+    // Section numbers in the nlist n_sect field start at 1.  Sections that
+    // failed to parse are left empty.
+    NSDictionary *sectionsByIndex = image.sections;
+    uint32_t sectionCount = 0;
+    mk_vm_range_t sections[MAX_SECT];
+    
+    for (NSNumber *index in sectionsByIndex) {
+        if (index.unsignedIntValue >= MAX_SECT)
+            continue;
+        sectionCount = MAX(sectionCount, index.unsignedIntValue + 1);
+    }
+    for (uint32_t i = 0; i < sectionCount; i++) {
+        MKSection *section = sectionsByIndex[@(i)];
+        sections[i] = section ? mk_vm_range_make(section.vmAddress, section.size) : mk_vm_range_make(0, 0);
+    }
+    
+    // Cast is safe; the symbol count was derived from a uint32_t.
+    uint32_t count = (uint32_t)symbols.count;
+    NSMutableData *storage = [[NSMutableData alloc] initWithLength:mk_symbol_address_index_storage_size(count)];
+    
+    mk_error_t err = mk_symbol_address_index_init_with_nlists(symbols.nlistData.bytes, count, (self.dataModel.pointerSize == 8), self.dataModel.byteOrder, 0, sections, sectionCount, storage.mutableBytes, storage.length, &_addressIndex);
+    if (err != MK_ESUCCESS) {
+        [storage release];
+        MK_PUSH_WARNING(symbols, err, @"Could not build the symbol address index.");
+        return NO;
+    }
+    
+    _addressIndexStorage = storage;
+    return YES;
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+- (MKSymbol*)symbolContainingAddress:(mk_vm_address_t)address
+{
+    uint32_t index;
+    
+    @synchronized (self) {
+        if (_addressIndexStorage == nil && [self _buildAddressIndex] == NO)
+            return nil;
+        
+        if (mk_symbol_address_index_find(&_addressIndex, address, &index, NULL).any == NULL)
+            return nil;
+    }
+    
+    return [self symbolAtIndex:index];
+}
+
 //◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
 #pragma mark - MKNode
 //◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
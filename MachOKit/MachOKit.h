@@ -102,4 +102,6 @@
 #import <MachOKit/MKIndirectSymbolTable.h>
     #import <MachOKit/MKIndirectSymbol.h>
 
+#import <MachOKit/MKImageScanner.h>
+
 #endif /* _MachOKit_H */
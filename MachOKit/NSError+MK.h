@@ -38,15 +38,21 @@
 //!
 //!     MK_PUSH_WARNING(someProperty, MK_EINVALID_DATA, @"Invalid data!")
 //!
+//! The description is formatted when the warnings of the node are next
+//! read, not when the warning is pushed.  The format arguments are captured
+//! by a block until then.  Do not pass \c self, an instance variable, or
+//! an object which retains the node as an argument; evaluate it into a local
+//! variable first.
+//!
 //! @note
 //! May only be used within the context of an \ref MKNode or subclass.
 #define MK_PUSH_WARNING(PROPERTY, CODE, ...) \
-    self.warnings = [self.warnings arrayByAddingObject:[NSError mk_errorWithDomain:MKErrorDomain code:CODE property:MK_PROPERTY(PROPERTY) description:__VA_ARGS__]]
+    [self pushWarningWithCode:CODE property:MK_PROPERTY(PROPERTY) underlyingError:nil descriptionBlock:^NSString* { return [NSString stringWithFormat:__VA_ARGS__]; }]
 
 //! Similar to \ref MK_PUSH_WARNING but includes an extra parameter to specify
 //! the underlying error that triggered the warning.
 #define MK_PUSH_UNDERLYING_WARNING(PROPERTY, UNDERLYING_ERROR, ...) \
-    self.warnings = [self.warnings arrayByAddingObject:[NSError mk_errorWithDomain:MKErrorDomain code:[UNDERLYING_ERROR code] property:MK_PROPERTY(PROPERTY) underlyingError:UNDERLYING_ERROR description:__VA_ARGS__]]
+    [self pushWarningWithCode:[UNDERLYING_ERROR code] property:MK_PROPERTY(PROPERTY) underlyingError:UNDERLYING_ERROR descriptionBlock:^NSString* { return [NSString stringWithFormat:__VA_ARGS__]; }]
 
 //----------------------------------------------------------------------------//
 
@@ -139,6 +139,9 @@ typedef NS_OPTIONS(uint32_t, MKSectionAttributes) {
     uint32_t _flags;
 }
 
+//! Returns a score ranking the receiving class' ability to parse the
+//! section.  The subclass chosen for a section is cached by its section
+//! type, so rankings should not depend on anything else.
 + (uint32_t)canInstantiateWithSectionLoadCommand:(id<MKLCSection>)sectionLoadCommand inSegment:(MKSegment*)segment;
 
 + (Class)classForSectionLoadCommand:(id<MKLCSection>)sectionLoadCommand inSegment:(MKSegment*)segment;
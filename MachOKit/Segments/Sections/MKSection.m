@@ -49,6 +49,14 @@
 + (id*)_subclassesCache
 { static __weak NSSet *subclasses; return &subclasses; }
 
+//|++++++++++++++++++++++++++++++++++++|//
++ (MKNodeSubclassCache*)_subclassLookupCache
+{
+    static MKNodeSubclassCache cache;
+    // Subclasses rank their own subclasses.
+    return (self == MKSection.class) ? &cache : NULL;
+}
+
 //|++++++++++++++++++++++++++++++++++++|//
 + (uint32_t)canInstantiateWithSectionLoadCommand:(id<MKLCSection>)sectionLoadCommand inSegment:(MKSegment*)segment
 {
@@ -61,8 +69,11 @@
 //|++++++++++++++++++++++++++++++++++++|//
 + (Class)classForSectionLoadCommand:(id<MKLCSection>)sectionLoadCommand inSegment:(MKSegment*)segment;
 {
-    return [self bestSubclassWithRanking:^uint32_t(Class cls) {
-        return [cls canInstantiateWithSectionLoadCommand:sectionLoadCommand inSegment:segment];
+    // Subclasses are ranked once for each section type.
+    return [self subclassForDiscriminator:([sectionLoadCommand flags] & SECTION_TYPE) lookup:^{
+        return [self bestSubclassWithRanking:^uint32_t(Class cls) {
+            return [cls canInstantiateWithSectionLoadCommand:sectionLoadCommand inSegment:segment];
+        }];
     }];
 }
 
@@ -110,7 +121,9 @@
     // zero-fill memory of its enclosing segment and has no corresponding
     // memory in the file.
     if (!(sectionLoadCommand.flags & S_ZEROFILL) && (err = mk_vm_range_contains_range(mk_vm_range_make(segment.fileOffset, segment.fileSize), mk_vm_range_make(_fileOffset, _size), false))) {
-        MK_PUSH_WARNING(MK_PROPERTY(fileOffset), MK_ENOT_FOUND, @"File offset %" MK_VM_PRIxADDR " is not within segment %@", _fileOffset, segment);
+        mk_vm_address_t fileOffset = _fileOffset;
+        NSString *segmentName = segment.name;
+        MK_PUSH_WARNING(MK_PROPERTY(fileOffset), MK_ENOT_FOUND, @"File offset %" MK_VM_PRIxADDR " is not within segment %@", fileOffset, segmentName);
     }
     
     // Determine the context address of this section.
@@ -155,7 +168,8 @@
     // Emit a warning if the segname of the section load command does not match
     // our parent segment.
     if ([[sectionLoadCommand segname] isEqualToString:segment.name] == NO) {
-        MK_PUSH_WARNING(MK_PROPERTY(name), MK_EINVALID_DATA, @"Segment name for section %@ does not match parent segment %@", sectionLoadCommand, segment);
+        NSString *segmentName = segment.name;
+        MK_PUSH_WARNING(MK_PROPERTY(name), MK_EINVALID_DATA, @"Segment name for section %@ does not match parent segment %@", sectionLoadCommand, segmentName);
     }
     
     return self;
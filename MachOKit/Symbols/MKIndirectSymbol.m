@@ -54,12 +54,12 @@
     }
     
     // Lookup the symbol referenced by the index.
-    MKSymbolTable *symbolTable = image.symbolTable;
-    if (_index < symbolTable.symbols.count)
-        _target = [symbolTable.symbols[_index] retain];
+    _target = [[image.symbolTable symbolAtIndex:_index] retain];
     
-    if (_target == nil)
-        MK_PUSH_WARNING(target, MK_ENOT_FOUND, @"Failed to load symbol for index %" PRIi32 "", _index);
+    if (_target == nil) {
+        uint32_t index = _index;
+        MK_PUSH_WARNING(target, MK_ENOT_FOUND, @"Failed to load symbol for index %" PRIi32 "", index);
+    }
     
     return self;
 }
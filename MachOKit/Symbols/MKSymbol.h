@@ -56,6 +56,10 @@
 //! ability to parse the symbol.
 + (Class)classForSymbolWithOffset:(mk_vm_offset_t)offset fromParent:(MKBackedNode*)parent error:(NSError**)error;
 
+//! Searches the subclasses of \ref MKSymbol for a class that can parse
+//! the symbol described by \a nlist, which has already been byte swapped.
++ (Class)classForSymbolWithNList:(struct nlist_64)nlist fromParent:(MKBackedNode*)parent;
+
 //◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
 #pragma mark -  Subclassing MKSymbol
 //! @name       Subclassing MKSymbol
@@ -77,6 +81,9 @@
 //! @return
 //! A score ranking the receiving class' ability to parse the symbol described
 //! by \c nlist.
+//!
+//! The subclass chosen for a symbol is cached by its \c n_type.  Rankings
+//! should not depend on the other fields of \a nlist.
 + (uint32_t)canInstantiateWithNList:(struct nlist_64)nlist parent:(MKBackedNode*)parent;
 
 
@@ -89,6 +96,11 @@
 //! \a offset from the \a parent symbol table.
 + (instancetype)symbolWithOffset:(mk_vm_offset_t)offset fromParent:(MKBackedNode*)parent error:(NSError**)error;
 
+//! Initializes the receiver with the symbol at \a offset from the \a parent
+//! symbol table, which has already been read and byte swapped into
+//! \a nlist.  Use this to avoid reading the entry from the memory map again.
+- (instancetype)initWithNList:(const struct nlist_64*)nlist offset:(mk_vm_offset_t)offset fromParent:(MKBackedNode*)parent error:(NSError**)error;
+
 
 //◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
 #pragma mark -  Acessing Symbol Metadata
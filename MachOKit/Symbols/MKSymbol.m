@@ -39,6 +39,14 @@
 + (id*)_subclassesCache
 { static __weak NSSet *subclasses; return &subclasses; }
 
+//|++++++++++++++++++++++++++++++++++++|//
++ (MKNodeSubclassCache*)_subclassLookupCache
+{
+    static MKNodeSubclassCache cache;
+    // Subclasses rank their own subclasses.
+    return (self == MKSymbol.class) ? &cache : NULL;
+}
+
 //|++++++++++++++++++++++++++++++++++++|//
 + (uint32_t)canInstantiateWithNList:(struct nlist_64)nlist parent:(MKBackedNode*)parent
 {
@@ -55,8 +63,17 @@
     if (!ReadNList(&entry, offset, parent, error))
     { return nil; }
     
-    return [self bestSubclassWithRanking:^uint32_t(Class cls) {
-        return [cls canInstantiateWithNList:entry parent:parent];
+    return [self classForSymbolWithNList:entry fromParent:parent];
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
++ (Class)classForSymbolWithNList:(struct nlist_64)nlist fromParent:(MKBackedNode*)parent
+{
+    // Subclasses are ranked once for each symbol type.
+    return [self subclassForDiscriminator:nlist.n_type lookup:^{
+        return [self bestSubclassWithRanking:^uint32_t(Class cls) {
+            return [cls canInstantiateWithNList:nlist parent:parent];
+        }];
     }];
 }
 
@@ -102,27 +119,40 @@ bool ReadNList(struct nlist_64 *result, mk_vm_offset_t offset, MKBackedNode *par
 //|++++++++++++++++++++++++++++++++++++|//
 + (instancetype)symbolWithOffset:(mk_vm_offset_t)offset fromParent:(MKBackedNode*)parent error:(NSError**)error
 {
-    Class symbolClass = [self classForSymbolWithOffset:offset fromParent:parent error:error];
+    // Read the entry once, for both ranking and initialization.
+    struct nlist_64 entry;
+    if (!ReadNList(&entry, offset, parent, error))
+    { return nil; }
+    
+    Class symbolClass = [self classForSymbolWithNList:entry fromParent:parent];
     NSAssert(symbolClass, @"");
     
-    return [[[symbolClass alloc] initWithOffset:offset fromParent:parent error:error] autorelease];
+    return [[[symbolClass alloc] initWithNList:&entry offset:offset fromParent:parent error:error] autorelease];
 }
 
 //|++++++++++++++++++++++++++++++++++++|//
 - (instancetype)initWithOffset:(mk_vm_offset_t)offset fromParent:(MKBackedNode*)parent error:(NSError**)error
 {
-    self = [super initWithOffset:offset fromParent:parent error:error];
-    if (self == nil) return nil;
-    
     struct nlist_64 entry;
     if (!ReadNList(&entry, offset, parent, error))
     { [self release]; return nil; }
     
-    _strx = entry.n_un.n_strx;
-    _type = entry.n_type;
-    _sect = entry.n_sect;
-    _desc = entry.n_desc;
-    _value = entry.n_value;
+    return [self initWithNList:&entry offset:offset fromParent:parent error:error];
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+- (instancetype)initWithNList:(const struct nlist_64*)nlist offset:(mk_vm_offset_t)offset fromParent:(MKBackedNode*)parent error:(NSError**)error
+{
+    NSParameterAssert(nlist);
+    
+    self = [super initWithOffset:offset fromParent:parent error:error];
+    if (self == nil) return nil;
+    
+    _strx = nlist->n_un.n_strx;
+    _type = nlist->n_type;
+    _sect = nlist->n_sect;
+    _desc = nlist->n_desc;
+    _value = nlist->n_value;
     
     MKMachOImage *image = self.macho;
     
@@ -134,13 +164,15 @@ bool ReadNList(struct nlist_64 *result, mk_vm_offset_t offset, MKBackedNode *par
     {
         MKStringTable *stringTable = image.stringTable;
         if (stringTable == nil) {
-            MK_PUSH_WARNING(name, MK_ENOT_FOUND, @"Mach-O image %@ does not have a string table.", image);
+            NSString *imageName = image.name;
+            MK_PUSH_WARNING(name, MK_ENOT_FOUND, @"Mach-O image %@ does not have a string table.", imageName);
             break;
         }
         
-        MKCString *string = stringTable.strings[@(_strx)];
+        MKCString *string = [stringTable stringAtOffset:_strx];
         if (string == nil) {
-            MK_PUSH_WARNING(name, MK_ENOT_FOUND, @"String table does not have an entry for index %" PRIi32 "", _strx);
+            uint32_t strx = _strx;
+            MK_PUSH_WARNING(name, MK_ENOT_FOUND, @"String table does not have an entry for index %" PRIi32 "", strx);
             break;
         }
         
@@ -38,4 +38,7 @@
 
 - (instancetype)initWithURL:(NSURL*)fileURL error:(NSError**)error;
 
+//! The file which was mapped.
+@property (nonatomic, readonly) NSURL *fileURL;
+
 @end
@@ -31,6 +31,8 @@
 //----------------------------------------------------------------------------//
 @implementation _MKFileMemoryMap
 
+@synthesize fileURL = _fileURL;
+
 //|++++++++++++++++++++++++++++++++++++|//
 - (instancetype)initWithURL:(NSURL*)fileURL error:(NSError**)error
 {
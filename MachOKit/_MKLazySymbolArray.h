@@ -0,0 +1,106 @@
+//----------------------------------------------------------------------------//
+//|
+//|             MachOKit - A Lightweight Mach-O Parsing Library
+//! @file       _MKLazySymbolArray.h
+//!
+//! @author     D.V.
+//! @copyright  Copyright (c) 2014-2015 D.V. All rights reserved.
+//|
+//| Permission is hereby granted, free of charge, to any person obtaining a
+//| copy of this software and associated documentation files (the "Software"),
+//| to deal in the Software without restriction, including without limitation
+//| the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//| and/or sell copies of the Software, and to permit persons to whom the
+//| Software is furnished to do so, subject to the following conditions:
+//|
+//| The above copyright notice and this permission notice shall be included
+//| in all copies or substantial portions of the Software.
+//|
+//| THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+//| OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+//| MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+//| IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+//| CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+//| TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//| SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//----------------------------------------------------------------------------//
+
+
+#include <MachOKit/macho.h>
+@import Foundation;
+
+@class MKSymbolTable;
+@class MKSymbol;
+@class MKDataModel;
+
+//----------------------------------------------------------------------------//
+//! The symbols of an \ref MKSymbolTable.  The nlist entries are copied out
+//! of the memory map once, when the storage is created, and each
+//! \ref MKSymbol is instantiated from the copy the first time it is
+//! accessed.  Instantiated symbols are retained for the lifetime of the
+//! storage.
+//!
+//! The storage is owned by the symbol table, and does not reference it.
+//! The symbol table is passed to each method which may instantiate a symbol.
+//!
+//! If the subclass of \ref MKSymbol selected for an entry can not be
+//! instantiated, a plain \ref MKSymbol is created instead.  If that also
+//! fails, a warning is pushed on the symbol table and the entry is
+//! represented by \c NSNull.
+//
+@interface _MKLazySymbolStorage : NSObject {
+    MKDataModel *_dataModel;
+    NSData *_nlistData;
+    size_t _nlistSize;
+    NSUInteger _count;
+    id __unsafe_unretained *_symbols;
+}
+
+//! Initializes the storage with \a count nlist entries, each \a nlistSize
+//! bytes, from \a nlistData.
+- (instancetype)initWithDataModel:(MKDataModel*)dataModel nlistData:(NSData*)nlistData nlistSize:(size_t)nlistSize count:(NSUInteger)count;
+
+//! The number of nlist entries.
+@property (nonatomic, readonly) NSUInteger count;
+
+//! The raw, unswapped, nlist entries.
+@property (nonatomic, readonly) NSData *nlistData;
+
+//! Returns the symbol at \a index, instantiating it as a child of
+//! \a symbolTable if this is the first time it has been accessed.  Never
+//! returns \c nil.  Raises an \c NSRangeException if \a index is beyond
+//! the end of the storage.
+- (id)symbolAtIndex:(NSUInteger)index inSymbolTable:(MKSymbolTable*)symbolTable;
+
+//! Instantiates every symbol in \a range as a child of \a symbolTable,
+//! and returns the symbols.  The returned buffer remains valid for the
+//! lifetime of the storage.
+- (id __unsafe_unretained *)symbolsInRange:(NSRange)range inSymbolTable:(MKSymbolTable*)symbolTable;
+
+//! Copies the byte swapped nlist entry at \a index into \a nlist.
+- (void)getNList:(struct nlist_64*)nlist atIndex:(NSUInteger)index;
+
+//! Copies the byte swapped nlist entries in \a range into \a nlists, which
+//! must have room for \a range.length entries.
+- (void)getNLists:(struct nlist_64*)nlists range:(NSRange)range;
+
+@end
+
+
+
+//----------------------------------------------------------------------------//
+//! An immutable array of the symbols in an \ref MKSymbolTable, backed by
+//! the table's \ref _MKLazySymbolStorage.  The array retains the symbol
+//! table, and its count is fixed when it is created.
+//
+@interface _MKLazySymbolArray : NSArray {
+    MKSymbolTable *_symbolTable;
+    _MKLazySymbolStorage *_storage;
+    NSUInteger _count;
+}
+
+//! Initializes the array with the symbols in \a storage, which must be
+//! owned by \a symbolTable.
+- (instancetype)initWithSymbolTable:(MKSymbolTable*)symbolTable storage:(_MKLazySymbolStorage*)storage;
+
+@end
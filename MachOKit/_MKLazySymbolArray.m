@@ -0,0 +1,274 @@
+//----------------------------------------------------------------------------//
+//|
+//|             MachOKit - A Lightweight Mach-O Parsing Library
+//|             _MKLazySymbolArray.m
+//|
+//|             D.V.
+//|             Copyright (c) 2014-2015 D.V. All rights reserved.
+//|
+//| Permission is hereby granted, free of charge, to any person obtaining a
+//| copy of this software and associated documentation files (the "Software"),
+//| to deal in the Software without restriction, including without limitation
+//| the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//| and/or sell copies of the Software, and to permit persons to whom the
+//| Software is furnished to do so, subject to the following conditions:
+//|
+//| The above copyright notice and this permission notice shall be included
+//| in all copies or substantial portions of the Software.
+//|
+//| THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+//| OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+//| MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+//| IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+//| CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+//| TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//| SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//----------------------------------------------------------------------------//
+
+
+#import "_MKLazySymbolArray.h"
+#import "MKSymbolTable.h"
+#import "MKSymbol.h"
+#import "MKMachO.h"
+#import "MKDataModel.h"
+#import "NSError+MK.h"
+
+#include <mach-o/nlist.h>
+
+//----------------------------------------------------------------------------//
+@implementation _MKLazySymbolStorage
+
+@synthesize count = _count;
+@synthesize nlistData = _nlistData;
+
+//|++++++++++++++++++++++++++++++++++++|//
+- (instancetype)initWithDataModel:(MKDataModel*)dataModel nlistData:(NSData*)nlistData nlistSize:(size_t)nlistSize count:(NSUInteger)count
+{
+    NSParameterAssert(dataModel);
+    NSParameterAssert(nlistData.length >= nlistSize * count);
+    
+    self = [super init];
+    if (self == nil) return nil;
+    
+    _dataModel = [dataModel retain];
+    _nlistData = [nlistData retain];
+    _nlistSize = nlistSize;
+    _count = count;
+    _symbols = (id __unsafe_unretained *)calloc(count ?: 1, sizeof(*_symbols));
+    
+    return self;
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+- (void)dealloc
+{
+    for (NSUInteger i = 0; i < _count; i++)
+        [_symbols[i] release];
+    free(_symbols);
+    
+    [_nlistData release];
+    [_dataModel release];
+    
+    [super dealloc];
+}
+
+//◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
+#pragma mark - Accessing Symbols
+//◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
+
+//|++++++++++++++++++++++++++++++++++++|//
+- (void)getNLists:(struct nlist_64*)nlists range:(NSRange)range
+{
+    if (range.location > _count || range.length > _count - range.location)
+        @throw [NSException exceptionWithName:NSRangeException reason:[NSString stringWithFormat:@"Range %@ is beyond bounds [0 .. %lu]", NSStringFromRange(range), (unsigned long)_count] userInfo:nil];
+    
+    const mk_byteorder_t *byteOrder = _dataModel.byteOrder;
+    const uint8_t *bytes = (const uint8_t*)_nlistData.bytes + range.location * _nlistSize;
+    
+    if (_nlistSize == sizeof(struct nlist_64))
+    {
+        for (NSUInteger i = 0; i < range.length; i++, bytes += sizeof(struct nlist_64))
+        {
+            struct nlist_64 entry;
+            memcpy(&entry, bytes, sizeof(entry));
+            
+            nlists[i].n_un.n_strx = mk_byteorder_swap32(byteOrder, entry.n_un.n_strx);
+            nlists[i].n_type = entry.n_type;
+            nlists[i].n_sect = entry.n_sect;
+            nlists[i].n_desc = mk_byteorder_swap16(byteOrder, entry.n_desc);
+            nlists[i].n_value = mk_byteorder_swap64(byteOrder, entry.n_value);
+        }
+    }
+    else
+    {
+        for (NSUInteger i = 0; i < range.length; i++, bytes += sizeof(struct nlist))
+        {
+            struct nlist entry;
+            memcpy(&entry, bytes, sizeof(entry));
+            
+            nlists[i].n_un.n_strx = mk_byteorder_swap32(byteOrder, entry.n_un.n_strx);
+            nlists[i].n_type = entry.n_type;
+            nlists[i].n_sect = entry.n_sect;
+            nlists[i].n_desc = mk_byteorder_swap16(byteOrder, entry.n_desc);
+            nlists[i].n_value = (uint64_t)mk_byteorder_swap32(byteOrder, entry.n_value);
+        }
+    }
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+- (void)getNList:(struct nlist_64*)nlist atIndex:(NSUInteger)index
+{
+    if (index >= _count)
+        @throw [NSException exceptionWithName:NSRangeException reason:[NSString stringWithFormat:@"Index %lu is beyond bounds [0 .. %lu]", (unsigned long)index, (unsigned long)_count] userInfo:nil];
+    
+    [self getNLists:nlist range:NSMakeRange(index, 1)];
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+- (id)_symbolAtIndex:(NSUInteger)index withNList:(const struct nlist_64*)entry inSymbolTable:(MKSymbolTable*)symbolTable
+{
+    Class symbolClass = [MKSymbol classForSymbolWithNList:*entry fromParent:symbolTable];
+    
+    // Safe.  index * _nlistSize is within the size of the symbol table.
+    mk_vm_offset_t offset = (mk_vm_offset_t)(index * _nlistSize);
+    NSError *e = nil;
+    
+    // The entry has already been decoded.  Don't read it from the memory
+    // map again.
+    id symbol = [[symbolClass alloc] initWithNList:entry offset:offset fromParent:symbolTable error:&e];
+    // If we failed, try creating a regular MKSymbol.
+    if (symbol == nil)
+        symbol = [[MKSymbol alloc] initWithNList:entry offset:offset fromParent:symbolTable error:&e];
+    // The count of the symbols is fixed, so the slot still needs an object.
+    if (symbol == nil) {
+        [symbolTable pushWarningWithCode:e.code property:MK_PROPERTY(symbols) underlyingError:e description:[NSString stringWithFormat:@"Could not load symbol at offset %" MK_VM_PRIiOFFSET ".", offset]];
+        symbol = [[NSNull null] retain];
+    }
+    
+    // Another thread may have instantiated the same symbol.  Keep whichever
+    // was stored first.
+    if (!__sync_bool_compare_and_swap(&_symbols[index], nil, symbol)) {
+        [symbol release];
+        symbol = _symbols[index];
+    }
+    
+    return symbol;
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+- (id)symbolAtIndex:(NSUInteger)index inSymbolTable:(MKSymbolTable*)symbolTable
+{
+    if (index >= _count)
+        @throw [NSException exceptionWithName:NSRangeException reason:[NSString stringWithFormat:@"Index %lu is beyond bounds [0 .. %lu]", (unsigned long)index, (unsigned long)_count] userInfo:nil];
+    
+    id symbol = _symbols[index];
+    if (symbol)
+        return symbol;
+    
+    struct nlist_64 entry;
+    [self getNLists:&entry range:NSMakeRange(index, 1)];
+    
+    return [self _symbolAtIndex:index withNList:&entry inSymbolTable:symbolTable];
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+- (id __unsafe_unretained *)symbolsInRange:(NSRange)range inSymbolTable:(MKSymbolTable*)symbolTable
+{
+    // Decode the entries a batch at a time, then instantiate any symbols
+    // that have not been accessed yet.
+    struct nlist_64 entries[64];
+    
+    for (NSUInteger done = 0; done < range.length; ) {
+        NSUInteger batch = MIN(range.length - done, (NSUInteger)64);
+        [self getNLists:entries range:NSMakeRange(range.location + done, batch)];
+        
+        for (NSUInteger i = 0; i < batch; i++) {
+            if (_symbols[range.location + done + i] == nil)
+                [self _symbolAtIndex:range.location + done + i withNList:&entries[i] inSymbolTable:symbolTable];
+        }
+        
+        done += batch;
+    }
+    
+    return &_symbols[range.location];
+}
+
+@end
+
+
+
+//----------------------------------------------------------------------------//
+@implementation _MKLazySymbolArray
+
+//|++++++++++++++++++++++++++++++++++++|//
+- (instancetype)initWithSymbolTable:(MKSymbolTable*)symbolTable storage:(_MKLazySymbolStorage*)storage
+{
+    NSParameterAssert(symbolTable);
+    NSParameterAssert(storage);
+    
+    self = [super init];
+    if (self == nil) return nil;
+    
+    // Symbols are instantiated as children of the symbol table, which must
+    // outlive every access through this array.
+    _symbolTable = [symbolTable retain];
+    _storage = [storage retain];
+    _count = storage.count;
+    
+    return self;
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+- (void)dealloc
+{
+    [_storage release];
+    [_symbolTable release];
+    
+    [super dealloc];
+}
+
+//◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
+#pragma mark - NSArray
+//◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
+
+//|++++++++++++++++++++++++++++++++++++|//
+- (NSUInteger)count
+{ return _count; }
+
+//|++++++++++++++++++++++++++++++++++++|//
+- (id)objectAtIndex:(NSUInteger)index
+{ return [_storage symbolAtIndex:index inSymbolTable:_symbolTable]; }
+
+//|++++++++++++++++++++++++++++++++++++|//
+- (NSUInteger)countByEnumeratingWithState:(NSFastEnumerationState*)state objects:(id __unsafe_unretained [])buffer count:(NSUInteger)len
+{
+#pragma unused (buffer)
+    NSUInteger start = (NSUInteger)state->state;
+    if (start >= _count)
+        return 0;
+    
+    // Hand out the instantiated symbols directly from the backing store,
+    // rather than copying them into the caller's buffer.
+    NSUInteger batch = MIN(MIN(MAX(len, (NSUInteger)16), (NSUInteger)64), _count - start);
+    
+    state->state = start + batch;
+    state->itemsPtr = [_storage symbolsInRange:NSMakeRange(start, batch) inSymbolTable:_symbolTable];
+    // The array is never mutated.
+    state->mutationsPtr = (unsigned long*)&_count;
+    
+    return batch;
+}
+
+//◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
+#pragma mark - NSCopying
+//◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
+
+//|++++++++++++++++++++++++++++++++++++|//
+- (id)copyWithZone:(NSZone*)zone
+{
+#pragma unused (zone)
+    // Immutable.
+    return [self retain];
+}
+
+@end
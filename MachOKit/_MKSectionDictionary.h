@@ -0,0 +1,53 @@
+//----------------------------------------------------------------------------//
+//|
+//|             MachOKit - A Lightweight Mach-O Parsing Library
+//! @file       _MKSectionDictionary.h
+//!
+//! @author     D.V.
+//! @copyright  Copyright (c) 2014-2015 D.V. All rights reserved.
+//|
+//| Permission is hereby granted, free of charge, to any person obtaining a
+//| copy of this software and associated documentation files (the "Software"),
+//| to deal in the Software without restriction, including without limitation
+//| the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//| and/or sell copies of the Software, and to permit persons to whom the
+//| Software is furnished to do so, subject to the following conditions:
+//|
+//| The above copyright notice and this permission notice shall be included
+//| in all copies or substantial portions of the Software.
+//|
+//| THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+//| OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+//| MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+//| IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+//| CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+//| TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//| SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//----------------------------------------------------------------------------//
+
+
+#include <MachOKit/macho.h>
+@import Foundation;
+
+@class MKSection;
+
+//----------------------------------------------------------------------------//
+//! A dictionary of the sections in an \ref MKMachOImage, keyed by
+//! \c NSNumber section index, which is backed by a C array indexed by
+//! section number.  Looking up a section is an array access rather than a
+//! hash table probe.
+//
+@interface _MKSectionDictionary : NSDictionary {
+    NSUInteger _capacity;
+    NSUInteger _count;
+    MKSection * __unsafe_unretained *_sections;
+}
+
+//! Initializes the dictionary with \a capacity slots.  The section at
+//! \a indices[i] is \a sections[i].  Indices must be less than \a capacity.
+- (instancetype)initWithSections:(MKSection * const [])sections indices:(const uint32_t [])indices count:(NSUInteger)count capacity:(NSUInteger)capacity;
+
+//! Returns the section at \a index, or \c nil.
+- (MKSection*)sectionAtIndex:(NSUInteger)index;
+
+@end
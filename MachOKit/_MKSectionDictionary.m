@@ -0,0 +1,127 @@
+//----------------------------------------------------------------------------//
+//|
+//|             MachOKit - A Lightweight Mach-O Parsing Library
+//|             _MKSectionDictionary.m
+//|
+//|             D.V.
+//|             Copyright (c) 2014-2015 D.V. All rights reserved.
+//|
+//| Permission is hereby granted, free of charge, to any person obtaining a
+//| copy of this software and associated documentation files (the "Software"),
+//| to deal in the Software without restriction, including without limitation
+//| the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//| and/or sell copies of the Software, and to permit persons to whom the
+//| Software is furnished to do so, subject to the following conditions:
+//|
+//| The above copyright notice and this permission notice shall be included
+//| in all copies or substantial portions of the Software.
+//|
+//| THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+//| OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+//| MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+//| IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+//| CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+//| TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//| SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//----------------------------------------------------------------------------//
+
+#import "_MKSectionDictionary.h"
+#import "MKSection.h"
+
+//----------------------------------------------------------------------------//
+@implementation _MKSectionDictionary
+
+//|++++++++++++++++++++++++++++++++++++|//
+- (instancetype)initWithSections:(MKSection * const [])sections indices:(const uint32_t [])indices count:(NSUInteger)count capacity:(NSUInteger)capacity
+{
+    self = [super init];
+    if (self == nil) return nil;
+    
+    _capacity = capacity;
+    _sections = (MKSection * __unsafe_unretained *)calloc(capacity ?: 1, sizeof(*_sections));
+    
+    for (NSUInteger i = 0; i < count; i++) {
+        NSParameterAssert(indices[i] < capacity);
+        
+        // A later section with the same index replaces an earlier one, as
+        // it would in a mutable dictionary.
+        if (_sections[indices[i]] == nil)
+            _count++;
+        [_sections[indices[i]] release];
+        _sections[indices[i]] = [sections[i] retain];
+    }
+    
+    return self;
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+- (instancetype)init
+{ return [self initWithSections:NULL indices:NULL count:0 capacity:0]; }
+
+//|++++++++++++++++++++++++++++++++++++|//
+- (void)dealloc
+{
+    for (NSUInteger i = 0; i < _capacity; i++)
+        [_sections[i] release];
+    free(_sections);
+    
+    [super dealloc];
+}
+
+//◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
+#pragma mark - Accessing Sections
+//◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
+
+//|++++++++++++++++++++++++++++++++++++|//
+- (MKSection*)sectionAtIndex:(NSUInteger)index
+{ return (index < _capacity) ? _sections[index] : nil; }
+
+//◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
+#pragma mark - NSDictionary
+//◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
+
+//|++++++++++++++++++++++++++++++++++++|//
+- (NSUInteger)count
+{ return _count; }
+
+//|++++++++++++++++++++++++++++++++++++|//
+- (id)objectForKey:(id)key
+{
+    if ([key isKindOfClass:NSNumber.class] == NO)
+        return nil;
+    
+    // Negative values wrap to an index beyond the capacity.  Fractional
+    // values never equal an integer key.
+    NSUInteger index = [key unsignedIntegerValue];
+    if (CFNumberIsFloatType((CFNumberRef)key) && [key doubleValue] != (double)index)
+        return nil;
+    
+    return [self sectionAtIndex:index];
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+- (NSEnumerator*)keyEnumerator
+{
+    NSMutableArray *keys = [NSMutableArray arrayWithCapacity:_count];
+    
+    for (NSUInteger i = 0; i < _capacity; i++) {
+        if (_sections[i])
+            [keys addObject:@(i)];
+    }
+    
+    return keys.objectEnumerator;
+}
+
+//◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
+#pragma mark - NSCopying
+//◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
+
+//|++++++++++++++++++++++++++++++++++++|//
+- (id)copyWithZone:(NSZone*)zone
+{
+#pragma unused (zone)
+    // Immutable.
+    return [self retain];
+}
+
+@end
@@ -66,6 +66,26 @@ SpecBegin(MKFat)
             expect(binary.architectures.count).to.equal([executable.fatHeader[@"architecture"] count]);
         });
         
+        it(@"Should parse every architecture concurrently", ^{
+            NSArray *serial = [binary parseAllArchitecturesConcurrently:NO];
+            NSArray *concurrent = [binary parseAllArchitecturesConcurrently:YES];
+            expect(concurrent).to.haveCountOf(binary.architectures.count);
+            expect(serial).to.haveCountOf(binary.architectures.count);
+            
+            for (NSUInteger i = 0; i < concurrent.count; i++) {
+                MKFatArch *architecture = binary.architectures[i];
+                MKMachOImage *image = concurrent[i];
+                expect(image).to.beKindOf(MKMachOImage.class);
+                if ([image isKindOfClass:MKMachOImage.class] == NO) continue;
+                
+                expect(image.memoryMap).to.beIdenticalTo(binary.memoryMap);
+                expect(image.parent).to.beIdenticalTo(binary);
+                expect(image.name).to.equal(frameworkURL.path);
+                expect(image.header.cputype).to.equal(architecture.cputype);
+                expect(image.loadCommands.count).to.equal([serial[i] loadCommands].count);
+            }
+        });
+        
         for (MKFatArch *architecture in binary.architectures)
         describe(architecture.description, ^{
             // Find the corresponding architecture in fatHeader[@"architecture"].
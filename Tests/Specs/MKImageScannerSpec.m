@@ -0,0 +1,153 @@
+//----------------------------------------------------------------------------//
+//|
+//|             MachOKit - A Lightweight Mach-O Parsing Library
+//|             MKImageScannerSpec.m
+//|
+//|             D.V.
+//|             Copyright (c) 2014-2015 D.V. All rights reserved.
+//|
+//| Permission is hereby granted, free of charge, to any person obtaining a
+//| copy of this software and associated documentation files (the "Software"),
+//| to deal in the Software without restriction, including without limitation
+//| the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//| and/or sell copies of the Software, and to permit persons to whom the
+//| Software is furnished to do so, subject to the following conditions:
+//|
+//| The above copyright notice and this permission notice shall be included
+//| in all copies or substantial portions of the Software.
+//|
+//| THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+//| OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+//| MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+//| IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+//| CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+//| TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//| SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//----------------------------------------------------------------------------//
+
+SpecBegin(MKImageScanner)
+
+describe(@"an image scanner", ^{
+    __block NSArray *frameworks;
+    
+    beforeAll(^{
+        frameworks = [[NSFileManager allExecutableURLs:MKFrameworkTypeAllFrameworks] retain];
+    });
+    
+    afterAll(^{
+        [frameworks release];
+    });
+    
+    it(@"should deliver one result for each file", ^{
+        MKImageScanner *scanner = [[[MKImageScanner alloc] initWithFileURLs:frameworks] autorelease];
+        NSMutableSet *scanned = [NSMutableSet set];
+        __block BOOL inHandler = NO;
+        __block uint64_t images = 0;
+        
+        [scanner scanWithHandler:^(MKImageScanResult *result, BOOL __unused *stop) {
+            expect(inHandler).to.beFalsy();
+            inHandler = YES;
+            [scanned addObject:result.fileURL];
+            images += result.images.count;
+            inHandler = NO;
+        }];
+        
+        expect(scanned).to.haveCountOf([NSSet setWithArray:frameworks].count);
+        expect(scanner.filesScanned).to.equal(frameworks.count);
+        expect(scanner.imagesScanned).to.equal(images);
+        expect(scanner.bytesScanned).to.beGreaterThan(0);
+        expect(scanner.maximumLatency).to.beGreaterThanOrEqualTo(scanner.averageLatency);
+        expect(scanner.filesPerSecond).to.beGreaterThan(0);
+    });
+    
+    if (MKSpecBenchmarksEnabled()) it(@"should benchmark scanning the frameworks", ^{
+        MKImageScanner *scanner = [[[MKImageScanner alloc] initWithFileURLs:frameworks] autorelease];
+        
+        [scanner scanWithHandler:^(MKImageScanResult __unused *result, BOOL __unused *stop) { }];
+        
+        expect(scanner.filesScanned).to.equal(frameworks.count);
+        MKSpecReportBenchmark([NSString stringWithFormat:@"MKImageScanner files (%llu files, %.1f MB/s, %.3fms max latency, %.3fs stalled)", scanner.filesScanned, scanner.bytesPerSecond / (1024 * 1024), scanner.maximumLatency * 1000, scanner.stallTime], scanner.elapsedTime * NSEC_PER_SEC / MAX(scanner.filesScanned, 1ULL));
+    });
+    
+    it(@"should match the images parsed by MKMachOImage", ^{
+        MKImageScanner *scanner = [[[MKImageScanner alloc] initWithFileURLs:frameworks] autorelease];
+        
+        [scanner scanWithHandler:^(MKImageScanResult *result, BOOL __unused *stop) {
+            if (result.error)
+                return;
+            
+            MKMemoryMap *map = [MKMemoryMap memoryMapWithContentsOfFile:result.fileURL error:NULL];
+            expect(map).toNot.beNil();
+            
+            for (MKScannedImage *scannedImage in result.images) {
+                MKMachOImage *image = [[MKMachOImage alloc] initWithName:NULL slide:0 flags:0 atAddress:scannedImage.offset inMapping:map error:NULL];
+                expect(image).toNot.beNil();
+                if (image == nil) continue;
+                
+                expect(scannedImage.cputype).to.equal(image.header.cputype);
+                expect(scannedImage.filetype).to.equal(image.header.filetype);
+                expect(scannedImage.ncmds).to.equal(image.loadCommands.count);
+                expect(scannedImage.uuid).to.equal([[[image loadCommandsOfType:LC_UUID] firstObject] uuid]);
+                expect(scannedImage.nsyms).to.equal([[[image loadCommandsOfType:LC_SYMTAB] firstObject] nsyms]);
+                
+                [image release];
+            }
+        }];
+    });
+    
+    it(@"should stop when asked", ^{
+        MKImageScanner *scanner = [[[MKImageScanner alloc] initWithFileURLs:frameworks] autorelease];
+        __block NSUInteger delivered = 0;
+        
+        [scanner scanWithHandler:^(MKImageScanResult __unused *result, BOOL *stop) {
+            if (++delivered == 3)
+                *stop = YES;
+        }];
+        
+        expect(delivered).to.equal(MIN(frameworks.count, (NSUInteger)3));
+        expect(scanner.filesScanned).to.equal(delivered);
+    });
+    
+    it(@"should stall the workers while the handler is busy", ^{
+        if (frameworks.count < 8) return;
+        
+        MKImageScanner *scanner = [[[MKImageScanner alloc] initWithFileURLs:[frameworks subarrayWithRange:NSMakeRange(0, 8)]] autorelease];
+        scanner.maximumConcurrentMappings = 2;
+        scanner.maximumPendingResults = 1;
+        __block NSUInteger stalledWorkers = 0;
+        
+        // Hold the first result until a worker is blocked behind it.  The
+        // deadline only guards against hanging the suite if back-pressure
+        // is broken.
+        [scanner scanWithHandler:^(MKImageScanResult __unused *result, BOOL __unused *stop) {
+            if (scanner.filesScanned != 1)
+                return;
+            
+            NSDate *deadline = [NSDate dateWithTimeIntervalSinceNow:60];
+            while ((stalledWorkers = scanner.stalledWorkers) == 0 && deadline.timeIntervalSinceNow > 0)
+                sched_yield();
+        }];
+        
+        expect(stalledWorkers).to.beGreaterThan(0);
+        expect(scanner.stalledWorkers).to.equal(0);
+        expect(scanner.filesScanned).to.equal(8);
+        expect(scanner.stallTime).to.beGreaterThan(0);
+    });
+    
+    it(@"should report files that can not be mapped", ^{
+        NSURL *missingURL = [NSURL fileURLWithPath:@"/var/empty/MKImageScannerSpec"];
+        MKImageScanner *scanner = [[[MKImageScanner alloc] initWithFileURLs:@[missingURL]] autorelease];
+        __block MKImageScanResult *scanResult;
+        
+        [scanner scanWithHandler:^(MKImageScanResult *result, BOOL __unused *stop) {
+            scanResult = [result retain];
+        }];
+        
+        expect(scanResult.error).toNot.beNil();
+        expect(scanResult.images).to.haveCountOf(0);
+        expect(scanner.failedFiles).to.equal(1);
+        [scanResult release];
+    });
+});
+
+SpecEnd
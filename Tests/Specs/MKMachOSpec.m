@@ -104,6 +104,137 @@ SpecBegin(MKMachOImage)
                 });
             });
             
+            //----------------------------------------------------------------//
+            describe(@"symbol table", ^{
+                MKSymbolTable *symbolTable = macho.symbolTable;
+                if (symbolTable == nil) return;
+                
+                it(@"should instantiate each symbol once", ^{
+                    NSArray *symbols = symbolTable.symbols;
+                    expect(symbolTable.symbolCount).to.equal(symbols.count);
+                    
+                    NSUInteger index = 0;
+                    for (MKSymbol *symbol in symbols) {
+                        expect(symbol).to.beIdenticalTo([symbolTable symbolAtIndex:index]);
+                        expect(symbol).to.beIdenticalTo(symbols[index]);
+                        index++;
+                    }
+                    expect(index).to.equal(symbolTable.symbolCount);
+                    expect([symbolTable symbolAtIndex:index]).to.beNil();
+                });
+                
+                it(@"should raise for an index beyond the end of the symbols", ^{
+                    NSArray *symbols = symbolTable.symbols;
+                    expect(^{ [symbols objectAtIndex:symbols.count]; }).to.raise(NSRangeException);
+                });
+                
+                it(@"should decode symbols the same as reading them individually", ^{
+                    NSUInteger index = 0;
+                    for (MKSymbol *symbol in symbolTable.symbols) {
+                        NSError *error = nil;
+                        MKSymbol *read = [MKSymbol symbolWithOffset:symbol.nodeOffset fromParent:symbolTable error:&error];
+                        expect(error).to.beNil();
+                        expect(read.class).to.equal(symbol.class);
+                        expect(read.strx).to.equal(symbol.strx);
+                        expect(read.type).to.equal(symbol.type);
+                        expect(read.sect).to.equal(symbol.sect);
+                        expect(read.desc).to.equal(symbol.desc);
+                        expect(read.value).to.equal(symbol.value);
+                        if (++index == 1000) break;
+                    }
+                });
+
+                it(@"should find the symbol containing an address", ^{
+                    for (MKSymbol *symbol in symbolTable.symbols) {
+                        if ((symbol.type & N_STAB) || (symbol.type & N_TYPE) != N_SECT)
+                            continue;
+
+                        // Another symbol may have been chosen for this address.
+                        MKSymbol *found = [symbolTable symbolContainingAddress:symbol.value];
+                        expect(found).toNot.beNil();
+                        expect(found.value).to.equal(symbol.value);
+                    }
+                });
+            });
+
+            //----------------------------------------------------------------//
+            describe(@"string table", ^{
+                MKStringTable *stringTable = macho.stringTable;
+                if (stringTable == nil) return;
+
+                it(@"should look up the same strings by offset", ^{
+                    NSDictionary *strings = stringTable.strings;
+                    for (NSNumber *offset in strings) {
+                        MKCString *expected = strings[offset];
+                        size_t length = 0;
+                        const char *cString = [stringTable cStringAtOffset:offset.unsignedIntValue length:&length];
+
+                        expect(length).to.equal(strlen(cString));
+                        expect(@(cString)).to.equal(expected.string);
+                        expect([stringTable stringAtOffset:offset.unsignedIntValue].string).to.equal(expected.string);
+                    }
+
+                    uint32_t end = (uint32_t)stringTable.nodeSize;
+                    expect([stringTable cStringAtOffset:end length:NULL] == NULL).to.beTruthy();
+                    expect([stringTable stringAtOffset:end]).to.beNil();
+                });
+
+                it(@"should reuse strings when the cache is enabled", ^{
+                    stringTable.cacheLimit = 16;
+                    expect([stringTable stringAtOffset:1]).to.beIdenticalTo([stringTable stringAtOffset:1]);
+                    stringTable.cacheLimit = 0;
+                });
+            });
+
+            //----------------------------------------------------------------//
+            describe(@"sections", ^{
+                NSDictionary *sections = macho.sections;
+                
+                it(@"should index each section by its position", ^{
+                    NSUInteger index = 0;
+                    for (id lc in macho.loadCommands) {
+                        MKSegment *segment = [[macho.segments objectsPassingTest:^(MKSegment *s, BOOL __unused *stop) { return (BOOL)(s.loadCommand == lc); }] anyObject];
+                        if (segment == nil) continue;
+                        
+                        for (NSUInteger i = 0; i < segment.loadCommand.sections.count; i++) {
+                            MKSection *section = sections[@(index++)];
+                            expect(section.parent).to.equal(segment);
+                            expect([macho sectionsWithName:section.name inSegment:segment]).to.contain(section);
+                        }
+                    }
+                    expect(sections.count).to.equal(index);
+                    expect(sections[@(index)]).to.beNil();
+                    expect(sections[@(-1)]).to.beNil();
+                });
+                
+                it(@"should find segments and sections by name", ^{
+                    for (MKSegment *segment in macho.segments) {
+                        expect([macho segmentsWithName:segment.name]).to.contain(segment);
+                        expect([macho segmentsWithName:segment.name]).toNot.beKindOf(NSMutableArray.class);
+                        for (MKSection *section in segment.sections)
+                            expect([macho sectionsWithName:section.name inSegment:segment]).toNot.beKindOf(NSMutableArray.class);
+                    }
+                    NSSet *expected = [macho.segments filteredSetUsingPredicate:[NSPredicate predicateWithFormat:@"name MATCHES %@", @"__TEXT|__DATA"]];
+                    expect([NSSet setWithArray:[macho segmentsWithName:@"__TEXT|__DATA"]]).to.equal(expected);
+                    expect([macho segmentsWithName:@"__NOT_A_SEGMENT"]).to.haveCountOf(0);
+                    expect([macho sectionsWithName:@"__text" inSegmentWithName:@"__NOT_A_SEGMENT"]).to.haveCountOf(0);
+                });
+                
+                if ([frameworkURL.lastPathComponent isEqualToString:@"Foundation"] && sections.count > 0)
+                it(@"should answer repeated section queries", ^{
+                    const NSUInteger iterations = 1000;
+                    NSUInteger count = sections.count;
+                    NSUInteger found = 0;
+                    
+                    for (NSUInteger i = 0; i < iterations; i++)
+                        found += (sections[@(i % count)] != nil);
+                    for (NSUInteger i = 0; i < iterations; i++)
+                        found += [macho sectionsWithName:@"__text" inSegmentWithName:@"__TEXT"].count;
+                    
+                    expect(found).to.equal(2 * iterations);
+                });
+            });
+            
             //----------------------------------------------------------------//
             describe(@"load commands", ^{
                 NSArray *otoolArchitectureLoadCommands = otoolArchitecture.loadCommands;
@@ -118,6 +249,50 @@ SpecBegin(MKMachOImage)
                     expect(machoLoadCommands.count).to.equal(otoolArchitectureLoadCommands.count);
                 });
                 
+                it(@"should return the load commands of each type in order", ^{
+                    NSSet *types = [NSSet setWithArray:[machoLoadCommands valueForKeyPath:@"cmd"]];
+                    for (NSNumber *type in types) {
+                        NSArray *expected = [machoLoadCommands filteredArrayUsingPredicate:[NSPredicate predicateWithFormat:@"class.ID == %@", type]];
+                        expect([macho loadCommandsOfType:type.unsignedIntValue]).to.equal(expected);
+                    }
+                    expect([macho loadCommandsOfType:0]).to.haveCountOf(0);
+                });
+                
+                it(@"should return the class of each load command for its ID", ^{
+                    for (MKLoadCommand *lc in machoLoadCommands) {
+                        expect([MKLoadCommand classForCommandID:lc.cmd]).to.equal(lc.class);
+                        expect([MKLoadCommand classForCommandID:lc.cmd]).to.equal([MKLoadCommand classForCommandID:lc.cmd]);
+                    }
+                });
+                
+                it(@"should return the same load commands as filtering on repeated lookups", ^{
+                    uint32_t types[] = { LC_SYMTAB, LC_DYSYMTAB, LC_SEGMENT, LC_SEGMENT_64, LC_UUID, LC_LOAD_DYLIB };
+                    
+                    for (NSUInteger i = 0; i < 2; i++) {
+                        for (size_t t = 0; t < sizeof(types)/sizeof(*types); t++) {
+                            NSArray *expected = [machoLoadCommands filteredArrayUsingPredicate:[NSPredicate predicateWithFormat:@"class.ID == %@", @(types[t])]];
+                            expect([macho loadCommandsOfType:types[t]]).to.equal(expected);
+                        }
+                    }
+                });
+                
+                it(@"should find each enumerated export", ^{
+                    for (MKLCDyldInfo *dyldInfo in [machoLoadCommands filteredArrayUsingPredicate:[NSPredicate predicateWithFormat:@"self isKindOfClass: %@", MKLCDyldInfo.class]]) {
+                        NSUInteger warnings = dyldInfo.warnings.count;
+                        __block NSUInteger count = 0;
+                        [dyldInfo enumerateExportsUsingBlock:^(const mk_export_t *export, BOOL __unused *stop) {
+                            mk_export_t found;
+                            expect([dyldInfo findExportNamed:export->name export:&found]).to.beTruthy();
+                            expect(found.flags).to.equal(export->flags);
+                            expect(found.offset).to.equal(export->offset);
+                            count++;
+                        }];
+                        expect(dyldInfo.warnings).to.haveCountOf(warnings);
+                        if (dyldInfo.export_size > 2)
+                            expect(count).to.beGreaterThan(0);
+                    }
+                });
+                
                 //------------------------------------------------------------//
                 for (NSUInteger i=0; i<MIN(machoLoadCommands.count, otoolArchitectureLoadCommands.count); i++)
                 describe([NSString stringWithFormat:@"%lu", (unsigned long)i], ^{
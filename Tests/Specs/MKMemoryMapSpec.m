@@ -72,6 +72,30 @@ describe(@"a file memory map", ^{
         expect([map hasMappingAtOffset:4096 fromAddress:0 length:5484640]).to.beTruthy();
         expect([map hasMappingAtOffset:5492736 fromAddress:0 length:4994016]).to.beTruthy();
     });
+
+    it(@"should service a batch of copy requests", ^{
+        uint8_t buffers[3][64];
+        mk_memory_map_copy_request_t requests[3] = {
+            { .offset = 0, .address = 4096, .length = 64, .buffer = buffers[0] },
+            { .offset = 32, .address = 4096, .length = 64, .buffer = buffers[1] },
+            { .offset = 0, .address = fileData.length + 4096, .length = 64, .buffer = buffers[2] },
+        };
+        NSError *error = nil;
+
+        expect([map copyBytesWithRequests:requests count:3 requireFull:YES error:&error]).to.beFalsy();
+        expect(error).toNot.beNil();
+
+        expect(requests[0].error).to.equal(MK_ESUCCESS);
+        expect(requests[0].copied).to.equal(64);
+        expect(memcmp(buffers[0], (uint8_t*)fileData.bytes + 4096, 64)).to.equal(0);
+
+        expect(requests[1].error).to.equal(MK_ESUCCESS);
+        expect(requests[1].copied).to.equal(64);
+        expect(memcmp(buffers[1], (uint8_t*)fileData.bytes + 4096 + 32, 64)).to.equal(0);
+
+        expect(requests[2].error).toNot.equal(MK_ESUCCESS);
+        expect(requests[2].copied).to.equal(0);
+    });
 });
 
 
@@ -0,0 +1,209 @@
+//----------------------------------------------------------------------------//
+//|
+//|             MachOKit - A Lightweight Mach-O Parsing Library
+//|             MKNodeSpec.m
+//|
+//|             D.V.
+//|             Copyright (c) 2014-2015 D.V. All rights reserved.
+//|
+//| Permission is hereby granted, free of charge, to any person obtaining a
+//| copy of this software and associated documentation files (the "Software"),
+//| to deal in the Software without restriction, including without limitation
+//| the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//| and/or sell copies of the Software, and to permit persons to whom the
+//| Software is furnished to do so, subject to the following conditions:
+//|
+//| The above copyright notice and this permission notice shall be included
+//| in all copies or substantial portions of the Software.
+//|
+//| THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+//| OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+//| MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+//| IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+//| CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+//| TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//| SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//----------------------------------------------------------------------------//
+
+@interface MKNodeSpecDelegate : NSObject <MKNodeDelegate>
+@end
+
+@implementation MKNodeSpecDelegate
+- (void)logMessageFromNode:(MKNode* __unused)node atLevel:(mk_logging_level_t __unused)level inFile:(const char* __unused)file line:(int __unused)line function:(const char* __unused)function message:(NSString* __unused)message
+{ }
+@end
+
+SpecBegin(MKNode)
+
+describe(@"warnings", ^{
+    it(@"should return warnings in the order they were pushed", ^{
+        MKNode *node = [[MKNode alloc] initWithParent:nil error:NULL];
+        expect(node.warnings).to.haveCountOf(0);
+        
+        NSError *underlying = [NSError mk_errorWithDomain:MKErrorDomain code:MK_EOVERFLOW description:@"underlying"];
+        [node pushWarningWithCode:MK_EINVALID_DATA property:@"first" underlyingError:nil description:@"first warning"];
+        [node pushWarningWithCode:MK_EOVERFLOW property:@"second" underlyingError:underlying description:@"second warning"];
+        
+        NSArray *warnings = node.warnings;
+        expect(warnings).to.haveCountOf(2);
+        expect([warnings[0] code]).to.equal(MK_EINVALID_DATA);
+        expect([warnings[0] mk_property]).to.equal(@"first");
+        expect([warnings[0] localizedDescription]).to.equal(@"first warning");
+        expect([warnings[1] mk_property]).to.equal(@"second");
+        expect([warnings[1] userInfo][NSUnderlyingErrorKey]).to.equal(underlying);
+        
+        // Reading again without pushing returns the same errors.
+        expect(node.warnings[0]).to.beIdenticalTo(warnings[0]);
+        
+        [node pushWarningWithCode:MK_ENOT_FOUND property:@"third" underlyingError:nil description:@"third warning"];
+        expect(warnings).to.haveCountOf(2);
+        expect(node.warnings).to.haveCountOf(3);
+        expect(node.warnings[0]).to.beIdenticalTo(warnings[0]);
+        
+        node.warnings = @[ warnings[1] ];
+        expect(node.warnings).to.equal(@[ warnings[1] ]);
+        
+        [node release];
+    });
+    
+    it(@"should not describe a warning until the warnings are read", ^{
+        MKNode *node = [[MKNode alloc] initWithParent:nil error:NULL];
+        __block NSUInteger described = 0;
+        
+        [node pushWarningWithCode:MK_EINVALID_DATA property:@"lazy" underlyingError:nil descriptionBlock:^NSString* {
+            described++;
+            return @"lazy warning";
+        }];
+        expect(described).to.equal(0);
+        
+        expect([node.warnings[0] localizedDescription]).to.equal(@"lazy warning");
+        expect(node.warnings).to.haveCountOf(1);
+        expect(described).to.equal(1);
+        
+        [node release];
+    });
+    
+    it(@"should accumulate a warning for each load command of a pathological image", ^{
+        // Every load command of this image lies beyond sizeofcmds, so each
+        // one adds a warning to the image.
+        const uint32_t ncmds = 50000;
+        NSMutableData *data = [NSMutableData dataWithLength:sizeof(struct mach_header_64) + ncmds * sizeof(struct load_command)];
+        struct mach_header_64 *header = data.mutableBytes;
+        header->magic = MH_MAGIC_64;
+        header->cputype = CPU_TYPE_X86_64;
+        header->cpusubtype = CPU_SUBTYPE_X86_64_ALL;
+        header->filetype = MH_EXECUTE;
+        header->ncmds = ncmds;
+        header->sizeofcmds = 0;
+        
+        struct load_command *commands = (struct load_command*)(header + 1);
+        for (uint32_t i = 0; i < ncmds; i++) {
+            commands[i].cmd = 0x7F;
+            commands[i].cmdsize = sizeof(struct load_command);
+        }
+        
+        NSURL *fileURL = [NSURL fileURLWithPath:[NSTemporaryDirectory() stringByAppendingPathComponent:[NSUUID UUID].UUIDString]];
+        expect([data writeToURL:fileURL atomically:NO]).to.beTruthy();
+        
+        NSError *error = nil;
+        MKMemoryMap *map = [MKMemoryMap memoryMapWithContentsOfFile:fileURL error:&error];
+        expect(map).toNot.beNil();
+        
+        MKMachOImage *macho = [[MKMachOImage alloc] initWithName:"pathological" slide:0 flags:0 atAddress:0 inMapping:map error:&error];
+        expect(macho).toNot.beNil();
+        expect(macho.loadCommands).to.haveCountOf(ncmds);
+        
+        NSArray *warnings = macho.warnings;
+        expect(warnings).to.haveCountOf(ncmds);
+        
+        NSUInteger loadCommandWarnings = 0;
+        for (NSError *warning in warnings)
+            loadCommandWarnings += [warning.mk_property isEqualToString:@"loadCommands"];
+        expect(loadCommandWarnings).to.equal(ncmds);
+        
+        // Reading again returns the same errors.
+        NSArray *again = macho.warnings;
+        expect(again).to.haveCountOf(ncmds);
+        expect(again.firstObject).to.beIdenticalTo(warnings.firstObject);
+        expect(again.lastObject).to.beIdenticalTo(warnings.lastObject);
+        
+        [macho release];
+        [[NSFileManager defaultManager] removeItemAtURL:fileURL error:NULL];
+    });
+});
+
+describe(@"inherited values", ^{
+    __block MKMachOImage *macho;
+    
+    beforeAll(^{
+        NSError *error = nil;
+        NSURL *frameworkURL = [NSFileManager allExecutableURLs:MKFrameworkTypeAllFrameworks].firstObject;
+        Architecture *architecture = [Binary binaryAtURL:frameworkURL].architectures.firstObject;
+        expect(architecture).toNot.beNil();
+        
+        MKMemoryMap *map = [MKMemoryMap memoryMapWithContentsOfFile:frameworkURL error:&error];
+        expect(map).toNot.beNil();
+        
+        macho = [[MKMachOImage alloc] initWithName:frameworkURL.lastPathComponent.UTF8String slide:0 flags:0 atAddress:architecture.offset inMapping:map error:&error];
+        expect(macho).to.beKindOf(MKMachOImage.class);
+    });
+    
+    afterAll(^{
+        [macho release];
+    });
+    
+    it(@"should be resolved from the image", ^{
+        expect(macho.macho).to.beIdenticalTo(macho);
+        
+        for (MKSection *section in macho.sections.allValues) {
+            expect(section.macho).to.beIdenticalTo(macho);
+            expect(section.memoryMap).to.beIdenticalTo(macho.memoryMap);
+            expect(section.dataModel).to.beIdenticalTo(macho.dataModel);
+        }
+        
+        for (MKSymbol *symbol in macho.symbolTable.symbols) {
+            expect(symbol.macho).to.beIdenticalTo(macho);
+            expect(symbol.memoryMap).to.beIdenticalTo(macho.memoryMap);
+            expect(symbol.dataModel).to.beIdenticalTo(macho.dataModel);
+        }
+    });
+    
+    it(@"should see delegates set after the node was created", ^{
+        MKNodeSpecDelegate *delegate = [[MKNodeSpecDelegate new] autorelease];
+        MKNodeSpecDelegate *other = [[MKNodeSpecDelegate new] autorelease];
+        MKSymbolTable *symbolTable = macho.symbolTable;
+        MKSymbol *symbol = symbolTable.symbols.firstObject;
+        if (symbol == nil) return;
+        
+        expect(symbol.delegate).to.beNil();
+        
+        macho.delegate = delegate;
+        expect(symbol.delegate).to.beIdenticalTo(delegate);
+        
+        symbolTable.delegate = other;
+        expect(symbol.delegate).to.beIdenticalTo(other);
+        expect(macho.delegate).to.beIdenticalTo(delegate);
+        
+        symbolTable.delegate = nil;
+        macho.delegate = nil;
+        expect(symbol.delegate).to.beNil();
+    });
+    
+    it(@"should be resolved during repeated symbol and section walks", ^{
+        NSArray *sections = macho.sections.allValues;
+        NSArray *symbols = macho.symbolTable.symbols;
+        const NSUInteger passes = 100;
+        NSUInteger found = 0;
+        
+        for (NSUInteger pass = 0; pass < passes; pass++) @autoreleasepool {
+            for (MKSection *section in sections)
+                found += (section.macho == macho) + (section.memoryMap != nil) + (section.dataModel != nil) + (section.delegate == nil);
+            for (MKSymbol *symbol in symbols)
+                found += (symbol.macho == macho) + (symbol.memoryMap != nil) + (symbol.dataModel != nil) + (symbol.delegate == nil);
+        }
+        
+        expect(found).to.equal(4 * passes * (sections.count + symbols.count));
+    });
+});
+
+SpecEnd
@@ -0,0 +1,168 @@
+//----------------------------------------------------------------------------//
+//|
+//|             MachOKit - A Lightweight Mach-O Parsing Library
+//|             arena_spec.m
+//|
+//|             D.V.
+//|             Copyright (c) 2014-2015 D.V. All rights reserved.
+//|
+//| Permission is hereby granted, free of charge, to any person obtaining a
+//| copy of this software and associated documentation files (the "Software"),
+//| to deal in the Software without restriction, including without limitation
+//| the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//| and/or sell copies of the Software, and to permit persons to whom the
+//| Software is furnished to do so, subject to the following conditions:
+//|
+//| The above copyright notice and this permission notice shall be included
+//| in all copies or substantial portions of the Software.
+//|
+//| THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+//| OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+//| MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+//| IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+//| CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+//| TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//| SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//----------------------------------------------------------------------------//
+
+#include <mach-o/dyld.h>
+
+static void* arena_spec_allocate(void *backing, size_t size)
+{
+    (*(uint32_t*)backing)++;
+    return malloc(size);
+}
+
+static void arena_spec_deallocate(void *backing, void *chunk, size_t __unused size)
+{
+    (*(uint32_t*)backing)--;
+    free(chunk);
+}
+
+SpecBegin(arena)
+
+describe(@"mk_arena", ^{
+    it(@"should fail once a fixed buffer is exhausted", ^{
+        uint64_t buffer[32];
+        mk_arena_t arena;
+        expect(mk_arena_init(buffer, sizeof(buffer), &arena)).to.equal(MK_ESUCCESS);
+        
+        uint32_t count = 0;
+        void *first = NULL;
+        void *allocation;
+        while ((allocation = mk_arena_alloc(&arena, 24, 8))) {
+            expect((uintptr_t)allocation % 8).to.equal(0);
+            expect((uintptr_t)allocation).to.beGreaterThanOrEqualTo((uintptr_t)buffer);
+            expect((uintptr_t)allocation + 24).to.beLessThanOrEqualTo((uintptr_t)buffer + sizeof(buffer));
+            if (first == NULL)
+                first = allocation;
+            count++;
+        }
+        expect(count).to.beGreaterThan(0);
+        expect(mk_arena_get_statistics(&arena).failures).to.equal(1);
+        
+        mk_arena_reset(&arena);
+        expect(mk_arena_alloc(&arena, 24, 8) == first).to.beTruthy();
+    });
+    
+    it(@"should reuse its chunks after a reset", ^{
+        uint32_t chunks = 0;
+        mk_arena_t arena;
+        expect(mk_arena_init_with_allocator(NULL, 0, 4096, &chunks, arena_spec_allocate, arena_spec_deallocate, &arena)).to.equal(MK_ESUCCESS);
+        
+        for (uint32_t round = 0; round < 4; round++) {
+            for (uint32_t i = 0; i < 1000; i++) {
+                uint8_t *allocation = mk_arena_alloc(&arena, 1 + i % 50, 16);
+                expect(allocation != NULL).to.beTruthy();
+                expect((uintptr_t)allocation % 16).to.equal(0);
+                memset(allocation, (int)i, 1 + i % 50);
+            }
+            
+            mk_vm_address_t *large = mk_arena_alloc_array(&arena, mk_vm_address_t, 10000);
+            expect(large != NULL).to.beTruthy();
+            memset(large, 0xFF, sizeof(*large) * 10000);
+            
+            mk_arena_reset(&arena);
+            expect(mk_arena_get_statistics(&arena).used_bytes).to.equal(0);
+        }
+        
+        // Every chunk was created during the first round.
+        expect(mk_arena_get_statistics(&arena).chunk_allocations).to.equal(chunks);
+        
+        mk_arena_free(&arena);
+        expect(chunks).to.equal(0);
+    });
+    
+    it(@"should reject alignments which are not a power of two", ^{
+        uint64_t buffer[8];
+        mk_arena_t arena;
+        mk_arena_init(buffer, sizeof(buffer), &arena);
+        expect(mk_arena_alloc(&arena, 8, 3) == NULL).to.beTruthy();
+        expect(mk_arena_alloc(&arena, 8, 0) == NULL).to.beTruthy();
+    });
+});
+
+describe(@"mk_macho_init_segments", ^{
+    __block mk_memory_map_self_t memory_map;
+    
+    beforeAll(^{
+        expect(mk_memory_map_self_init(NULL, &memory_map)).to.equal(MK_ESUCCESS);
+    });
+    
+    it(@"should require a context arena", ^{
+        mk_macho_t macho;
+        expect(mk_macho_init(NULL, _dyld_get_image_name(0), _dyld_get_image_vmaddr_slide(0), (mk_vm_address_t)_dyld_get_image_header(0), &memory_map, &macho)).to.equal(MK_ESUCCESS);
+        
+        mk_segment_t *segments;
+        uint32_t count;
+        expect(mk_macho_init_segments(&macho, &segments, &count)).to.equal(MK_EUNAVAILABLE);
+        
+        mk_macho_free(&macho);
+    });
+    
+    it(@"should allocate the segments and sections of every image in this process", ^{
+        uint32_t chunks = 0;
+        mk_arena_t arena;
+        mk_arena_init_with_allocator(NULL, 0, 16 * 1024, &chunks, arena_spec_allocate, arena_spec_deallocate, &arena);
+        
+        mk_context_t context = { .arena = &arena };
+        
+        for (uint32_t i = 0; i < _dyld_image_count(); i++)
+        {
+            mk_macho_t *macho = mk_arena_alloc_type(&arena, mk_macho_t);
+            expect(macho != NULL).to.beTruthy();
+            
+            mk_error_t err = mk_macho_init(&context, _dyld_get_image_name(i), _dyld_get_image_vmaddr_slide(i), (mk_vm_address_t)_dyld_get_image_header(i), &memory_map, macho);
+            expect(err).to.equal(MK_ESUCCESS);
+            if (err) continue;
+            
+            mk_segment_t *segments = NULL;
+            uint32_t segmentCount = 0;
+            expect(mk_macho_init_segments(macho, &segments, &segmentCount)).to.equal(MK_ESUCCESS);
+            expect(segmentCount).to.beGreaterThan(0);
+            
+            for (uint32_t s = 0; s < segmentCount; s++) {
+                mk_section_t *sections = NULL;
+                uint32_t sectionCount = 0;
+                expect(mk_segment_init_sections(&segments[s], &sections, &sectionCount)).to.equal(MK_ESUCCESS);
+                expect(sectionCount).to.equal(mk_segment_get_nsects(&segments[s]));
+                
+                for (uint32_t j = 0; j < sectionCount; j++)
+                    expect(mk_section_get_segment(&sections[j]).segment == &segments[s]).to.beTruthy();
+            }
+            
+            mk_macho_free_segments(segments, segmentCount);
+            mk_macho_free(macho);
+            mk_arena_reset(&arena);
+        }
+        
+        // Resetting between images lets later images reuse the chunks
+        // created for earlier ones.
+        expect(mk_arena_get_statistics(&arena).chunk_allocations).to.beLessThan(_dyld_image_count());
+        
+        mk_arena_free(&arena);
+        expect(chunks).to.equal(0);
+    });
+});
+
+SpecEnd
@@ -44,6 +44,8 @@ describe(@"The ILP32 Data Model", ^{
         
         expect(mk_data_model_get_byte_order(ilp32)->swap32( in32 )).to.equal(@(0x01020304));
         expect(mk_data_model_get_byte_order(ilp32)->swap64( in64 )).to.equal(@(0x0102030405060708));
+        expect(mk_byteorder_swap32(mk_data_model_get_byte_order(ilp32), in32)).to.equal(@(0x01020304));
+        expect(mk_byteorder_swap64(mk_data_model_get_byte_order(ilp32), in64)).to.equal(@(0x0102030405060708));
 #else
 #error Implement this
 #endif
@@ -66,6 +68,8 @@ describe(@"The LP64 Data Model", ^{
         
         expect(mk_data_model_get_byte_order(lp64)->swap32( in32 )).to.equal(@(0x01020304));
         expect(mk_data_model_get_byte_order(lp64)->swap64( in64 )).to.equal(@(0x0102030405060708));
+        expect(mk_byteorder_swap32(mk_data_model_get_byte_order(lp64), in32)).to.equal(@(0x01020304));
+        expect(mk_byteorder_swap64(mk_data_model_get_byte_order(lp64), in64)).to.equal(@(0x0102030405060708));
 #else
 #error Implement this
 #endif
@@ -88,10 +92,23 @@ describe(@"A Bridged Data Model", ^{
         
         expect(mk_data_model_get_byte_order(ppc32)->swap32( in32 )).to.equal(@(0x04030201));
         expect(mk_data_model_get_byte_order(ppc32)->swap64( in64 )).to.equal(@(0x0807060504030201));
+        expect(mk_byteorder_swap32(mk_data_model_get_byte_order(ppc32), in32)).to.equal(@(0x04030201));
+        expect(mk_byteorder_swap64(mk_data_model_get_byte_order(ppc32), in64)).to.equal(@(0x0807060504030201));
 #else
 #error Implement this
 #endif
     });
 });
 
+describe(@"A custom byte order", ^{
+    it(@"should call through its swap functions", ^{
+        mk_byteorder_t custom = mk_byteorder_swapped;
+        custom.kind = MK_BYTEORDER_CUSTOM;
+        
+        expect(mk_byteorder_swap16(&custom, 0x0102)).to.equal(@(0x0201));
+        expect(mk_byteorder_swap32(&custom, 0x01020304)).to.equal(@(0x04030201));
+        expect(mk_byteorder_swap64(&custom, 0x0102030405060708)).to.equal(@(0x0807060504030201));
+    });
+});
+
 SpecEnd
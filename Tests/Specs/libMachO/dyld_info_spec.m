@@ -0,0 +1,482 @@
+//----------------------------------------------------------------------------//
+//|
+//|             MachOKit - A Lightweight Mach-O Parsing Library
+//|             dyld_info_spec.m
+//|
+//|             D.V.
+//|             Copyright (c) 2014-2015 D.V. All rights reserved.
+//|
+//| Permission is hereby granted, free of charge, to any person obtaining a
+//| copy of this software and associated documentation files (the "Software"),
+//| to deal in the Software without restriction, including without limitation
+//| the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//| and/or sell copies of the Software, and to permit persons to whom the
+//| Software is furnished to do so, subject to the following conditions:
+//|
+//| The above copyright notice and this permission notice shall be included
+//| in all copies or substantial portions of the Software.
+//|
+//| THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+//| OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+//| MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+//| IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+//| CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+//| TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//| SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//----------------------------------------------------------------------------//
+
+
+#include <mach-o/dyld.h>
+#include <mach/mach_time.h>
+
+//! A 64-bit image with __TEXT at 0x0 and __DATA at 0x10000.
+static struct {
+    struct mach_header_64 header;
+    struct segment_command_64 text;
+    struct segment_command_64 data;
+} synthetic_image = {
+    .header = { .magic = MH_MAGIC_64, .cputype = CPU_TYPE_X86_64, .filetype = MH_EXECUTE, .ncmds = 2, .sizeofcmds = 2 * sizeof(struct segment_command_64) },
+    .text = { .cmd = LC_SEGMENT_64, .cmdsize = sizeof(struct segment_command_64), .segname = SEG_TEXT, .vmaddr = 0x0, .vmsize = 0x4000 },
+    .data = { .cmd = LC_SEGMENT_64, .cmdsize = sizeof(struct segment_command_64), .segname = SEG_DATA, .vmaddr = 0x10000, .vmsize = 0x1000 },
+};
+
+//! Initializes \a largest with the image in this process which has the
+//! largest export trie.  Returns \c false if no image has an export trie.
+static bool
+find_largest_export_trie(mk_memory_map_self_t *memory_map, mk_macho_t *largest)
+{
+    uint32_t largest_size = 0;
+    
+    for(uint32_t i=0; i<_dyld_image_count(); i++)
+    {
+        const struct mach_header *header = _dyld_get_image_header(i);
+        struct load_command *cmd = (struct load_command*)((uintptr_t)header + ((header->magic == MH_MAGIC_64) ? sizeof(struct mach_header_64) : sizeof(struct mach_header)));
+        for (uint32_t c = 0; c < header->ncmds; c++, cmd = (struct load_command*)((uintptr_t)cmd + cmd->cmdsize)) {
+            if (cmd->cmd != LC_DYLD_INFO && cmd->cmd != LC_DYLD_INFO_ONLY)
+                continue;
+            if (((struct dyld_info_command*)cmd)->export_size <= largest_size)
+                break;
+            if (largest_size)
+                mk_macho_free(largest);
+            if (mk_macho_init(NULL, _dyld_get_image_name(i), _dyld_get_image_vmaddr_slide(i), (mk_vm_address_t)header, memory_map, largest) == MK_ESUCCESS)
+                largest_size = ((struct dyld_info_command*)cmd)->export_size;
+            else
+                largest_size = 0;
+            break;
+        }
+    }
+    
+    return (largest_size > 0);
+}
+
+SpecBegin(dyld_info)
+
+describe(@"opcode interpreter", ^{
+    __block mk_memory_map_self_t memory_map;
+    __block mk_macho_t macho;
+    
+    beforeAll(^{
+        mk_error_t err = mk_memory_map_self_init(NULL, &memory_map);
+        expect(err).to.equal(MK_ESUCCESS);
+        err = mk_macho_init(NULL, "synthetic", 0, (mk_vm_address_t)&synthetic_image, &memory_map, &macho);
+        expect(err).to.equal(MK_ESUCCESS);
+    });
+    
+    afterAll(^{
+        mk_macho_free(&macho);
+    });
+    
+    it(@"should step through repeated rebases", ^{
+        const uint8_t opcodes[] = {
+            REBASE_OPCODE_SET_TYPE_IMM | REBASE_TYPE_POINTER,
+            REBASE_OPCODE_SET_SEGMENT_AND_OFFSET_ULEB | 1, 0x10,
+            REBASE_OPCODE_DO_REBASE_IMM_TIMES | 3,
+            REBASE_OPCODE_DO_REBASE_ULEB_TIMES_SKIPPING_ULEB, 2, 8,
+            REBASE_OPCODE_ADD_ADDR_IMM_SCALED | 2,
+            REBASE_OPCODE_DO_REBASE_ADD_ADDR_ULEB, 0x10,
+            REBASE_OPCODE_DO_REBASE_ULEB_TIMES, 2,
+            REBASE_OPCODE_DONE
+        };
+        const mk_vm_offset_t expected[] = { 0x10, 0x18, 0x20, 0x28, 0x38, 0x58, 0x70, 0x78 };
+        
+        mk_rebase_iterator_t iterator;
+        mk_rebase_fixup_t fixup;
+        mk_error_t err = mk_rebase_iterator_init_with_opcodes(&macho, opcodes, sizeof(opcodes), &iterator);
+        expect(err).to.equal(MK_ESUCCESS);
+        
+        size_t count = 0;
+        while (mk_rebase_iterator_next(&iterator, &fixup, &err)) {
+            if (count < sizeof(expected)/sizeof(*expected)) {
+                expect(fixup.segment_index).to.equal(1);
+                expect(fixup.segment_offset).to.equal(expected[count]);
+                expect(fixup.address).to.equal(0x10000 + expected[count]);
+                expect(fixup.type).to.equal(REBASE_TYPE_POINTER);
+            }
+            count++;
+        }
+        expect(err).to.equal(MK_ESUCCESS);
+        expect(count).to.equal(sizeof(expected)/sizeof(*expected));
+    });
+    
+    it(@"should track the symbol of each bind", ^{
+        const uint8_t opcodes[] = {
+            BIND_OPCODE_SET_DYLIB_ORDINAL_IMM | 2,
+            BIND_OPCODE_SET_SYMBOL_TRAILING_FLAGS_IMM, '_', 'f', 'o', 'o', '\0',
+            BIND_OPCODE_SET_TYPE_IMM | BIND_TYPE_POINTER,
+            BIND_OPCODE_SET_ADDEND_SLEB, 0x78,
+            BIND_OPCODE_SET_SEGMENT_AND_OFFSET_ULEB | 1, 0x80, 0x02,
+            BIND_OPCODE_DO_BIND,
+            BIND_OPCODE_DO_BIND_ADD_ADDR_IMM_SCALED | 1,
+            BIND_OPCODE_SET_DYLIB_SPECIAL_IMM | (BIND_SPECIAL_DYLIB_FLAT_LOOKUP & BIND_IMMEDIATE_MASK),
+            BIND_OPCODE_SET_SYMBOL_TRAILING_FLAGS_IMM | BIND_SYMBOL_FLAGS_WEAK_IMPORT, '_', 'b', 'a', 'r', '\0',
+            BIND_OPCODE_DO_BIND_ULEB_TIMES_SKIPPING_ULEB, 3, 8,
+            BIND_OPCODE_DONE
+        };
+        const mk_vm_offset_t expected[] = { 0x100, 0x108, 0x118, 0x128, 0x138 };
+        
+        mk_bind_iterator_t iterator;
+        mk_bind_fixup_t fixup;
+        mk_error_t err = mk_bind_iterator_init_with_opcodes(&macho, opcodes, sizeof(opcodes), false, &iterator);
+        expect(err).to.equal(MK_ESUCCESS);
+        
+        size_t count = 0;
+        while (mk_bind_iterator_next(&iterator, &fixup, &err)) {
+            if (count < sizeof(expected)/sizeof(*expected)) {
+                expect(fixup.address).to.equal(0x10000 + expected[count]);
+                expect(fixup.addend).to.equal(-8);
+                expect(fixup.type).to.equal(BIND_TYPE_POINTER);
+                if (count < 2) {
+                    expect(@(fixup.symbol_name)).to.equal(@"_foo");
+                    expect(fixup.library_ordinal).to.equal(2);
+                    expect(fixup.symbol_flags).to.equal(0);
+                } else {
+                    expect(@(fixup.symbol_name)).to.equal(@"_bar");
+                    expect(fixup.library_ordinal).to.equal(BIND_SPECIAL_DYLIB_FLAT_LOOKUP);
+                    expect(fixup.symbol_flags).to.equal(BIND_SYMBOL_FLAGS_WEAK_IMPORT);
+                }
+            }
+            count++;
+        }
+        expect(err).to.equal(MK_ESUCCESS);
+        expect(count).to.equal(sizeof(expected)/sizeof(*expected));
+    });
+    
+    it(@"should continue past the end of each lazy bind", ^{
+        const uint8_t opcodes[] = {
+            BIND_OPCODE_SET_SEGMENT_AND_OFFSET_ULEB | 1, 0x80, 0x04,
+            BIND_OPCODE_SET_DYLIB_ORDINAL_IMM | 1,
+            BIND_OPCODE_SET_SYMBOL_TRAILING_FLAGS_IMM, '_', 'a', '\0',
+            BIND_OPCODE_DO_BIND,
+            BIND_OPCODE_DONE,
+            BIND_OPCODE_SET_SEGMENT_AND_OFFSET_ULEB | 1, 0x08,
+            BIND_OPCODE_SET_DYLIB_ORDINAL_IMM | 1,
+            BIND_OPCODE_SET_SYMBOL_TRAILING_FLAGS_IMM, '_', 'b', '\0',
+            BIND_OPCODE_DO_BIND,
+            BIND_OPCODE_DONE
+        };
+        
+        mk_bind_iterator_t iterator;
+        mk_bind_fixup_t fixup;
+        mk_error_t err;
+        
+        mk_bind_iterator_init_with_opcodes(&macho, opcodes, sizeof(opcodes), true, &iterator);
+        expect(mk_bind_iterator_next(&iterator, &fixup, &err)).to.beTruthy();
+        expect(fixup.address).to.equal(0x10200);
+        expect(@(fixup.symbol_name)).to.equal(@"_a");
+        expect(mk_bind_iterator_next(&iterator, &fixup, &err)).to.beTruthy();
+        expect(fixup.address).to.equal(0x10008);
+        expect(@(fixup.symbol_name)).to.equal(@"_b");
+        expect(mk_bind_iterator_next(&iterator, &fixup, &err)).to.beFalsy();
+        expect(err).to.equal(MK_ESUCCESS);
+        
+        // The same opcodes as a non-lazy stream end at the first DONE.
+        mk_bind_iterator_init_with_opcodes(&macho, opcodes, sizeof(opcodes), false, &iterator);
+        expect(mk_bind_iterator_next(&iterator, &fixup, &err)).to.beTruthy();
+        expect(mk_bind_iterator_next(&iterator, &fixup, &err)).to.beFalsy();
+        expect(err).to.equal(MK_ESUCCESS);
+    });
+    
+    it(@"should fail on invalid opcodes", ^{
+        mk_rebase_iterator_t rebase_iterator;
+        mk_rebase_fixup_t rebase_fixup;
+        mk_bind_iterator_t bind_iterator;
+        mk_bind_fixup_t bind_fixup;
+        mk_error_t err;
+        
+        // Outside the segment.
+        const uint8_t out_of_range[] = { REBASE_OPCODE_SET_SEGMENT_AND_OFFSET_ULEB | 1, 0x80, 0x20, REBASE_OPCODE_DO_REBASE_IMM_TIMES | 1 };
+        mk_rebase_iterator_init_with_opcodes(&macho, out_of_range, sizeof(out_of_range), &rebase_iterator);
+        expect(mk_rebase_iterator_next(&rebase_iterator, &rebase_fixup, &err)).to.beFalsy();
+        expect(err).to.equal(MK_EOUT_OF_RANGE);
+        expect(mk_rebase_iterator_next(&rebase_iterator, &rebase_fixup, &err)).to.beFalsy();
+        
+        // No such segment.
+        const uint8_t bad_segment[] = { REBASE_OPCODE_SET_SEGMENT_AND_OFFSET_ULEB | 9, 0x00, REBASE_OPCODE_DO_REBASE_IMM_TIMES | 1 };
+        mk_rebase_iterator_init_with_opcodes(&macho, bad_segment, sizeof(bad_segment), &rebase_iterator);
+        expect(mk_rebase_iterator_next(&rebase_iterator, &rebase_fixup, &err)).to.beFalsy();
+        expect(err).to.equal(MK_EOUT_OF_RANGE);
+        
+        // Truncated ULEB128.
+        const uint8_t truncated[] = { REBASE_OPCODE_SET_SEGMENT_AND_OFFSET_ULEB | 1, 0x80 };
+        mk_rebase_iterator_init_with_opcodes(&macho, truncated, sizeof(truncated), &rebase_iterator);
+        expect(mk_rebase_iterator_next(&rebase_iterator, &rebase_fixup, &err)).to.beFalsy();
+        expect(err).to.equal(MK_EINVALID_DATA);
+        
+        // A skip that wraps the stride to zero.
+        const uint8_t zero_stride[] = { REBASE_OPCODE_SET_SEGMENT_AND_OFFSET_ULEB | 1, 0x00, REBASE_OPCODE_DO_REBASE_ULEB_TIMES_SKIPPING_ULEB, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01 };
+        mk_rebase_iterator_init_with_opcodes(&macho, zero_stride, sizeof(zero_stride), &rebase_iterator);
+        expect(mk_rebase_iterator_next(&rebase_iterator, &rebase_fixup, &err)).to.beFalsy();
+        expect(err).to.equal(MK_EOVERFLOW);
+        
+        const uint8_t bind_zero_stride[] = { BIND_OPCODE_SET_SYMBOL_TRAILING_FLAGS_IMM, '_', 'x', 0x00, BIND_OPCODE_SET_SEGMENT_AND_OFFSET_ULEB | 1, 0x00, BIND_OPCODE_DO_BIND_ULEB_TIMES_SKIPPING_ULEB, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01 };
+        mk_bind_iterator_init_with_opcodes(&macho, bind_zero_stride, sizeof(bind_zero_stride), false, &bind_iterator);
+        expect(mk_bind_iterator_next(&bind_iterator, &bind_fixup, &err)).to.beFalsy();
+        expect(err).to.equal(MK_EOVERFLOW);
+        
+        // Unterminated symbol name.
+        const uint8_t unterminated[] = { BIND_OPCODE_SET_SYMBOL_TRAILING_FLAGS_IMM, '_', 'x' };
+        mk_bind_iterator_init_with_opcodes(&macho, unterminated, sizeof(unterminated), false, &bind_iterator);
+        expect(mk_bind_iterator_next(&bind_iterator, &bind_fixup, &err)).to.beFalsy();
+        expect(err).to.equal(MK_EINVALID_DATA);
+        
+        // Bind without a symbol.
+        const uint8_t anonymous[] = { BIND_OPCODE_SET_SEGMENT_AND_OFFSET_ULEB | 1, 0x00, BIND_OPCODE_DO_BIND };
+        mk_bind_iterator_init_with_opcodes(&macho, anonymous, sizeof(anonymous), false, &bind_iterator);
+        expect(mk_bind_iterator_next(&bind_iterator, &bind_fixup, &err)).to.beFalsy();
+        expect(err).to.equal(MK_EINVALID_DATA);
+    });
+    
+    it(@"should interpret rebases without expanding them", ^{
+        // Each opcode sequence rebases 500 consecutive pointers.
+        const size_t sequences = 10000;
+        uint8_t *opcodes = malloc(sequences * 5);
+        size_t length = 0;
+        for (size_t i = 0; i < sequences; i++) {
+            opcodes[length++] = REBASE_OPCODE_SET_SEGMENT_AND_OFFSET_ULEB | 1;
+            opcodes[length++] = 0x00;
+            opcodes[length++] = REBASE_OPCODE_DO_REBASE_ULEB_TIMES;
+            opcodes[length++] = 0xF4;
+            opcodes[length++] = 0x03;
+        }
+        
+        mk_rebase_iterator_t iterator;
+        mk_rebase_fixup_t fixup;
+        mk_error_t err = MK_ESUCCESS;
+        size_t count = 0;
+        
+        mk_rebase_iterator_init_with_opcodes(&macho, opcodes, length, &iterator);
+        while (mk_rebase_iterator_next(&iterator, &fixup, &err))
+            count++;
+        free(opcodes);
+        
+        expect(err).to.equal(MK_ESUCCESS);
+        expect(count).to.equal(sequences * 500);
+    });
+});
+
+describe(@"LC_DYLD_INFO", ^{
+    __block mk_memory_map_self_t memory_map;
+    
+    beforeAll(^{
+        mk_error_t err = mk_memory_map_self_init(NULL, &memory_map);
+        expect(err).to.equal(MK_ESUCCESS);
+    });
+    
+    it(@"should interpret the opcodes of all images in this process", ^{
+        for(uint32_t i=0; i<_dyld_image_count(); i++)
+        {
+            mk_macho_t macho;
+            mk_error_t err = mk_macho_init(NULL, _dyld_get_image_name(i), _dyld_get_image_vmaddr_slide(i), (mk_vm_address_t)_dyld_get_image_header(i), &memory_map, &macho);
+            expect(err).to.equal(MK_ESUCCESS);
+            if (err)
+                continue;
+            
+            struct load_command *cmd = mk_macho_find_command(&macho, LC_DYLD_INFO_ONLY, NULL) ?: mk_macho_find_command(&macho, LC_DYLD_INFO, NULL);
+            mk_load_command_t load_command;
+            mk_segment_t link_edit;
+            if (cmd == NULL || mk_load_command_init(&macho, cmd, &load_command) != MK_ESUCCESS) {
+                mk_macho_free(&macho);
+                continue;
+            }
+            if (!MKSpecFindLinkEditSegment(&macho, &link_edit)) {
+                mk_macho_free(&macho);
+                continue;
+            }
+            
+            mk_rebase_iterator_t rebase_iterator;
+            mk_rebase_fixup_t rebase_fixup;
+            err = mk_rebase_iterator_init(&load_command, &link_edit, &rebase_iterator);
+            expect(err).to.equal(MK_ESUCCESS);
+            if (err == MK_ESUCCESS) {
+                while (mk_rebase_iterator_next(&rebase_iterator, &rebase_fixup, &err));
+                expect(err).to.equal(MK_ESUCCESS);
+            }
+            
+            mk_dyld_info_bind_stream_t streams[] = { MK_DYLD_INFO_BIND, MK_DYLD_INFO_WEAK_BIND, MK_DYLD_INFO_LAZY_BIND };
+            for (size_t s = 0; s < sizeof(streams)/sizeof(*streams); s++) {
+                mk_bind_iterator_t bind_iterator;
+                mk_bind_fixup_t bind_fixup;
+                err = mk_bind_iterator_init(&load_command, &link_edit, streams[s], &bind_iterator);
+                expect(err).to.equal(MK_ESUCCESS);
+                if (err)
+                    continue;
+                
+                while (mk_bind_iterator_next(&bind_iterator, &bind_fixup, &err))
+                    expect(bind_fixup.symbol_name != NULL).to.beTruthy();
+                expect(err).to.equal(MK_ESUCCESS);
+            }
+            
+            mk_segment_free(&link_edit);
+            mk_macho_free(&macho);
+        }
+    });
+});
+
+describe(@"export trie", ^{
+    // _foo, _foobar (weak), _bar (re-exported as _baz), _r (resolver)
+    const uint8_t trie_bytes[] = {
+        0x00, 0x01, '_', 0x00, 0x05, 0x00, 0x03, 'f', 'o', 'o', 0x00, 0x14,
+        'b', 'a', 'r', 0x00, 0x23, 'r', 0x00, 0x2c, 0x03, 0x00, 0x80, 0x02,
+        0x01, 'b', 'a', 'r', 0x00, 0x1e, 0x03, 0x04, 0x80, 0x04, 0x00, 0x07,
+        0x08, 0x01, '_', 'b', 'a', 'z', 0x00, 0x00, 0x05, 0x10, 0x80, 0x06,
+        0x80, 0x08, 0x00
+    };
+    
+    it(@"should find each export", ^{
+        mk_export_trie_t trie;
+        mk_export_t export;
+        expect(mk_export_trie_init_with_bytes(trie_bytes, sizeof(trie_bytes), &trie)).to.equal(MK_ESUCCESS);
+        
+        expect(mk_export_trie_find(&trie, "_foo", &export)).to.equal(MK_ESUCCESS);
+        expect(export.offset).to.equal(0x100);
+        expect(mk_export_trie_find(&trie, "_foobar", &export)).to.equal(MK_ESUCCESS);
+        expect(export.offset).to.equal(0x200);
+        expect(export.flags).to.equal(EXPORT_SYMBOL_FLAGS_WEAK_DEFINITION);
+        expect(mk_export_trie_find(&trie, "_bar", &export)).to.equal(MK_ESUCCESS);
+        expect(export.flags).to.equal(EXPORT_SYMBOL_FLAGS_REEXPORT);
+        expect(export.library_ordinal).to.equal(1);
+        expect(@(export.import_name)).to.equal(@"_baz");
+        expect(mk_export_trie_find(&trie, "_r", &export)).to.equal(MK_ESUCCESS);
+        expect(export.offset).to.equal(0x300);
+        expect(export.resolver_offset).to.equal(0x400);
+        
+        expect(mk_export_trie_find(&trie, "_", &export)).to.equal(MK_ENOT_FOUND);
+        expect(mk_export_trie_find(&trie, "_fo", &export)).to.equal(MK_ENOT_FOUND);
+        expect(mk_export_trie_find(&trie, "_foob", &export)).to.equal(MK_ENOT_FOUND);
+        expect(mk_export_trie_find(&trie, "_foobarbaz", &export)).to.equal(MK_ENOT_FOUND);
+    });
+    
+    it(@"should enumerate the exports depth first", ^{
+        mk_export_trie_t trie;
+        mk_export_iterator_t iterator;
+        mk_export_iterator_frame_t frames[8];
+        mk_export_t export;
+        mk_error_t err;
+        char name[64];
+        
+        mk_export_trie_init_with_bytes(trie_bytes, sizeof(trie_bytes), &trie);
+        expect(mk_export_iterator_init(&trie, name, sizeof(name), frames, 8, &iterator)).to.equal(MK_ESUCCESS);
+        
+        NSMutableArray *names = [NSMutableArray array];
+        while (mk_export_iterator_next(&iterator, &export, &err))
+            [names addObject:@(export.name)];
+        expect(err).to.equal(MK_ESUCCESS);
+        expect(names).to.equal(@[@"_foo", @"_foobar", @"_bar", @"_r"]);
+        
+        // Too little storage for the names.
+        mk_export_iterator_init(&trie, name, 4, frames, 8, &iterator);
+        while (mk_export_iterator_next(&iterator, &export, &err));
+        expect(err).to.equal(MK_EOVERFLOW);
+        
+        // Too little storage for the depth of the trie.
+        mk_export_iterator_init(&trie, name, sizeof(name), frames, 2, &iterator);
+        while (mk_export_iterator_next(&iterator, &export, &err));
+        expect(err).to.equal(MK_EOVERFLOW);
+        
+        // Truncated.
+        mk_export_trie_init_with_bytes(trie_bytes, 20, &trie);
+        mk_export_iterator_init(&trie, name, sizeof(name), frames, 8, &iterator);
+        while (mk_export_iterator_next(&iterator, &export, &err));
+        expect(err).toNot.equal(MK_ESUCCESS);
+    });
+    
+    it(@"should look up every enumerated export", ^{
+        mk_memory_map_self_t memory_map;
+        mk_error_t err = mk_memory_map_self_init(NULL, &memory_map);
+        expect(err).to.equal(MK_ESUCCESS);
+        
+        // Use the largest export trie in this process.
+        mk_macho_t largest;
+        if (!find_largest_export_trie(&memory_map, &largest))
+            return;
+        
+        struct load_command *cmd = mk_macho_find_command(&largest, LC_DYLD_INFO_ONLY, NULL) ?: mk_macho_find_command(&largest, LC_DYLD_INFO, NULL);
+        mk_load_command_t load_command;
+        mk_segment_t link_edit;
+        mk_export_trie_t trie;
+        expect(mk_load_command_init(&largest, cmd, &load_command)).to.equal(MK_ESUCCESS);
+        expect(MKSpecFindLinkEditSegment(&largest, &link_edit)).to.beTruthy();
+        expect(mk_export_trie_init(&load_command, &link_edit, &trie)).to.equal(MK_ESUCCESS);
+        
+        char name[4096];
+        mk_export_iterator_frame_t frames[256];
+        mk_export_iterator_t iterator;
+        mk_export_t export;
+        NSMutableArray *names = [NSMutableArray array];
+        
+        mk_export_iterator_init(&trie, name, sizeof(name), frames, 256, &iterator);
+        while (mk_export_iterator_next(&iterator, &export, &err))
+            [names addObject:[NSData dataWithBytes:export.name length:strlen(export.name) + 1]];
+        expect(err).to.equal(MK_ESUCCESS);
+        
+        size_t found = 0;
+        for (NSData *exportName in names)
+            found += (mk_export_trie_find(&trie, exportName.bytes, &export) == MK_ESUCCESS);
+        expect(found).to.equal(names.count);
+        
+        mk_segment_free(&link_edit);
+        mk_macho_free(&largest);
+    });    
+    if (MKSpecBenchmarksEnabled()) it(@"should benchmark lookups against enumerating the exports", ^{
+        mk_memory_map_self_t memory_map;
+        mk_error_t err = mk_memory_map_self_init(NULL, &memory_map);
+        expect(err).to.equal(MK_ESUCCESS);
+        
+        mk_macho_t largest;
+        if (!find_largest_export_trie(&memory_map, &largest))
+            return;
+        
+        struct load_command *cmd = mk_macho_find_command(&largest, LC_DYLD_INFO_ONLY, NULL) ?: mk_macho_find_command(&largest, LC_DYLD_INFO, NULL);
+        mk_load_command_t load_command;
+        mk_segment_t link_edit;
+        mk_export_trie_t trie;
+        expect(mk_load_command_init(&largest, cmd, &load_command)).to.equal(MK_ESUCCESS);
+        expect(MKSpecFindLinkEditSegment(&largest, &link_edit)).to.beTruthy();
+        expect(mk_export_trie_init(&load_command, &link_edit, &trie)).to.equal(MK_ESUCCESS);
+        
+        char name[4096];
+        mk_export_iterator_frame_t frames[256];
+        mk_export_iterator_t iterator;
+        mk_export_t export;
+        NSMutableArray *names = [NSMutableArray array];
+        
+        uint64_t start = mach_absolute_time();
+        mk_export_iterator_init(&trie, name, sizeof(name), frames, 256, &iterator);
+        while (mk_export_iterator_next(&iterator, &export, &err))
+            [names addObject:[NSData dataWithBytes:export.name length:strlen(export.name) + 1]];
+        uint64_t end = mach_absolute_time();
+        MKSpecReportBenchmark([NSString stringWithFormat:@"export enumeration (%s, %lu exports)", mk_macho_get_name(&largest), (unsigned long)names.count], MKSpecNanosecondsPerIteration(start, end, 1));
+        
+        volatile size_t found = 0;
+        start = mach_absolute_time();
+        for (NSData *exportName in names)
+            found += (mk_export_trie_find(&trie, exportName.bytes, &export) == MK_ESUCCESS);
+        end = mach_absolute_time();
+        MKSpecReportBenchmark([NSString stringWithFormat:@"mk_export_trie_find (%s)", mk_macho_get_name(&largest)], MKSpecNanosecondsPerIteration(start, end, MAX(names.count, 1u)));
+        
+        mk_segment_free(&link_edit);
+        mk_macho_free(&largest);
+    });
+});
+
+SpecEnd
@@ -0,0 +1,222 @@
+//----------------------------------------------------------------------------//
+//|
+//|             MachOKit - A Lightweight Mach-O Parsing Library
+//|             function_starts_spec.m
+//|
+//|             D.V.
+//|             Copyright (c) 2014-2015 D.V. All rights reserved.
+//|
+//| Permission is hereby granted, free of charge, to any person obtaining a
+//| copy of this software and associated documentation files (the "Software"),
+//| to deal in the Software without restriction, including without limitation
+//| the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//| and/or sell copies of the Software, and to permit persons to whom the
+//| Software is furnished to do so, subject to the following conditions:
+//|
+//| The above copyright notice and this permission notice shall be included
+//| in all copies or substantial portions of the Software.
+//|
+//| THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+//| OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+//| MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+//| IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+//| CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+//| TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//| SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//----------------------------------------------------------------------------//
+
+
+#include <mach-o/dyld.h>
+#include <mach/mach_time.h>
+
+//|++++++++++++++++++++++++++++++++++++|//
+static size_t
+write_uleb128(uint8_t *output, uint64_t value)
+{
+    size_t length = 0;
+    do {
+        uint8_t byte = value & 0x7f;
+        value >>= 7;
+        if (value) byte |= 0x80;
+        output[length++] = byte;
+    } while (value);
+    return length;
+}
+
+SpecBegin(function_starts)
+
+describe(@"mk_function_starts_decode", ^{
+    const uint32_t count = 200000;
+    const mk_vm_address_t text_address = 0x100000000ULL;
+    __block uint8_t *table;
+    __block size_t table_length;
+    __block mk_vm_address_t *expected;
+    __block mk_vm_address_t *addresses;
+    
+    beforeAll(^{
+        // Mostly short deltas, as in a real table, with some long ones.
+        table = malloc(count * 4 + 1);
+        expected = malloc(count * sizeof(*expected));
+        addresses = malloc((count + 8) * sizeof(*addresses));
+        table_length = 0;
+        
+        mk_vm_address_t address = text_address;
+        srandom(2);
+        for (uint32_t i = 0; i < count; i++) {
+            long r = random() % 100;
+            uint64_t delta = (r < 80) ? 1 + random() % 127 : (r < 97) ? 128 + random() % 16000 : 20000 + random() % 5000000;
+            address += delta;
+            expected[i] = address;
+            table_length += write_uleb128(table + table_length, delta);
+        }
+        table[table_length++] = 0;
+    });
+    
+    afterAll(^{
+        free(table);
+        free(expected);
+        free(addresses);
+    });
+    
+    it(@"should decode the same addresses as the scalar decoder", ^{
+        mk_function_starts_decoder_t decoder;
+        uint32_t decoded = 0;
+        mk_error_t err = MK_ESUCCESS;
+        
+        mk_function_starts_decoder_init(&decoder, text_address);
+        size_t used = mk_function_starts_decode(&decoder, table, table_length, addresses, count + 8, &decoded, &err);
+        expect(err).to.equal(MK_ESUCCESS);
+        expect(used).to.equal(table_length);
+        expect(decoded).to.equal(count);
+        expect(decoder.finished).to.beTruthy();
+        expect(memcmp(addresses, expected, count * sizeof(*expected))).to.equal(0);
+        
+        mk_function_starts_decoder_init(&decoder, text_address);
+        used = mk_function_starts_decode_scalar(&decoder, table, table_length, addresses, count + 8, &decoded, &err);
+        expect(err).to.equal(MK_ESUCCESS);
+        expect(used).to.equal(table_length);
+        expect(decoded).to.equal(count);
+        expect(memcmp(addresses, expected, count * sizeof(*expected))).to.equal(0);
+    });
+    
+    it(@"should decode a table passed in pieces", ^{
+        for (size_t piece = 1; piece < 20; piece += 3) {
+            mk_function_starts_decoder_t decoder;
+            mk_function_starts_decoder_init(&decoder, text_address);
+            size_t offset = 0;
+            uint32_t total = 0;
+            
+            while (!decoder.finished && offset < table_length) {
+                uint32_t decoded = 0;
+                mk_error_t err = MK_ESUCCESS;
+                size_t length = MIN(piece, table_length - offset);
+                offset += mk_function_starts_decode(&decoder, table + offset, length, addresses + total, (uint32_t)(piece % 7 + 1), &decoded, &err);
+                expect(err).to.equal(MK_ESUCCESS);
+                if (err) break;
+                total += decoded;
+            }
+            
+            expect(total).to.equal(count);
+            expect(memcmp(addresses, expected, count * sizeof(*expected))).to.equal(0);
+        }
+    });
+    
+    it(@"should fail on a delta that overflows", ^{
+        uint8_t overflow[12];
+        memset(overflow, 0xff, 11);
+        overflow[11] = 0x01;
+        
+        mk_function_starts_decoder_t decoder;
+        uint32_t decoded = 0;
+        mk_error_t err = MK_ESUCCESS;
+        mk_function_starts_decoder_init(&decoder, 0);
+        mk_function_starts_decode(&decoder, overflow, sizeof(overflow), addresses, 4, &decoded, &err);
+        expect(err).to.equal(MK_EOVERFLOW);
+    });
+    
+    if (MKSpecBenchmarksEnabled()) it(@"should benchmark the decoder", ^{
+        const size_t iterations = 50;
+        volatile uint64_t sink = 0;
+        
+        uint64_t start = mach_absolute_time();
+        for (size_t i = 0; i < iterations; i++) {
+            mk_function_starts_decoder_t decoder;
+            uint32_t decoded = 0;
+            mk_function_starts_decoder_init(&decoder, text_address);
+            mk_function_starts_decode_scalar(&decoder, table, table_length, addresses, count + 8, &decoded, NULL);
+            sink += addresses[decoded - 1];
+        }
+        uint64_t end = mach_absolute_time();
+        double scalar = MKSpecNanosecondsPerIteration(start, end, iterations * count);
+        
+        start = mach_absolute_time();
+        for (size_t i = 0; i < iterations; i++) {
+            mk_function_starts_decoder_t decoder;
+            uint32_t decoded = 0;
+            mk_function_starts_decoder_init(&decoder, text_address);
+            mk_function_starts_decode(&decoder, table, table_length, addresses, count + 8, &decoded, NULL);
+            sink += addresses[decoded - 1];
+        }
+        end = mach_absolute_time();
+        double fast = MKSpecNanosecondsPerIteration(start, end, iterations * count);
+        
+        MKSpecReportBenchmark(@"mk_function_starts_decode_scalar", scalar);
+        MKSpecReportBenchmark(@"mk_function_starts_decode", fast);
+    });
+});
+
+describe(@"mk_function_starts_copy_addresses", ^{
+    __block mk_memory_map_self_t memory_map;
+    
+    beforeAll(^{
+        mk_error_t err = mk_memory_map_self_init(NULL, &memory_map);
+        expect(err).to.equal(MK_ESUCCESS);
+    });
+    
+    it(@"should find ascending function starts in all images in this process", ^{
+        for(uint32_t i=0; i<_dyld_image_count(); i++)
+        {
+            mk_macho_t macho;
+            mk_vm_address_t header = (mk_vm_address_t)_dyld_get_image_header(i);
+            mk_error_t err = mk_macho_init(NULL, _dyld_get_image_name(i), _dyld_get_image_vmaddr_slide(i), header, &memory_map, &macho);
+            expect(err).to.equal(MK_ESUCCESS);
+            if (err)
+                continue;
+            
+            struct load_command *cmd = mk_macho_find_command(&macho, LC_FUNCTION_STARTS, NULL);
+            mk_load_command_t load_command;
+            mk_segment_t link_edit;
+            if (cmd == NULL || mk_load_command_init(&macho, cmd, &load_command) != MK_ESUCCESS) {
+                mk_macho_free(&macho);
+                continue;
+            }
+            if (!MKSpecFindLinkEditSegment(&macho, &link_edit)) {
+                mk_macho_free(&macho);
+                continue;
+            }
+            
+            uint32_t total = 0;
+            err = mk_function_starts_copy_addresses(&load_command, &link_edit, NULL, 0, &total);
+            expect(err).to.equal(MK_ESUCCESS);
+            
+            mk_vm_address_t *starts = malloc(MAX(total, 1) * sizeof(*starts));
+            uint32_t copied = 0;
+            err = mk_function_starts_copy_addresses(&load_command, &link_edit, starts, total, &copied);
+            expect(err).to.equal(MK_ESUCCESS);
+            expect(copied).to.equal(total);
+            
+            // Function starts follow the Mach header, which is at the start
+            // of __TEXT.
+            for (uint32_t j = 0; j < copied; j++) {
+                expect(starts[j]).to.beGreaterThan(j ? starts[j - 1] : header);
+                if (starts[j] <= (j ? starts[j - 1] : header)) break;
+            }
+            
+            free(starts);
+            mk_segment_free(&link_edit);
+            mk_macho_free(&macho);
+        }
+    });
+});
+
+SpecEnd
@@ -33,10 +33,24 @@ SpecBegin(macho_image)
 
 describe(@"mk_macho_image", ^{
     __block mk_memory_map_self_t memory_map;
+    __block mk_context_t context;
+    __block mk_arena_t arena;
+    __block void *arena_buffer;
+    const size_t arena_size = 256 * 1024;
     
     beforeAll(^{
         mk_error_t err = mk_memory_map_self_init(NULL, &memory_map);
         expect(err).to.equal(MK_ESUCCESS);
+        
+        arena_buffer = malloc(arena_size);
+        expect(mk_arena_init(arena_buffer, arena_size, &arena)).to.equal(MK_ESUCCESS);
+        memset(&context, 0, sizeof(context));
+        context.arena = &arena;
+    });
+    
+    afterAll(^{
+        mk_arena_free(&arena);
+        free(arena_buffer);
     });
     
     it(@"should initialize with all images in this process", ^{
@@ -57,6 +71,148 @@ describe(@"mk_macho_image", ^{
             mk_macho_free(&macho);
         }
     });
+
+    it(@"should find the same load commands as a walk of the load commands", ^{
+        mk_macho_t macho;
+
+        for(uint32_t i=0; i<_dyld_image_count(); i++)
+        {
+            const struct mach_header *header = _dyld_get_image_header(i);
+            mk_error_t err = mk_macho_init(NULL, _dyld_get_image_name(i), _dyld_get_image_vmaddr_slide(i), (mk_vm_address_t)header, &memory_map, &macho);
+            expect(err).to.equal(MK_ESUCCESS);
+            if (err)
+                continue;
+            expect(macho.load_command_index_valid).to.beTruthy();
+
+            size_t header_size = (header->magic == MH_MAGIC_64) ? sizeof(struct mach_header_64) : sizeof(struct mach_header);
+            struct load_command *expected = (struct load_command*)((uintptr_t)header + header_size);
+            struct load_command *first_symtab = NULL;
+            struct load_command *cmd = NULL;
+            mk_vm_address_t host_address;
+            uint32_t count = 0;
+
+            while ((cmd = mk_macho_next_command(&macho, cmd, &host_address))) {
+                expect(cmd).to.equal(expected);
+                expect(host_address).to.equal((mk_vm_address_t)expected);
+                if (first_symtab == NULL && cmd->cmd == LC_SYMTAB)
+                    first_symtab = cmd;
+                expected = (struct load_command*)((uintptr_t)expected + expected->cmdsize);
+                count++;
+            }
+            expect(count).to.equal(header->ncmds);
+            expect(mk_macho_find_command(&macho, LC_SYMTAB, NULL)).to.equal(first_symtab);
+
+            uint32_t segments = 0;
+            uint32_t segment_cmd = (header->magic == MH_MAGIC_64) ? LC_SEGMENT_64 : LC_SEGMENT;
+            while ((cmd = mk_macho_next_command_type(&macho, cmd, segment_cmd, NULL)))
+                segments++;
+
+            __block uint32_t expected_segments = 0;
+            mk_macho_enumerate_commands(&macho, ^(struct load_command *command, uint32_t __unused index, mk_vm_address_t __unused address) {
+                if (command->cmd == segment_cmd)
+                    expected_segments++;
+            });
+            expect(segments).to.equal(expected_segments);
+
+            mk_macho_free(&macho);
+            expect(macho.load_commands == NULL).to.beTruthy();
+        }
+    });
+
+    it(@"should not depend on the context arena for the load command and section tables", ^{
+        mk_macho_t macho;
+        const struct mach_header *header = _dyld_get_image_header(0);
+        mk_error_t err = mk_macho_init(&context, _dyld_get_image_name(0), _dyld_get_image_vmaddr_slide(0), (mk_vm_address_t)header, &memory_map, &macho);
+        expect(err).to.equal(MK_ESUCCESS);
+        if (err) return;
+        
+        expect(macho.load_command_index_valid).to.beTruthy();
+        
+        // The tables are owned by the image, so reusing the arena must not
+        // invalidate them.
+        mk_arena_reset(&arena);
+        memset(arena_buffer, 0xFF, arena_size);
+        mk_arena_init(arena_buffer, arena_size, &arena);
+        
+        struct load_command *cmd = NULL;
+        uint32_t count = 0;
+        while ((cmd = mk_macho_next_command(&macho, cmd, NULL)))
+            count++;
+        expect(count).to.equal(header->ncmds);
+        expect(mk_macho_find_command(&macho, LC_SYMTAB, NULL)).to.equal(mk_macho_next_command_type(&macho, NULL, LC_SYMTAB, NULL));
+        
+        mk_macho_section_entry_t entry;
+        for (uint32_t n_sect = 1; n_sect <= mk_macho_get_section_count(&macho); n_sect++) {
+            expect(mk_macho_get_section(&macho, n_sect, &entry)).to.equal(MK_ESUCCESS);
+            expect(entry.section_offset).to.beLessThan(header->sizeofcmds + sizeof(struct mach_header_64));
+        }
+        
+        mk_macho_free(&macho);
+    });
+
+    it(@"should build a section table matching the section load commands", ^{
+        mk_macho_t macho;
+
+        for(uint32_t i=0; i<2 * _dyld_image_count(); i++)
+        {
+            // Each image is checked with its section table, and again with
+            // the table hidden, walking the segment load commands.
+            const struct mach_header *header = _dyld_get_image_header(i / 2);
+            mk_error_t err = mk_macho_init(NULL, _dyld_get_image_name(i / 2), _dyld_get_image_vmaddr_slide(i / 2), (mk_vm_address_t)header, &memory_map, &macho);
+            expect(err).to.equal(MK_ESUCCESS);
+            if (err)
+                continue;
+            expect(macho.sections != NULL).to.beTruthy();
+            
+            mk_macho_section_entry_t *table = macho.sections;
+            if (i % 2)
+                macho.sections = NULL;
+
+            uint32_t segment_cmd = (header->magic == MH_MAGIC_64) ? LC_SEGMENT_64 : LC_SEGMENT;
+            struct load_command *cmd = NULL;
+            uint32_t n_sect = 0;
+
+            while ((cmd = mk_macho_next_command_type(&macho, cmd, segment_cmd, NULL)))
+            {
+                bool is64 = (segment_cmd == LC_SEGMENT_64);
+                uint32_t nsects = is64 ? ((struct segment_command_64*)cmd)->nsects : ((struct segment_command*)cmd)->nsects;
+                uintptr_t sections = (uintptr_t)cmd + (is64 ? sizeof(struct segment_command_64) : sizeof(struct segment_command));
+
+                for (uint32_t j = 0; j < nsects && n_sect < MAX_SECT; j++) {
+                    uintptr_t section = sections + j * (is64 ? sizeof(struct section_64) : sizeof(struct section));
+                    uint64_t addr = is64 ? ((struct section_64*)section)->addr : ((struct section*)section)->addr;
+                    uint64_t size = is64 ? ((struct section_64*)section)->size : ((struct section*)section)->size;
+                    n_sect++;
+
+                    mk_macho_section_entry_t entry;
+                    expect(mk_macho_get_section(&macho, n_sect, &entry)).to.equal(MK_ESUCCESS);
+
+                    expect((uintptr_t)header + entry.section_offset).to.equal(section);
+                    expect((uintptr_t)header + entry.segment_offset).to.equal((uintptr_t)cmd);
+                    expect(entry.addr).to.equal(addr);
+                    expect(entry.size).to.equal(size);
+
+                    if (size > 0) {
+                        mk_macho_section_entry_t found_entry;
+                        uint32_t found = 0;
+                        expect(mk_macho_find_section_for_address(&macho, addr, &found_entry, &found)).to.equal(MK_ESUCCESS);
+                        expect(found).to.equal(n_sect);
+                        expect(found_entry.section_offset).to.equal(entry.section_offset);
+                        expect(mk_macho_find_section_for_address(&macho, addr + size - 1, &found_entry, &found)).to.equal(MK_ESUCCESS);
+                        expect(found).to.equal(n_sect);
+                    }
+                }
+            }
+
+            mk_macho_section_entry_t entry;
+            expect(mk_macho_get_section_count(&macho)).to.equal(n_sect);
+            expect(mk_macho_get_section(&macho, NO_SECT, &entry)).to.equal(MK_ENOT_FOUND);
+            expect(mk_macho_get_section(&macho, n_sect + 1, &entry)).to.equal(MK_ENOT_FOUND);
+
+            macho.sections = table;
+            mk_macho_free(&macho);
+        }
+    });
 });
 
 SpecEnd
\ No newline at end of file
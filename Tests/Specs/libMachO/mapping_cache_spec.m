@@ -0,0 +1,152 @@
+//----------------------------------------------------------------------------//
+//|
+//|             MachOKit - A Lightweight Mach-O Parsing Library
+//|             mapping_cache_spec.m
+//|
+//|             D.V.
+//|             Copyright (c) 2014-2015 D.V. All rights reserved.
+//|
+//| Permission is hereby granted, free of charge, to any person obtaining a
+//| copy of this software and associated documentation files (the "Software"),
+//| to deal in the Software without restriction, including without limitation
+//| the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//| and/or sell copies of the Software, and to permit persons to whom the
+//| Software is furnished to do so, subject to the following conditions:
+//|
+//| The above copyright notice and this permission notice shall be included
+//| in all copies or substantial portions of the Software.
+//|
+//| THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+//| OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+//| MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+//| IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+//| CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+//| TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//| SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//----------------------------------------------------------------------------//
+
+//◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
+// A fake backing store which 'maps' host addresses at a fixed local offset.
+// Host addresses at or above 0x10000 are only mappable one page at a time.
+//
+typedef struct {
+    int maps;
+    int unmaps;
+} fake_backing_t;
+
+static mk_error_t
+fake_map(void *backing, mk_vm_address_t host_address, mk_vm_size_t length, bool require_full, vm_address_t *local_address, mk_vm_size_t *mapped_length)
+{
+    ((fake_backing_t*)backing)->maps++;
+    *local_address = (vm_address_t)(0x10000000 + host_address);
+    *mapped_length = (!require_full && host_address >= 0x10000) ? 0x1000 : length;
+    return MK_ESUCCESS;
+}
+
+static void
+fake_unmap(void *backing, vm_address_t __unused local_address, mk_vm_size_t __unused length)
+{ ((fake_backing_t*)backing)->unmaps++; }
+
+
+SpecBegin(mapping_cache)
+
+describe(@"mapping_cache", ^{
+    __block fake_backing_t backing;
+    __block mk_mapping_cache_entry_t entries[4];
+    __block mk_mapping_cache_t cache;
+    
+    beforeEach(^{
+        memset(&backing, 0, sizeof(backing));
+        mk_error_t err = mk_mapping_cache_init(entries, 4, 0x1000, 0x3000, &backing, &fake_map, &fake_unmap, &cache);
+        expect(err).to.equal(MK_ESUCCESS);
+    });
+    
+    afterEach(^{
+        mk_mapping_cache_free(&cache);
+        expect(backing.unmaps).to.equal(backing.maps);
+    });
+    
+    it(@"should share a mapping between overlapping requests", ^{
+        mk_mapping_cache_entry_t *first, *second;
+        expect(mk_mapping_cache_acquire(&cache, 10, 100, true, &first)).to.equal(MK_ESUCCESS);
+        expect(mk_mapping_cache_acquire(&cache, 200, 100, true, &second)).to.equal(MK_ESUCCESS);
+        
+        expect(first == second).to.beTruthy();
+        expect(first->host_address).to.equal(0);
+        expect(first->length).to.equal(0x1000);
+        expect(first->refcount).to.equal(2);
+        expect(backing.maps).to.equal(1);
+        
+        mk_mapping_cache_statistics_t statistics = mk_mapping_cache_get_statistics(&cache);
+        expect(statistics.hits).to.equal(1);
+        expect(statistics.misses).to.equal(1);
+        
+        mk_mapping_cache_release(&cache, second);
+        mk_mapping_cache_release(&cache, first);
+    });
+    
+    it(@"should retain unreferenced mappings", ^{
+        mk_mapping_cache_entry_t *entry;
+        expect(mk_mapping_cache_acquire(&cache, 0x1000, 0x10, true, &entry)).to.equal(MK_ESUCCESS);
+        mk_mapping_cache_release(&cache, entry);
+        expect(mk_mapping_cache_acquire(&cache, 0x1008, 0x10, true, &entry)).to.equal(MK_ESUCCESS);
+        mk_mapping_cache_release(&cache, entry);
+        
+        expect(backing.maps).to.equal(1);
+        expect(backing.unmaps).to.equal(0);
+    });
+    
+    it(@"should evict the least recently used mapping to stay within budget", ^{
+        mk_mapping_cache_entry_t *a, *b, *c;
+        expect(mk_mapping_cache_acquire(&cache, 0x0000, 0x10, true, &a)).to.equal(MK_ESUCCESS);
+        expect(mk_mapping_cache_acquire(&cache, 0x1000, 0x10, true, &b)).to.equal(MK_ESUCCESS);
+        expect(mk_mapping_cache_acquire(&cache, 0x2000, 0x10, true, &c)).to.equal(MK_ESUCCESS);
+        mk_mapping_cache_release(&cache, a);
+        mk_mapping_cache_release(&cache, b);
+        
+        // Touch 'a' so that 'b' becomes the least recently used.
+        expect(mk_mapping_cache_acquire(&cache, 0x0000, 0x10, true, &a)).to.equal(MK_ESUCCESS);
+        mk_mapping_cache_release(&cache, a);
+        
+        mk_mapping_cache_entry_t *d;
+        expect(mk_mapping_cache_acquire(&cache, 0x5000, 0x10, true, &d)).to.equal(MK_ESUCCESS);
+        
+        mk_mapping_cache_statistics_t statistics = mk_mapping_cache_get_statistics(&cache);
+        expect(statistics.evictions).to.equal(1);
+        expect(statistics.cached_bytes).to.equal(0x3000);
+        
+        // 'a' should still be cached.
+        expect(mk_mapping_cache_acquire(&cache, 0x0000, 0x10, true, &a)).to.equal(MK_ESUCCESS);
+        expect(backing.maps).to.equal(4);
+        
+        mk_mapping_cache_release(&cache, a);
+        mk_mapping_cache_release(&cache, c);
+        mk_mapping_cache_release(&cache, d);
+    });
+    
+    it(@"should not evict referenced mappings", ^{
+        mk_mapping_cache_entry_t *a, *b;
+        expect(mk_mapping_cache_acquire(&cache, 0x0000, 0x3000, true, &a)).to.equal(MK_ESUCCESS);
+        expect(mk_mapping_cache_acquire(&cache, 0x8000, 0x10, true, &b)).to.equal(MK_EUNAVAILABLE);
+        expect(mk_mapping_cache_get_statistics(&cache).bypasses).to.equal(1);
+        mk_mapping_cache_release(&cache, a);
+    });
+    
+    it(@"should reuse truncated mappings for short requests only", ^{
+        mk_mapping_cache_entry_t *a, *b, *c;
+        expect(mk_mapping_cache_acquire(&cache, 0x10010, 0x1800, false, &a)).to.equal(MK_ESUCCESS);
+        expect(a->length).to.equal(0x1000);
+        
+        expect(mk_mapping_cache_acquire(&cache, 0x10020, 0x1800, false, &b)).to.equal(MK_ESUCCESS);
+        expect(b == a).to.beTruthy();
+        
+        expect(mk_mapping_cache_acquire(&cache, 0x10020, 0x1800, true, &c)).to.equal(MK_ESUCCESS);
+        expect(c == a).to.beFalsy();
+        
+        mk_mapping_cache_release(&cache, a);
+        mk_mapping_cache_release(&cache, b);
+        mk_mapping_cache_release(&cache, c);
+    });
+});
+
+SpecEnd
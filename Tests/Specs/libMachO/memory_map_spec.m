@@ -27,6 +27,37 @@
 
 #include <malloc/malloc.h>
 
+// Services each run of a mk_memory_map_copy_requests() from a buffer,
+// counting the runs.
+typedef struct {
+    const uint8_t *bytes;
+    mk_vm_size_t length;
+    size_t runs;
+} copy_spec_context_t;
+
+static void
+copy_spec_map_run(void *context, mk_vm_address_t address, mk_vm_size_t length, mk_memory_map_copy_run_c copy, void *state)
+{
+    copy_spec_context_t *spec_context = context;
+    
+    spec_context->runs++;
+    
+    if (address >= spec_context->length)
+        copy(state, 0, 0, MK_EBAD_ACCESS);
+    else
+        copy(state, (vm_address_t)(spec_context->bytes + address), MIN(length, spec_context->length - address), MK_ESUCCESS);
+}
+
+static mk_log_record_t last_log_record;
+
+//|++++++++++++++++++++++++++++++++++++|//
+static void
+record_logger(void* __unused context, void* reserved, mk_logging_level_t __unused level, const char* __unused file, int __unused line, const char* __unused function, const char* __unused msg, ...)
+{
+    if (reserved)
+        last_log_record = *(mk_log_record_t*)reserved;
+}
+
 SpecBegin(memory_map)
 
 describe(@"memory_map_self", ^{
@@ -210,4 +241,236 @@ describe(@"memory_map_task", ^{
     });
 });
 
+
+describe(@"memory_map_file", ^{
+    __block mk_memory_map_file_t memory_map;
+    __block NSString *path;
+    __block NSMutableData *contents;
+    
+    beforeAll(^{
+        contents = [[NSMutableData alloc] initWithLength:vm_page_size * 3 + 123];
+        memset(contents.mutableBytes, 0xAA, contents.length);
+        ((uint8_t*)contents.mutableBytes)[46] = 0xCC;
+        
+        path = [[NSTemporaryDirectory() stringByAppendingPathComponent:NSProcessInfo.processInfo.globallyUniqueString] retain];
+        expect([contents writeToFile:path atomically:NO]).to.beTruthy();
+        
+        mk_error_t err = mk_memory_map_file_init(path.fileSystemRepresentation, NULL, &memory_map);
+        expect(err).to.equal(MK_ESUCCESS);
+    });
+    
+    afterAll(^{
+        mk_memory_map_file_free(&memory_map);
+        [NSFileManager.defaultManager removeItemAtPath:path error:NULL];
+        [path release];
+        [contents release];
+    });
+    
+    ///////////////
+    // CORE TYPE //
+    ///////////////
+    
+    it(@"should be of type memory_map_file", ^{
+        const char * name = mk_type_name(&memory_map);
+        expect(strcmp(name, "memory_map_file")).to.equal(0);
+    });
+    
+    ////////////////
+    // MEMORY MAP //
+    ////////////////
+    
+    it(@"should map the entire file", ^{
+        expect(mk_memory_map_file_get_size(&memory_map)).to.equal(contents.length);
+        
+        __block mk_memory_object_t memory_object;
+        mk_error_t err = mk_memory_map_init_object(&memory_map, 0, 0, contents.length, true, &memory_object);
+        expect(err).to.equal(MK_ESUCCESS);
+        if (err)
+            return;
+        
+        expect(mk_memory_object_host_address(&memory_object)).to.equal(0);
+        expect(mk_memory_object_length(&memory_object)).to.equal(contents.length);
+        expect(memcmp((void*)mk_memory_object_address(&memory_object), contents.bytes, contents.length)).to.equal(0);
+        
+        mk_memory_map_free_object(&memory_map, &memory_object);
+    });
+    
+    it(@"should vend windows into the same mapping", ^{
+        mk_memory_object_t first, second;
+        expect(mk_memory_map_init_object(&memory_map, 0, 0, 100, true, &first)).to.equal(MK_ESUCCESS);
+        expect(mk_memory_map_init_object(&memory_map, 40, 6, 100, true, &second)).to.equal(MK_ESUCCESS);
+        
+        expect(mk_memory_object_address(&second) - mk_memory_object_address(&first)).to.equal(46);
+        expect(mk_memory_object_read_byte(&second, 0, 46, NULL, NULL)).to.equal(0xCC);
+        
+        mk_memory_map_free_object(&memory_map, &second);
+        mk_memory_map_free_object(&memory_map, &first);
+    });
+    
+    it(@"should honor require_full", ^{
+        mk_memory_object_t memory_object;
+        mk_vm_address_t tail = contents.length - 10;
+        
+        expect(mk_memory_map_init_object(&memory_map, 0, tail, 100, true, &memory_object)).to.equal(MK_EBAD_ACCESS);
+        
+        expect(mk_memory_map_init_object(&memory_map, 0, tail, 100, false, &memory_object)).to.equal(MK_ESUCCESS);
+        expect(mk_memory_object_length(&memory_object)).to.equal(10);
+        mk_memory_map_free_object(&memory_map, &memory_object);
+        
+        expect(mk_memory_map_init_object(&memory_map, 0, contents.length, 1, false, &memory_object)).to.equal(MK_EBAD_ACCESS);
+    });
+});
+
+describe(@"memory_map_copy_bytes_vector", ^{
+    __block mk_memory_map_file_t memory_map;
+    __block NSString *path;
+    __block NSMutableData *contents;
+    
+    beforeAll(^{
+        contents = [[NSMutableData alloc] initWithLength:vm_page_size * 8 + 123];
+        for (NSUInteger i = 0; i < contents.length; i++)
+            ((uint8_t*)contents.mutableBytes)[i] = (uint8_t)(i * 7);
+        
+        path = [[NSTemporaryDirectory() stringByAppendingPathComponent:NSProcessInfo.processInfo.globallyUniqueString] retain];
+        expect([contents writeToFile:path atomically:NO]).to.beTruthy();
+        
+        mk_error_t err = mk_memory_map_file_init(path.fileSystemRepresentation, NULL, &memory_map);
+        expect(err).to.equal(MK_ESUCCESS);
+    });
+    
+    afterAll(^{
+        mk_memory_map_file_free(&memory_map);
+        [NSFileManager.defaultManager removeItemAtPath:path error:NULL];
+        [path release];
+        [contents release];
+    });
+    
+    it(@"should copy overlapping and distant requests", ^{
+        uint8_t buffers[4][64];
+        mk_memory_map_copy_request_t requests[4] = {
+            { .offset = 0, .address = vm_page_size * 6, .length = 64, .buffer = buffers[0] },
+            { .offset = 32, .address = 0, .length = 64, .buffer = buffers[1] },
+            { .offset = 0, .address = 0, .length = 64, .buffer = buffers[2] },
+            { .offset = 10, .address = vm_page_size * 6, .length = 64, .buffer = buffers[3] },
+        };
+        
+        expect(mk_memory_map_copy_bytes_vector(&memory_map, requests, 4, true)).to.equal(MK_ESUCCESS);
+        
+        for (size_t i = 0; i < 4; i++) {
+            expect(requests[i].error).to.equal(MK_ESUCCESS);
+            expect(requests[i].copied).to.equal(64);
+            expect(memcmp(buffers[i], (uint8_t*)contents.bytes + requests[i].address + requests[i].offset, 64)).to.equal(0);
+        }
+    });
+    
+    it(@"should succeed for zero-length requests without copying", ^{
+        uint8_t buffer = 0x55;
+        mk_memory_map_copy_request_t requests[2] = {
+            { .offset = 0, .address = 16, .length = 0, .buffer = &buffer, .copied = 99, .error = MK_EINTERNAL_ERROR },
+            { .offset = 0, .address = contents.length * 2, .length = 0, .buffer = &buffer },
+        };
+        
+        expect(mk_memory_map_copy_bytes_vector(&memory_map, requests, 2, true)).to.equal(MK_ESUCCESS);
+        
+        expect(requests[0].error).to.equal(MK_ESUCCESS);
+        expect(requests[0].copied).to.equal(0);
+        expect(requests[1].error).to.equal(MK_ESUCCESS);
+        expect(buffer).to.equal(0x55);
+    });
+    
+    it(@"should honor require_full", ^{
+        uint8_t buffers[2][100];
+        mk_memory_map_copy_request_t requests[2] = {
+            { .offset = 0, .address = 0, .length = 100, .buffer = buffers[0] },
+            { .offset = 0, .address = contents.length - 10, .length = 100, .buffer = buffers[1] },
+        };
+        
+        expect(mk_memory_map_copy_bytes_vector(&memory_map, requests, 2, true)).to.equal(MK_EBAD_ACCESS);
+        expect(requests[0].error).to.equal(MK_ESUCCESS);
+        expect(requests[0].copied).to.equal(100);
+        expect(requests[1].error).to.equal(MK_EBAD_ACCESS);
+        expect(requests[1].copied).to.equal(0);
+        
+        expect(mk_memory_map_copy_bytes_vector(&memory_map, requests, 2, false)).to.equal(MK_ESUCCESS);
+        expect(requests[1].error).to.equal(MK_ESUCCESS);
+        expect(requests[1].copied).to.equal(10);
+        expect(memcmp(buffers[1], (uint8_t*)contents.bytes + contents.length - 10, 10)).to.equal(0);
+    });
+    
+    it(@"should pass a record describing a failed request to the logger", ^{
+        mk_context_t context = { .logger = &record_logger };
+        mk_memory_map_file_t logged_map;
+        uint8_t buffer[16];
+        mk_memory_map_copy_request_t request = { .offset = 4, .address = contents.length, .length = 16, .buffer = buffer };
+        
+        expect(mk_memory_map_file_init(path.fileSystemRepresentation, &context, &logged_map)).to.equal(MK_ESUCCESS);
+        
+        memset(&last_log_record, 0, sizeof(last_log_record));
+        expect(mk_memory_map_copy_bytes_vector(&logged_map, &request, 1, true)).to.equal(MK_EBAD_ACCESS);
+        expect(last_log_record.kind).to.equal(MK_LOG_RECORD_COPY_FAILED);
+        expect(last_log_record.code).to.equal(MK_EBAD_ACCESS);
+        expect(last_log_record.address).to.equal(contents.length + 4);
+        expect(last_log_record.length).to.equal(16);
+        expect(last_log_record.object == &logged_map).to.beTruthy();
+        
+        mk_memory_map_file_free(&logged_map);
+    });
+    
+    it(@"should reject requests that overflow", ^{
+        uint8_t buffer[16];
+        mk_memory_map_copy_request_t requests[2] = {
+            { .offset = 16, .address = MK_VM_ADDRESS_MAX - 8, .length = 16, .buffer = buffer },
+            { .offset = 0, .address = MK_VM_ADDRESS_MAX - 8, .length = 16, .buffer = buffer },
+        };
+        
+        expect(mk_memory_map_copy_bytes_vector(&memory_map, requests, 2, false)).toNot.equal(MK_ESUCCESS);
+        expect(requests[0].error).to.equal(MK_EOVERFLOW);
+        expect(requests[0].copied).to.equal(0);
+        expect(requests[1].error).to.equal(MK_EOVERFLOW);
+        expect(requests[1].copied).to.equal(0);
+    });
+    
+    it(@"should copy more unsorted requests than fit in a batch", ^{
+        const size_t count = 300;
+        uint32_t *values = calloc(count, sizeof(uint32_t));
+        mk_memory_map_copy_request_t *requests = calloc(count, sizeof(*requests));
+        
+        for (size_t i = 0; i < count; i++) {
+            requests[i].address = ((count - 1 - i) * 29) % (contents.length - sizeof(uint32_t));
+            requests[i].length = sizeof(uint32_t);
+            requests[i].buffer = &values[i];
+        }
+        
+        expect(mk_memory_map_copy_bytes_vector(&memory_map, requests, count, true)).to.equal(MK_ESUCCESS);
+        
+        for (size_t i = 0; i < count; i++) {
+            expect(requests[i].error).to.equal(MK_ESUCCESS);
+            expect(memcmp(&values[i], (uint8_t*)contents.bytes + requests[i].address, sizeof(uint32_t))).to.equal(0);
+        }
+        
+        free(requests);
+        free(values);
+    });
+    
+    it(@"should coalesce nearby requests into a single run", ^{
+        uint8_t buffers[4][8];
+        mk_memory_map_copy_request_t requests[4] = {
+            { .address = vm_page_size * 4, .length = 8, .buffer = buffers[0] },
+            { .address = 100, .length = 8, .buffer = buffers[1] },
+            { .address = 0, .length = 8, .buffer = buffers[2] },
+            { .address = vm_page_size * 4 + 8, .length = 0, .buffer = buffers[3] },
+        };
+        
+        copy_spec_context_t context = { .bytes = contents.bytes, .length = contents.length, .runs = 0 };
+        
+        expect(mk_memory_map_copy_requests(requests, 4, true, &copy_spec_map_run, &context)).to.equal(MK_ESUCCESS);
+        // One run for the first page, another for the request on page 4.  The
+        // zero-length request is not mapped.
+        expect(context.runs).to.equal(2);
+        
+        for (size_t i = 0; i < 3; i++)
+            expect(memcmp(buffers[i], (uint8_t*)contents.bytes + requests[i].address, 8)).to.equal(0);
+    });
+});
+
 SpecEnd
@@ -0,0 +1,172 @@
+//----------------------------------------------------------------------------//
+//|
+//|             MachOKit - A Lightweight Mach-O Parsing Library
+//|             memory_object_spec.m
+//|
+//|             D.V.
+//|             Copyright (c) 2014-2015 D.V. All rights reserved.
+//|
+//| Permission is hereby granted, free of charge, to any person obtaining a
+//| copy of this software and associated documentation files (the "Software"),
+//| to deal in the Software without restriction, including without limitation
+//| the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//| and/or sell copies of the Software, and to permit persons to whom the
+//| Software is furnished to do so, subject to the following conditions:
+//|
+//| The above copyright notice and this permission notice shall be included
+//| in all copies or substantial portions of the Software.
+//|
+//| THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+//| OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+//| MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+//| IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+//| CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+//| TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//| SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//----------------------------------------------------------------------------//
+
+
+#include <mach/mach_time.h>
+
+static NSUInteger log_record_count;
+static mk_log_record_t last_log_record;
+
+//|++++++++++++++++++++++++++++++++++++|//
+static void
+record_logger(void* __unused context, void* reserved, mk_logging_level_t __unused level, const char* __unused file, int __unused line, const char* __unused function, const char* __unused msg, ...)
+{
+    log_record_count++;
+    if (reserved)
+        last_log_record = *(mk_log_record_t*)reserved;
+}
+
+SpecBegin(memory_object)
+
+describe(@"inline readers", ^{
+    __block mk_memory_map_self_t memory_map;
+    __block mk_memory_object_t memory_object;
+    __block uint8_t *buffer;
+    __block mk_vm_address_t buffer_address;
+    const size_t buffer_size = 4096;
+    
+    beforeAll(^{
+        buffer = malloc(buffer_size);
+        for (size_t i = 0; i < buffer_size; i++)
+            buffer[i] = (uint8_t)(i * 7 + 3);
+        buffer_address = (mk_vm_address_t)buffer;
+        
+        mk_error_t err = mk_memory_map_self_init(NULL, &memory_map);
+        expect(err).to.equal(MK_ESUCCESS);
+        err = mk_memory_map_init_object(&memory_map, 0, buffer_address, buffer_size, true, &memory_object);
+        expect(err).to.equal(MK_ESUCCESS);
+    });
+    
+    afterAll(^{
+        mk_memory_map_free_object(&memory_map, &memory_object);
+        free(buffer);
+    });
+    
+    it(@"should produce the same results as the out-of-line readers", ^{
+        mk_data_model_ref data_model = mk_data_model_lp64();
+        const mk_byteorder_t *byte_order = mk_data_model_get_byte_order(data_model);
+        
+        // Walk off both ends of the object so the failure paths are compared
+        // as well.
+        for (mk_vm_offset_t offset = 0; offset < buffer_size + 16; offset += 3) {
+            mk_vm_address_t address = buffer_address - 8;
+            mk_error_t err1 = MK_ESUCCESS, err2 = MK_ESUCCESS;
+            
+            expect(mk_memory_object_read_byte_fast(&memory_object, offset, address, &err1)).to.equal(mk_memory_object_read_byte(&memory_object, offset, address, NULL, &err2));
+            expect(err1).to.equal(err2);
+            
+            expect(mk_memory_object_read_word_fast(&memory_object, offset, address, byte_order, &err1)).to.equal(mk_memory_object_read_word(&memory_object, offset, address, data_model, &err2));
+            expect(err1).to.equal(err2);
+            
+            expect(mk_memory_object_read_dword_fast(&memory_object, offset, address, byte_order, &err1)).to.equal(mk_memory_object_read_dword(&memory_object, offset, address, data_model, &err2));
+            expect(err1).to.equal(err2);
+            
+            expect(mk_memory_object_read_qword_fast(&memory_object, offset, address, byte_order, &err1)).to.equal(mk_memory_object_read_qword(&memory_object, offset, address, data_model, &err2));
+            expect(err1).to.equal(err2);
+            
+            expect(mk_memory_object_read_dword_swapped(&memory_object, offset, address, &err1)).to.equal(OSSwapInt32(mk_memory_object_read_dword(&memory_object, offset, address, NULL, &err2)));
+            expect(err1).to.equal(err2);
+        }
+    });
+    
+    if (MKSpecBenchmarksEnabled()) it(@"should benchmark the inline readers", ^{
+        const size_t iterations = 1000000;
+        const mk_vm_size_t span = buffer_size - sizeof(uint32_t);
+        mk_data_model_ref data_model = mk_data_model_lp64();
+        const mk_byteorder_t *byte_order = mk_data_model_get_byte_order(data_model);
+        volatile uint32_t sink = 0;
+        uint64_t start, end;
+        
+        start = mach_absolute_time();
+        for (size_t i = 0; i < iterations; i++)
+            sink += mk_memory_object_read_dword(&memory_object, i % span, buffer_address, data_model, NULL);
+        end = mach_absolute_time();
+        double slow = MKSpecNanosecondsPerIteration(start, end, iterations);
+        
+        start = mach_absolute_time();
+        for (size_t i = 0; i < iterations; i++)
+            sink += mk_memory_object_read_dword_fast(&memory_object, i % span, buffer_address, byte_order, NULL);
+        end = mach_absolute_time();
+        double fast = MKSpecNanosecondsPerIteration(start, end, iterations);
+        
+        MKSpecReportBenchmark(@"mk_memory_object_read_dword", slow);
+        MKSpecReportBenchmark(@"mk_memory_object_read_dword_fast", fast);
+    });
+});
+
+describe(@"error records", ^{
+    __block mk_context_t context;
+    __block mk_memory_map_self_t memory_map;
+    __block mk_memory_object_t memory_object;
+    __block uint8_t *buffer;
+    const size_t buffer_size = 4096;
+    
+    beforeAll(^{
+        buffer = malloc(buffer_size);
+        memset(&context, 0, sizeof(context));
+        context.logger = &record_logger;
+        
+        mk_error_t err = mk_memory_map_self_init(&context, &memory_map);
+        expect(err).to.equal(MK_ESUCCESS);
+        err = mk_memory_map_init_object(&memory_map, 0, (mk_vm_address_t)buffer, buffer_size, true, &memory_object);
+        expect(err).to.equal(MK_ESUCCESS);
+    });
+    
+    afterAll(^{
+        mk_memory_map_free_object(&memory_map, &memory_object);
+        free(buffer);
+    });
+    
+    it(@"should pass a record describing the failure to the logger", ^{
+        mk_error_t err;
+        mk_vm_address_t address = (mk_vm_address_t)buffer + buffer_size;
+        
+        log_record_count = 0;
+        context.logger = &record_logger;
+        mk_memory_object_remap_address(&memory_object, 0, address, 16, &err);
+        expect(err).to.equal(MK_EOUT_OF_RANGE);
+        expect(log_record_count).to.equal(1);
+        expect(last_log_record.kind).to.equal(MK_LOG_RECORD_RANGE_NOT_WITHIN);
+        expect(last_log_record.code).to.equal(MK_EOUT_OF_RANGE);
+        expect(last_log_record.address).to.equal(address);
+        expect(last_log_record.length).to.equal(16);
+        expect(last_log_record.object == &memory_object).to.beTruthy();
+    });
+    
+    it(@"should not log when the context has no logger", ^{
+        mk_error_t err;
+        
+        log_record_count = 0;
+        context.logger = NULL;
+        mk_memory_object_remap_address(&memory_object, 0, (mk_vm_address_t)buffer + buffer_size, 16, &err);
+        expect(err).to.equal(MK_EOUT_OF_RANGE);
+        expect(log_record_count).to.equal(0);
+        context.logger = &record_logger;
+    });
+});
+
+SpecEnd
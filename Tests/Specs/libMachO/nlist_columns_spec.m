@@ -0,0 +1,148 @@
+//----------------------------------------------------------------------------//
+//|
+//|             MachOKit - A Lightweight Mach-O Parsing Library
+//|             nlist_columns_spec.m
+//|
+//|             D.V.
+//|             Copyright (c) 2014-2015 D.V. All rights reserved.
+//|
+//| Permission is hereby granted, free of charge, to any person obtaining a
+//| copy of this software and associated documentation files (the "Software"),
+//| to deal in the Software without restriction, including without limitation
+//| the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//| and/or sell copies of the Software, and to permit persons to whom the
+//| Software is furnished to do so, subject to the following conditions:
+//|
+//| The above copyright notice and this permission notice shall be included
+//| in all copies or substantial portions of the Software.
+//|
+//| THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+//| OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+//| MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+//| IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+//| CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+//| TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//| SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//----------------------------------------------------------------------------//
+
+#include <mach/mach_time.h>
+
+//! Decodes the structures one field at a time, as the symbol classes do.
+static void nlist_columns_spec_decode_scalar(const uint8_t *nlists, uint32_t count, bool is_64_bit, const mk_byteorder_t *byte_order, mk_nlist_columns_t *columns)
+{
+    for (uint32_t i = 0; i < count; i++) {
+        if (is_64_bit) {
+            struct nlist_64 entry;
+            memcpy(&entry, nlists + i * sizeof(entry), sizeof(entry));
+            columns->strx[i] = mk_byteorder_swap32(byte_order, entry.n_un.n_strx);
+            columns->type[i] = entry.n_type;
+            columns->sect[i] = entry.n_sect;
+            columns->desc[i] = mk_byteorder_swap16(byte_order, entry.n_desc);
+            columns->value[i] = mk_byteorder_swap64(byte_order, entry.n_value);
+        } else {
+            struct nlist entry;
+            memcpy(&entry, nlists + i * sizeof(entry), sizeof(entry));
+            columns->strx[i] = mk_byteorder_swap32(byte_order, entry.n_un.n_strx);
+            columns->type[i] = entry.n_type;
+            columns->sect[i] = entry.n_sect;
+            columns->desc[i] = mk_byteorder_swap16(byte_order, (uint16_t)entry.n_desc);
+            columns->value[i] = mk_byteorder_swap32(byte_order, entry.n_value);
+        }
+    }
+}
+
+SpecBegin(nlist_columns)
+
+describe(@"mk_nlist_columns", ^{
+    const uint32_t count = 4099;
+    const uint32_t benchmark_count = 1000003;
+    __block NSMutableData *nlists;
+    
+    beforeAll(^{
+        nlists = [[NSMutableData alloc] initWithLength:(MKSpecBenchmarksEnabled() ? benchmark_count : count) * sizeof(struct nlist_64)];
+        arc4random_buf(nlists.mutableBytes, nlists.length);
+    });
+    
+    afterAll(^{
+        [nlists release];
+    });
+    
+    it(@"should decode the same fields as the scalar path", ^{
+        const mk_byteorder_t *byte_orders[] = { &mk_byteorder_direct, &mk_byteorder_swapped };
+        
+        for (int is_64_bit = 0; is_64_bit < 2; is_64_bit++)
+        for (size_t b = 0; b < 2; b++)
+        for (uint32_t n = 0; n <= 12; n++)
+        {
+            // Odd sizes exercise the scalar tail after the vector kernel.
+            uint32_t decode = (n == 12) ? count : n;
+            size_t storage_size = mk_nlist_columns_storage_size(decode);
+            NSMutableData *vectorStorage = [NSMutableData dataWithLength:storage_size];
+            NSMutableData *scalarStorage = [NSMutableData dataWithLength:storage_size];
+            
+            mk_nlist_columns_t expected;
+            expect(mk_nlist_columns_init(nlists.bytes, decode, is_64_bit, byte_orders[b], scalarStorage.mutableBytes, storage_size, &expected)).to.equal(MK_ESUCCESS);
+            nlist_columns_spec_decode_scalar(nlists.bytes, decode, is_64_bit, byte_orders[b], &expected);
+            
+            mk_nlist_columns_t columns;
+            expect(mk_nlist_columns_init(nlists.bytes, decode, is_64_bit, byte_orders[b], vectorStorage.mutableBytes, storage_size, &columns)).to.equal(MK_ESUCCESS);
+            
+            expect(columns.count).to.equal(decode);
+            expect([vectorStorage isEqualToData:scalarStorage]).to.beTruthy();
+        }
+    });
+    
+    if (MKSpecBenchmarksEnabled()) it(@"should benchmark the decoder against the scalar path", ^{
+        const mk_byteorder_t *byte_orders[] = { &mk_byteorder_direct, &mk_byteorder_swapped };
+        size_t storage_size = mk_nlist_columns_storage_size(benchmark_count);
+        NSMutableData *storage = [NSMutableData dataWithLength:storage_size];
+        
+        for (int is_64_bit = 0; is_64_bit < 2; is_64_bit++)
+        for (size_t b = 0; b < 2; b++)
+        {
+            NSString *name = [NSString stringWithFormat:@"%s, %s", is_64_bit ? "nlist_64" : "nlist", (b == 0) ? "direct" : "swapped"];
+            mk_nlist_columns_t columns;
+            expect(mk_nlist_columns_init(nlists.bytes, benchmark_count, is_64_bit, byte_orders[b], storage.mutableBytes, storage_size, &columns)).to.equal(MK_ESUCCESS);
+            
+            uint64_t start = mach_absolute_time();
+            nlist_columns_spec_decode_scalar(nlists.bytes, benchmark_count, is_64_bit, byte_orders[b], &columns);
+            uint64_t end = mach_absolute_time();
+            MKSpecReportBenchmark([NSString stringWithFormat:@"scalar nlist decode (%@)", name], MKSpecNanosecondsPerIteration(start, end, benchmark_count));
+            
+            start = mach_absolute_time();
+            mk_nlist_columns_init(nlists.bytes, benchmark_count, is_64_bit, byte_orders[b], storage.mutableBytes, storage_size, &columns);
+            end = mach_absolute_time();
+            MKSpecReportBenchmark([NSString stringWithFormat:@"mk_nlist_columns_init (%@)", name], MKSpecNanosecondsPerIteration(start, end, benchmark_count));
+        }
+    });
+    
+    it(@"should select symbols by type, section and value", ^{
+        size_t storage_size = mk_nlist_columns_storage_size(count);
+        NSMutableData *storage = [NSMutableData dataWithLength:storage_size];
+        mk_nlist_columns_t columns;
+        expect(mk_nlist_columns_init(nlists.bytes, count, true, &mk_byteorder_direct, storage.mutableBytes, storage_size, &columns)).to.equal(MK_ESUCCESS);
+        
+        mk_vm_range_t range = mk_vm_range_make(UINT64_C(1) << 62, UINT64_C(1) << 61);
+        uint32_t external = 0, section = 0, value = 0;
+        for (uint32_t i = 0; i < count; i++) {
+            external += ((columns.type[i] & N_EXT) == N_EXT);
+            section += (columns.sect[i] == 1);
+            value += (columns.value[i] >= range.location && columns.value[i] < range.location + range.length);
+        }
+        
+        uint32_t indices[16];
+        expect(mk_nlist_columns_select_type(&columns, N_EXT, N_EXT, indices, 16)).to.equal(external);
+        for (uint32_t i = 0; i < MIN(external, 16); i++)
+            expect(columns.type[indices[i]] & N_EXT).to.equal(N_EXT);
+        expect(mk_nlist_columns_select_section(&columns, 1, indices, 16)).to.equal(section);
+        expect(mk_nlist_columns_select_value(&columns, range, indices, 16)).to.equal(value);
+    });
+    
+    it(@"should reject storage that is too small", ^{
+        uint64_t storage[4];
+        mk_nlist_columns_t columns;
+        expect(mk_nlist_columns_init(nlists.bytes, 4, true, &mk_byteorder_direct, storage, sizeof(storage), &columns)).to.equal(MK_EINVAL);
+    });
+});
+
+SpecEnd
@@ -0,0 +1,278 @@
+//----------------------------------------------------------------------------//
+//|
+//|             MachOKit - A Lightweight Mach-O Parsing Library
+//|             symbol_index_spec.m
+//|
+//|             D.V.
+//|             Copyright (c) 2014-2015 D.V. All rights reserved.
+//|
+//| Permission is hereby granted, free of charge, to any person obtaining a
+//| copy of this software and associated documentation files (the "Software"),
+//| to deal in the Software without restriction, including without limitation
+//| the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//| and/or sell copies of the Software, and to permit persons to whom the
+//| Software is furnished to do so, subject to the following conditions:
+//|
+//| The above copyright notice and this permission notice shall be included
+//| in all copies or substantial portions of the Software.
+//|
+//| THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+//| OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+//| MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+//| IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+//| CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+//| TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//| SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//----------------------------------------------------------------------------//
+
+
+#include <mach-o/dyld.h>
+#include <mach/mach_time.h>
+#include <dlfcn.h>
+
+SpecBegin(symbol_index)
+
+describe(@"mk_symbol_index", ^{
+    __block mk_memory_map_self_t memory_map;
+    
+    beforeAll(^{
+        mk_error_t err = mk_memory_map_self_init(NULL, &memory_map);
+        expect(err).to.equal(MK_ESUCCESS);
+    });
+    
+    it(@"should find the same symbols as a walk of the symbol table", ^{
+        for(uint32_t i=0; i<_dyld_image_count(); i++)
+        {
+            mk_macho_t macho;
+            mk_error_t err = mk_macho_init(NULL, _dyld_get_image_name(i), _dyld_get_image_vmaddr_slide(i), (mk_vm_address_t)_dyld_get_image_header(i), &memory_map, &macho);
+            expect(err).to.equal(MK_ESUCCESS);
+            if (err)
+                continue;
+            
+            // The string table of images in the shared cache is the shared
+            // __LINKEDIT, which is too large to walk for every image.
+            if (mk_macho_is_from_shared_cache(&macho)) {
+                mk_macho_free(&macho);
+                continue;
+            }
+            
+            mk_segment_t link_edit;
+            bool found_link_edit = MKSpecFindLinkEditSegment(&macho, &link_edit);
+            
+            mk_symbol_table_t symbol_table;
+            mk_string_table_t string_table;
+            if (!found_link_edit ||
+                mk_symbol_table_init_with_segment(&link_edit, &symbol_table) != MK_ESUCCESS ||
+                mk_string_table_init_with_segment(&link_edit, &string_table) != MK_ESUCCESS) {
+                if (found_link_edit) mk_segment_free(&link_edit);
+                mk_macho_free(&macho);
+                continue;
+            }
+            
+            size_t storage_size = mk_symbol_index_storage_size(&symbol_table, MK_SYMBOL_INDEX_PREFIX_SEARCH);
+            void *storage = malloc(storage_size);
+            mk_symbol_index_t symbol_index;
+            
+            err = mk_symbol_index_init(&symbol_table, &string_table, MK_SYMBOL_INDEX_PREFIX_SEARCH, storage, storage_size, &symbol_index);
+            expect(err).to.equal(MK_ESUCCESS);
+            
+            if (err == MK_ESUCCESS) {
+                mk_symbol_table_enumerate_mach_symbols(&symbol_table, 0, ^(const mk_mach_nlist symbol, uint32_t index, mk_vm_address_t __unused host_address) {
+                    // n_strx is the first member of both nlist and nlist_64.
+                    uint32_t strx = symbol.nlist->n_un.n_strx;
+                    const char *name = mk_string_table_get_string_at_offset(&string_table, strx, NULL);
+                    if (strx == 0 || name == NULL || name[0] == '\0')
+                        return;
+                    
+                    uint32_t found_index = UINT32_MAX;
+                    mk_mach_nlist found = mk_symbol_index_find(&symbol_index, name, &found_index);
+                    expect(found.any).toNot.beNil();
+                    expect(found_index).to.beLessThanOrEqualTo(index);
+                    
+                    // Duplicate names resolve to the first symbol.
+                    if (found_index != index) {
+                        uint32_t found_strx = found.nlist->n_un.n_strx;
+                        expect(strcmp(mk_string_table_get_string_at_offset(&string_table, found_strx, NULL), name)).to.equal(0);
+                    }
+                });
+                
+                expect(mk_symbol_index_find(&symbol_index, "\x01 not a symbol", NULL).any).to.beNil();
+                
+                uint32_t first, count;
+                expect(mk_symbol_index_find_prefix(&symbol_index, "_", &first, &count)).to.equal(MK_ESUCCESS);
+                for (uint32_t position = first; position < first + count; position++) {
+                    mk_mach_nlist symbol = mk_symbol_index_get_sorted_symbol(&symbol_index, position, NULL);
+                    const char *name = mk_string_table_get_string_at_offset(&string_table, symbol.nlist->n_un.n_strx, NULL);
+                    expect(name[0]).to.equal('_');
+                }
+            }
+            
+            free(storage);
+            mk_segment_free(&link_edit);
+            mk_macho_free(&macho);
+        }
+    });
+});
+
+describe(@"mk_symbol_address_index", ^{
+    __block mk_memory_map_self_t memory_map;
+    __block mk_macho_t macho;
+    __block mk_segment_t link_edit;
+    __block mk_symbol_table_t symbol_table;
+    __block mk_symbol_address_index_t address_index;
+    __block void *storage;
+    
+    beforeAll(^{
+        mk_error_t err = mk_memory_map_self_init(NULL, &memory_map);
+        expect(err).to.equal(MK_ESUCCESS);
+        
+        // Index the image containing this spec.
+        Dl_info info;
+        dladdr((void*)&MKSpecFindLinkEditSegment, &info);
+        for(uint32_t i=0; i<_dyld_image_count(); i++) {
+            if (_dyld_get_image_header(i) != info.dli_fbase)
+                continue;
+            err = mk_macho_init(NULL, _dyld_get_image_name(i), _dyld_get_image_vmaddr_slide(i), (mk_vm_address_t)info.dli_fbase, &memory_map, &macho);
+            expect(err).to.equal(MK_ESUCCESS);
+        }
+        
+        expect(MKSpecFindLinkEditSegment(&macho, &link_edit)).to.beTruthy();
+        err = mk_symbol_table_init_with_segment(&link_edit, &symbol_table);
+        expect(err).to.equal(MK_ESUCCESS);
+        
+        size_t storage_size = mk_symbol_address_index_storage_size(mk_symbol_table_get_count(&symbol_table));
+        storage = malloc(storage_size);
+        err = mk_symbol_address_index_init(&symbol_table, storage, storage_size, &address_index);
+        expect(err).to.equal(MK_ESUCCESS);
+    });
+    
+    afterAll(^{
+        free(storage);
+        mk_segment_free(&link_edit);
+        mk_macho_free(&macho);
+    });
+    
+    it(@"should find the symbol containing an address", ^{
+        mk_vm_offset_t slide = mk_macho_get_slide(&macho);
+        
+        mk_symbol_table_enumerate_mach_symbols(&symbol_table, 0, ^(const mk_mach_nlist symbol, uint32_t index, mk_vm_address_t __unused host_address) {
+            uint8_t type = symbol.nlist->n_type;
+            if ((type & N_STAB) || (type & N_TYPE) != N_SECT)
+                return;
+            
+            uint64_t value = mk_macho_is_64_bit(&macho) ? symbol.nlist_64->n_value : symbol.nlist->n_value;
+            uint32_t found_index = UINT32_MAX;
+            mk_vm_range_t range;
+            mk_mach_nlist found = mk_symbol_address_index_find(&address_index, value + slide, &found_index, &range);
+            
+            // Another symbol may have been chosen for this address.
+            expect(found.any).toNot.beNil();
+            expect(range.location).to.equal(value + slide);
+            if (found_index != index) {
+                uint64_t found_value = mk_macho_is_64_bit(&macho) ? found.nlist_64->n_value : found.nlist->n_value;
+                expect(found_value).to.equal(value);
+            }
+        });
+        
+        uint32_t index = UINT32_MAX;
+        mk_vm_range_t range;
+        expect(mk_symbol_address_index_find(&address_index, (mk_vm_address_t)&MKSpecFindLinkEditSegment, &index, &range).any).toNot.beNil();
+        expect(mk_vm_range_contains_address(range, 0, (mk_vm_address_t)&MKSpecFindLinkEditSegment)).to.equal(MK_ESUCCESS);
+        
+        expect(mk_symbol_address_index_find(&address_index, 0, NULL, NULL).any).to.beNil();
+    });
+    
+    it(@"should find the same symbols as a walk of the symbol table", ^{
+        const size_t samples = 100;
+        bool is_64_bit = mk_macho_is_64_bit(&macho);
+        mk_vm_offset_t slide = mk_macho_get_slide(&macho);
+        
+        // The unslid address of every symbol with a defined address, sorted.
+        uint64_t *values = malloc(sizeof(uint64_t) * (mk_symbol_table_get_count(&symbol_table) ?: 1));
+        __block uint32_t value_count = 0;
+        mk_symbol_table_enumerate_mach_symbols(&symbol_table, 0, ^(const mk_mach_nlist symbol, uint32_t __unused index, mk_vm_address_t __unused host_address) {
+            if ((symbol.nlist->n_type & N_STAB) || (symbol.nlist->n_type & N_TYPE) != N_SECT)
+                return;
+            values[value_count++] = is_64_bit ? symbol.nlist_64->n_value : symbol.nlist->n_value;
+        });
+        qsort_b(values, value_count, sizeof(uint64_t), ^int(const void *a, const void *b) {
+            uint64_t lhs = *(const uint64_t*)a, rhs = *(const uint64_t*)b;
+            return (lhs > rhs) - (lhs < rhs);
+        });
+        
+        for (size_t i = 0; value_count > 0 && i < samples; i++) {
+            uint32_t k = (uint32_t)((i * 2654435761u) % value_count);
+            uint64_t value = values[k];
+            
+            // A symbol extends to the next symbol, or the end of its section.
+            uint64_t end = value + 1;
+            mk_macho_section_entry_t section;
+            if (mk_macho_find_section_for_address(&macho, value, &section, NULL) == MK_ESUCCESS)
+                end = section.addr + section.size;
+            for (uint32_t j = k + 1; j < value_count; j++) {
+                if (values[j] > value) {
+                    end = MIN(end, values[j]);
+                    break;
+                }
+            }
+            
+            // Every address within the extent of the symbol must map to the
+            // symbol, or another symbol at the same address.
+            mk_vm_address_t address = value + (i * 40503u) % (end - value);
+            mk_vm_range_t range;
+            mk_mach_nlist found = mk_symbol_address_index_find(&address_index, address + slide, NULL, &range);
+            expect(found.any).toNot.beNil();
+            if (found.any == NULL)
+                continue;
+            
+            expect(is_64_bit ? found.nlist_64->n_value : found.nlist->n_value).to.equal(value);
+            expect(range.location).to.equal(value + slide);
+        }
+        
+        free(values);
+    });
+    
+    if (MKSpecBenchmarksEnabled()) it(@"should benchmark 10M lookups against a walk of the symbol table", ^{
+        const size_t iterations = 10000000;
+        const size_t walk_iterations = 100;
+        uint32_t count = mk_symbol_address_index_get_count(&address_index);
+        if (count == 0) return;
+        
+        mk_vm_address_t first = address_index.addresses[0];
+        mk_vm_size_t span = address_index.addresses[count - 1] - first + 1;
+        bool is_64_bit = mk_macho_is_64_bit(&macho);
+        mk_vm_offset_t slide = mk_macho_get_slide(&macho);
+        volatile uint32_t sink = 0;
+        uint64_t start, end;
+        
+        start = mach_absolute_time();
+        for (size_t i = 0; i < walk_iterations; i++) {
+            mk_vm_address_t address = first + (i * 2654435761u) % span;
+            __block uint64_t best = 0;
+            __block uint32_t best_index = UINT32_MAX;
+            mk_symbol_table_enumerate_mach_symbols(&symbol_table, 0, ^(const mk_mach_nlist symbol, uint32_t index, mk_vm_address_t __unused host_address) {
+                if ((symbol.nlist->n_type & N_STAB) || (symbol.nlist->n_type & N_TYPE) != N_SECT)
+                    return;
+                uint64_t value = (is_64_bit ? symbol.nlist_64->n_value : symbol.nlist->n_value) + slide;
+                if (value <= address && value >= best) {
+                    best = value;
+                    best_index = index;
+                }
+            });
+            sink += best_index;
+        }
+        end = mach_absolute_time();
+        MKSpecReportBenchmark([NSString stringWithFormat:@"symbol table walk (%u symbols)", count], MKSpecNanosecondsPerIteration(start, end, walk_iterations));
+        
+        start = mach_absolute_time();
+        for (size_t i = 0; i < iterations; i++) {
+            uint32_t index = 0;
+            mk_symbol_address_index_find(&address_index, first + (i * 2654435761u) % span, &index, NULL);
+            sink += index;
+        }
+        end = mach_absolute_time();
+        MKSpecReportBenchmark([NSString stringWithFormat:@"mk_symbol_address_index_find (%u symbols)", count], MKSpecNanosecondsPerIteration(start, end, iterations));
+    });
+});
+
+SpecEnd
@@ -0,0 +1,58 @@
+//----------------------------------------------------------------------------//
+//|
+//|             MachOKit - A Lightweight Mach-O Parsing Library
+//|             MKSpecSupport.h
+//|
+//|             D.V.
+//|             Copyright (c) 2014-2015 D.V. All rights reserved.
+//|
+//| Permission is hereby granted, free of charge, to any person obtaining a
+//| copy of this software and associated documentation files (the "Software"),
+//| to deal in the Software without restriction, including without limitation
+//| the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//| and/or sell copies of the Software, and to permit persons to whom the
+//| Software is furnished to do so, subject to the following conditions:
+//|
+//| The above copyright notice and this permission notice shall be included
+//| in all copies or substantial portions of the Software.
+//|
+//| THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+//| OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+//| MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+//| IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+//| CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+//| TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//| SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//----------------------------------------------------------------------------//
+
+@import Foundation;
+#import <MachOKit/MachOKit.h>
+
+//----------------------------------------------------------------------------//
+#pragma mark -  Benchmarks
+//----------------------------------------------------------------------------//
+
+//! Returns \c YES if the \c MK_SPEC_BENCHMARKS environment variable is set.
+//! Benchmarks are opt-in and only report their measurements; they never
+//! assert on timings.
+FOUNDATION_EXTERN BOOL
+MKSpecBenchmarksEnabled(void);
+
+//! Converts a pair of \c mach_absolute_time() readings into nanoseconds per
+//! iteration.
+FOUNDATION_EXTERN double
+MKSpecNanosecondsPerIteration(uint64_t start, uint64_t end, size_t iterations);
+
+//! Reports a benchmark measurement.
+FOUNDATION_EXTERN void
+MKSpecReportBenchmark(NSString *name, double nanosecondsPerIteration);
+
+//----------------------------------------------------------------------------//
+#pragma mark -  libMachO
+//----------------------------------------------------------------------------//
+
+//! Initializes \a link_edit with the __LINKEDIT segment of \a macho.
+//! Returns \c false if the image has no __LINKEDIT segment.  The caller
+//! must free the segment.
+FOUNDATION_EXTERN bool
+MKSpecFindLinkEditSegment(mk_macho_t *macho, mk_segment_t *link_edit);
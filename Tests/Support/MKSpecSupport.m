@@ -0,0 +1,87 @@
+//----------------------------------------------------------------------------//
+//|
+//|             MachOKit - A Lightweight Mach-O Parsing Library
+//|             MKSpecSupport.m
+//|
+//|             D.V.
+//|             Copyright (c) 2014-2015 D.V. All rights reserved.
+//|
+//| Permission is hereby granted, free of charge, to any person obtaining a
+//| copy of this software and associated documentation files (the "Software"),
+//| to deal in the Software without restriction, including without limitation
+//| the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//| and/or sell copies of the Software, and to permit persons to whom the
+//| Software is furnished to do so, subject to the following conditions:
+//|
+//| The above copyright notice and this permission notice shall be included
+//| in all copies or substantial portions of the Software.
+//|
+//| THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+//| OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+//| MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+//| IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+//| CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+//| TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//| SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//----------------------------------------------------------------------------//
+
+#import "MKSpecSupport.h"
+#include <mach/mach_time.h>
+
+//----------------------------------------------------------------------------//
+#pragma mark -  Benchmarks
+//----------------------------------------------------------------------------//
+
+//|++++++++++++++++++++++++++++++++++++|//
+BOOL
+MKSpecBenchmarksEnabled(void)
+{
+    static BOOL enabled;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        enabled = (getenv("MK_SPEC_BENCHMARKS") != NULL);
+    });
+    return enabled;
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+double
+MKSpecNanosecondsPerIteration(uint64_t start, uint64_t end, size_t iterations)
+{
+    static mach_timebase_info_data_t timebase;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        mach_timebase_info(&timebase);
+    });
+    return (double)(end - start) * timebase.numer / timebase.denom / iterations;
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+void
+MKSpecReportBenchmark(NSString *name, double nanosecondsPerIteration)
+{
+    printf("[benchmark] %s: %.2f ns/iteration\n", name.UTF8String, nanosecondsPerIteration);
+}
+
+//----------------------------------------------------------------------------//
+#pragma mark -  libMachO
+//----------------------------------------------------------------------------//
+
+//|++++++++++++++++++++++++++++++++++++|//
+bool
+MKSpecFindLinkEditSegment(mk_macho_t *macho, mk_segment_t *link_edit)
+{
+    struct load_command *cmd = NULL;
+    
+    while ((cmd = mk_macho_next_command_type(macho, cmd, mk_macho_is_64_bit(macho) ? LC_SEGMENT_64 : LC_SEGMENT, NULL))) {
+        if (mk_segment_init_with_mach_load_command(macho, (void*)cmd, link_edit) != MK_ESUCCESS)
+            continue;
+        char name[17] = {0x0};
+        mk_segment_copy_name(link_edit, name);
+        if (strcmp(name, SEG_LINKEDIT) == 0)
+            return true;
+        mk_segment_free(link_edit);
+    }
+    
+    return false;
+}
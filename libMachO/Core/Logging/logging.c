@@ -60,4 +60,48 @@ const char* mk_string_for_logging_level(mk_logging_level_t level)
             break;
     }
     return levelString;
-}
\ No newline at end of file
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+void
+_mk_log_emit_record(mk_context_t *context, mk_logging_level_t level, const char *file, int line, const char *function, const mk_log_record_t *record)
+{
+#define EMIT(FORMAT, ...) do {                                              \
+    if (context)                                                            \
+        context->logger(context, (void*)record, level, file, line, function, \
+                        FORMAT, __VA_ARGS__);                               \
+    else {                                                                  \
+        fprintf(stdout, "[Mach-O Kit - %s] %s:%i ",                         \
+                mk_string_for_logging_level(level), file, line);            \
+        fprintf(stdout, FORMAT, __VA_ARGS__);                               \
+        fprintf(stdout, "\n");                                              \
+    }                                                                       \
+} while (0)
+    
+    char description[128] = "<unknown>";
+    if (record->object)
+        mk_type_copy_description(record->object, description, sizeof(description));
+    
+    switch (record->kind) {
+        case MK_LOG_RECORD_RANGE_NOT_WITHIN:
+            EMIT("Input range (offset address = 0x%" MK_VM_PRIxADDR ", length = %" MK_VM_PRIuSIZE ") is not within %s.", record->address, record->length, description);
+            break;
+        case MK_LOG_RECORD_RANGE_NOT_VALID:
+            EMIT("Input range (offset address = 0x%" MK_VM_PRIxADDR ", length = %" MK_VM_PRIuSIZE ") is not valid in this process.", record->address, record->length);
+            break;
+        case MK_LOG_RECORD_OFFSET_OVERFLOW:
+            EMIT("Arithmetic error %s when adding input offset %" MK_VM_PRIiOFFSET " to input address 0x%" MK_VM_PRIxADDR " of %s.", mk_error_string(record->code), (mk_vm_offset_t)record->length, record->address, description);
+            break;
+        case MK_LOG_RECORD_LENGTH_OVERFLOW:
+            EMIT("Arithmetic error %s when adding input length %" MK_VM_PRIuSIZE " to input address 0x%" MK_VM_PRIxADDR " of %s.", mk_error_string(record->code), record->length, record->address, description);
+            break;
+        case MK_LOG_RECORD_COPY_FAILED:
+            EMIT("Failed to copy input range (offset address = 0x%" MK_VM_PRIxADDR ", length = %" MK_VM_PRIuSIZE ") from %s.  Error %s.", record->address, record->length, description, mk_error_string(record->code));
+            break;
+        default:
+            EMIT("%s (address = 0x%" MK_VM_PRIxADDR ", length = %" MK_VM_PRIuSIZE ") in %s.", mk_error_string(record->code), record->address, record->length, description);
+            break;
+    }
+    
+#undef EMIT
+}
@@ -70,7 +70,47 @@ typedef enum {
     _MK_LOGGING_LEVEL_LAST  = _MK_LOGGING_LEVEL_COUNT-1
 } mk_logging_level_t;
 
+//◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
+//! The failures described by a \ref mk_log_record_t.
+//
+typedef enum {
+    //! The range [\c address, \c address + \c length) is not within
+    //! \c object.
+    MK_LOG_RECORD_RANGE_NOT_WITHIN = 1,
+    //! The range [\c address, \c address + \c length) is not valid in the
+    //! current process.
+    MK_LOG_RECORD_RANGE_NOT_VALID,
+    //! Adding an offset to \c address failed.  The offset is stored in
+    //! \c length.
+    MK_LOG_RECORD_OFFSET_OVERFLOW,
+    //! Adding \c length to \c address failed.
+    MK_LOG_RECORD_LENGTH_OVERFLOW,
+    //! A batched copy of the range [\c address, \c address + \c length)
+    //! out of \c object failed.
+    MK_LOG_RECORD_COPY_FAILED
+} mk_log_record_kind_t;
+
+//◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
+//! A structured description of a failed memory access.
+//!
+//! Records are captured where the failure is detected and are only turned
+//! into a message if a logger will receive it.  The record is passed to the
+//! logger in its \c reserved parameter.
+//
+typedef struct mk_log_record_s {
+    mk_log_record_kind_t kind;
+    //! The error returned to the caller.
+    mk_error_t code;
+    mk_vm_address_t address;
+    mk_vm_size_t length;
+    //! The object that was accessed.  May be \c NULL.
+    mk_type_ref object;
+} mk_log_record_t;
+
 //! Prototype for a logger function definition.
+//!
+//! \a reserved is either \c NULL or a pointer to the
+//! \ref mk_log_record_t that the message was formatted from.
 typedef void (*mk_logger_c)(void* context, void* reserved, mk_logging_level_t level,
                             const char * file, int line, const char * function,
                             const char* msg, ...);
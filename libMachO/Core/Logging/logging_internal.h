@@ -40,6 +40,20 @@
 //! @name       Logging Macros
 //----------------------------------------------------------------------------//
 
+//! @internal
+//! Evaluates to \c true if messages at \a LEVEL pass the compile time and
+//! runtime log levels.
+#define _mk_log_level_enabled(LEVEL)                                        \
+    (MK_LOGGING_LEVEL > 0 && mk_logging_level > 0 &&                        \
+     LEVEL >= MK_LOGGING_LEVEL && LEVEL >= mk_logging_level)
+
+//! @internal
+//! Evaluates to \c true if a message at \a LEVEL would be delivered.  A
+//! context without a logger discards all messages.  \a CONTEXT is only
+//! evaluated if the log level is active.
+#define _mk_log_enabled(CONTEXT, LEVEL)                                     \
+    (_mk_log_level_enabled(LEVEL) && (!(CONTEXT) || (CONTEXT)->logger))
+
 //! @internal
 //! Logs a message if the log level is active.
 //!
@@ -53,8 +67,7 @@
 //!         An optional arguments required by the format string
 #define _mk_log(CONTEXT, LEVEL, FORMAT, ...)                                \
     do {                                                                    \
-        if (MK_LOGGING_LEVEL > 0 && mk_logging_level > 0 &&                 \
-            LEVEL >= MK_LOGGING_LEVEL && LEVEL >= mk_logging_level)         \
+        if (_mk_log_enabled(CONTEXT, LEVEL))                                \
         {                                                                   \
             if (CONTEXT)                                                    \
                 CONTEXT->logger(                                            \
@@ -98,6 +111,54 @@
 #define _mkl_fatal(CONTEXT, FORMAT, ...)                                    \
     _mk_log(CONTEXT, MK_LOGGING_LEVEL_FATAL, FORMAT, ##__VA_ARGS__)
 
+//! @internal
+//! Logs the failure described by a \ref mk_log_record_t if the log level is
+//! active and a logger is attached.  Nothing is formatted otherwise.
+//!
+//! @param  CONTEXT
+//!         The \ref mk_context_s for the current file.
+//! @param  LEVEL
+//!         A log level.
+//! @param  KIND
+//!         A \ref mk_log_record_kind_t.
+//! @param  CODE
+//!         The \ref mk_error_t returned to the caller.
+//! @param  ADDRESS
+//!         The start of the range that was accessed.
+//! @param  LENGTH
+//!         The length of the range that was accessed, or the offset for
+//!         \ref MK_LOG_RECORD_OFFSET_OVERFLOW.
+//! @param  OBJECT
+//!         The object that was accessed, or \c NULL.
+#define _mk_log_record(CONTEXT, LEVEL, KIND, CODE, ADDRESS, LENGTH, OBJECT) \
+    do {                                                                    \
+        if (_mk_log_level_enabled(LEVEL))                                   \
+        {                                                                   \
+            mk_context_t *_mk_ctx = (CONTEXT);                              \
+            if (!_mk_ctx || _mk_ctx->logger) {                              \
+                mk_log_record_t _mk_record = {                              \
+                    KIND, CODE, ADDRESS, LENGTH, OBJECT                     \
+                };                                                          \
+                _mk_log_emit_record(_mk_ctx, LEVEL,                         \
+                    __FILE__, __LINE__, __PRETTY_FUNCTION__, &_mk_record);  \
+            }                                                               \
+        }                                                                   \
+} while (0)
+
+//! Shortcut for calling \ref _mk_log_record with
+//! \ref MK_LOGGING_LEVEL_ERROR.
+#define _mkl_error_record(CONTEXT, KIND, CODE, ADDRESS, LENGTH, OBJECT)     \
+    _mk_log_record(CONTEXT, MK_LOGGING_LEVEL_ERROR,                         \
+                   KIND, CODE, ADDRESS, LENGTH, OBJECT)
+
+//! @internal
+//! Formats \a record and delivers it to the logger of \a context, or to
+//! \c stdout if \a context is \c NULL.  Use \ref _mk_log_record instead.
+_mk_internal_extern void
+_mk_log_emit_record(mk_context_t *context, mk_logging_level_t level,
+                    const char *file, int line, const char *function,
+                    const mk_log_record_t *record);
+
 
 //----------------------------------------------------------------------------//
 #pragma mark -  Assertions
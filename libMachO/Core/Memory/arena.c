@@ -0,0 +1,212 @@
+//----------------------------------------------------------------------------//
+//|
+//|             MachOKit - A Lightweight Mach-O Parsing Library
+//|             arena.c
+//|
+//|             D.V.
+//|             Copyright (c) 2014-2015 D.V. All rights reserved.
+//|
+//| Permission is hereby granted, free of charge, to any person obtaining a
+//| copy of this software and associated documentation files (the "Software"),
+//| to deal in the Software without restriction, including without limitation
+//| the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//| and/or sell copies of the Software, and to permit persons to whom the
+//| Software is furnished to do so, subject to the following conditions:
+//|
+//| The above copyright notice and this permission notice shall be included
+//| in all copies or substantial portions of the Software.
+//|
+//| THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+//| OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+//| MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+//| IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+//| CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+//| TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//| SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//----------------------------------------------------------------------------//
+
+#include "core_internal.h"
+
+//----------------------------------------------------------------------------//
+#pragma mark -  Chunks
+//----------------------------------------------------------------------------//
+
+//|++++++++++++++++++++++++++++++++++++|//
+static void
+__mk_arena_enter_chunk(mk_arena_t *arena, mk_arena_chunk_t *chunk)
+{
+    arena->current = chunk;
+    arena->cursor = (uintptr_t)(chunk + 1);
+    arena->limit = (uintptr_t)chunk + chunk->size;
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+//! Attempts to carve \a size bytes at \a alignment from the current chunk.
+static void*
+__mk_arena_bump(mk_arena_t *arena, size_t size, size_t alignment)
+{
+    if (arena->current == NULL)
+        return NULL;
+    
+    uintptr_t start = (arena->cursor + (alignment - 1)) & ~(uintptr_t)(alignment - 1);
+    if (start < arena->cursor || start > arena->limit || size > arena->limit - start)
+        return NULL;
+    
+    arena->cursor = start + size;
+    return (void*)start;
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+//! Creates a chunk large enough for \a size bytes at \a alignment and links
+//! it after the current chunk.
+static bool
+__mk_arena_grow(mk_arena_t *arena, size_t size, size_t alignment)
+{
+    if (arena->allocate == NULL)
+        return false;
+    
+    size_t overhead = sizeof(mk_arena_chunk_t) + alignment - 1;
+    if (size > SIZE_MAX - overhead)
+        return false;
+    
+    size_t chunk_size = MAX(size + overhead, arena->chunk_size);
+    mk_arena_chunk_t *chunk = arena->allocate(arena->backing, chunk_size);
+    if (chunk == NULL)
+        return false;
+    
+    chunk->size = chunk_size;
+    chunk->owned = true;
+    
+    if (arena->current) {
+        chunk->next = arena->current->next;
+        arena->current->next = chunk;
+    } else {
+        chunk->next = arena->first;
+        arena->first = chunk;
+    }
+    
+    arena->statistics.reserved_bytes += chunk_size;
+    arena->statistics.chunk_allocations++;
+    
+    __mk_arena_enter_chunk(arena, chunk);
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+#pragma mark -  Creating An Arena
+//----------------------------------------------------------------------------//
+
+//|++++++++++++++++++++++++++++++++++++|//
+mk_error_t
+mk_arena_init_with_allocator(void *buffer, size_t size, size_t chunk_size,
+                             void *backing, mk_arena_allocate_c allocate, mk_arena_deallocate_c deallocate,
+                             mk_arena_t *arena)
+{
+    if (arena == NULL) return MK_EINVAL;
+    if ((allocate == NULL) != (deallocate == NULL)) return MK_EINVAL;
+    if (buffer == NULL && allocate == NULL) return MK_EINVAL;
+    
+    memset(arena, 0, sizeof(*arena));
+    
+    arena->chunk_size = chunk_size;
+    arena->backing = backing;
+    arena->allocate = allocate;
+    arena->deallocate = deallocate;
+    
+    if (buffer)
+    {
+        // The chunk header is placed at the start of the buffer.
+        uintptr_t start = ((uintptr_t)buffer + (__alignof__(mk_arena_chunk_t) - 1)) & ~(uintptr_t)(__alignof__(mk_arena_chunk_t) - 1);
+        uintptr_t end = (uintptr_t)buffer + size;
+        
+        if (end < (uintptr_t)buffer || start > end || end - start < sizeof(mk_arena_chunk_t))
+            return MK_EINVAL;
+        
+        mk_arena_chunk_t *chunk = (mk_arena_chunk_t*)start;
+        chunk->next = NULL;
+        chunk->size = (size_t)(end - start);
+        chunk->owned = false;
+        
+        arena->first = chunk;
+        arena->statistics.reserved_bytes = chunk->size;
+        
+        __mk_arena_enter_chunk(arena, chunk);
+    }
+    
+    return MK_ESUCCESS;
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+mk_error_t
+mk_arena_init(void *buffer, size_t size, mk_arena_t *arena)
+{
+    if (buffer == NULL) return MK_EINVAL;
+    
+    return mk_arena_init_with_allocator(buffer, size, 0, NULL, NULL, NULL, arena);
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+void
+mk_arena_free(mk_arena_t *arena)
+{
+    mk_arena_chunk_t *chunk = arena->first;
+    
+    while (chunk) {
+        mk_arena_chunk_t *next = chunk->next;
+        if (chunk->owned)
+            arena->deallocate(arena->backing, chunk, chunk->size);
+        chunk = next;
+    }
+    
+    memset(arena, 0, sizeof(*arena));
+}
+
+//----------------------------------------------------------------------------//
+#pragma mark -  Allocating Memory
+//----------------------------------------------------------------------------//
+
+//|++++++++++++++++++++++++++++++++++++|//
+void*
+mk_arena_alloc(mk_arena_t *arena, size_t size, size_t alignment)
+{
+    if (arena == NULL) return NULL;
+    if (alignment == 0 || (alignment & (alignment - 1))) return NULL;
+    
+    void *result = __mk_arena_bump(arena, size, alignment);
+    
+    // Chunks after the current chunk are left over from before the last
+    // reset.  Fill them before creating another.
+    while (result == NULL && arena->current && arena->current->next) {
+        __mk_arena_enter_chunk(arena, arena->current->next);
+        result = __mk_arena_bump(arena, size, alignment);
+    }
+    
+    if (result == NULL && __mk_arena_grow(arena, size, alignment))
+        result = __mk_arena_bump(arena, size, alignment);
+    
+    if (result == NULL) {
+        arena->statistics.failures++;
+        return NULL;
+    }
+    
+    arena->statistics.allocations++;
+    arena->statistics.used_bytes += size;
+    
+    return result;
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+void
+mk_arena_reset(mk_arena_t *arena)
+{
+    if (arena->first)
+        __mk_arena_enter_chunk(arena, arena->first);
+    
+    arena->statistics.allocations = 0;
+    arena->statistics.used_bytes = 0;
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+mk_arena_statistics_t
+mk_arena_get_statistics(mk_arena_t *arena)
+{ return arena->statistics; }
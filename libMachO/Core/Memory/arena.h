@@ -0,0 +1,191 @@
+//----------------------------------------------------------------------------//
+//|
+//|             MachOKit - A Lightweight Mach-O Parsing Library
+//! @file       arena.h
+//!
+//! @author     D.V.
+//! @copyright  Copyright (c) 2014-2015 D.V. All rights reserved.
+//|
+//| Permission is hereby granted, free of charge, to any person obtaining a
+//| copy of this software and associated documentation files (the "Software"),
+//| to deal in the Software without restriction, including without limitation
+//| the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//| and/or sell copies of the Software, and to permit persons to whom the
+//| Software is furnished to do so, subject to the following conditions:
+//|
+//| The above copyright notice and this permission notice shall be included
+//| in all copies or substantial portions of the Software.
+//|
+//| THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+//| OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+//| MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+//| IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+//| CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+//| TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//| SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//----------------------------------------------------------------------------//
+
+//----------------------------------------------------------------------------//
+//! @defgroup ARENA Arena
+//! @ingroup MEMORY
+//!
+//! An arena hands out memory by advancing a cursor through one or more
+//! chunks, and releases everything it handed out at once.  It is intended
+//! for parse state which shares a lifetime, such as the segments and
+//! sections of an image.
+//!
+//! The arena does not allocate memory itself.  The owner supplies an initial
+//! buffer, a pair of callbacks which create and destroy additional chunks,
+//! or both.  An arena without callbacks fails allocations once its buffer
+//! is exhausted.
+//!
+//! Resetting an arena retains its chunks, so an arena which is reset
+//! between images stops calling the owner's callbacks once it has grown to
+//! the size of the largest image.
+//!
+//! Arenas are not thread-safe.
+//----------------------------------------------------------------------------//
+
+#ifndef _arena_h
+#define _arena_h
+
+//! @addtogroup ARENA
+//! @{
+//!
+
+//----------------------------------------------------------------------------//
+#pragma mark -  Types
+//! @name       Types
+//----------------------------------------------------------------------------//
+
+//! Prototype for the function invoked by an arena to create a new chunk of
+//! \a size bytes.  The returned memory must be aligned for any type.  Return
+//! \c NULL if the chunk can not be created.
+typedef void* (*mk_arena_allocate_c)(void *backing, size_t size);
+
+//! Prototype for the function invoked by an arena to destroy a chunk
+//! previously created by the \ref mk_arena_allocate_c function.
+typedef void (*mk_arena_deallocate_c)(void *backing, void *chunk, size_t size);
+
+//◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
+//! @internal
+//
+typedef struct mk_arena_chunk_s {
+    struct mk_arena_chunk_s *next;
+    // The size of the chunk, including this header.
+    size_t size;
+    // true if the chunk was created by the allocate callback.
+    bool owned;
+} mk_arena_chunk_t;
+
+//◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
+//! Counters maintained by an arena.
+//
+typedef struct {
+    //! The number of allocations since the arena was last reset.
+    uint64_t allocations;
+    //! The number of bytes handed out since the arena was last reset,
+    //! excluding alignment padding.
+    size_t used_bytes;
+    //! The total size of the chunks held by the arena.
+    size_t reserved_bytes;
+    //! The number of times the allocate callback has been invoked.
+    uint64_t chunk_allocations;
+    //! The number of allocations which could not be satisfied.
+    uint64_t failures;
+} mk_arena_statistics_t;
+
+//◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
+//! @internal
+//
+typedef struct mk_arena_s {
+    // All chunks, in the order they are filled.
+    mk_arena_chunk_t *first;
+    // The chunk allocations are currently made from.
+    mk_arena_chunk_t *current;
+    // The next free byte, and the end of the current chunk.
+    uintptr_t cursor;
+    uintptr_t limit;
+    // The minimum size of a chunk created by the allocate callback.
+    size_t chunk_size;
+    // Backing store.
+    void *backing;
+    mk_arena_allocate_c allocate;
+    mk_arena_deallocate_c deallocate;
+    // Counters.
+    mk_arena_statistics_t statistics;
+} mk_arena_t;
+
+
+//----------------------------------------------------------------------------//
+#pragma mark -  Creating An Arena
+//! @name       Creating An Arena
+//----------------------------------------------------------------------------//
+
+//! Initializes an arena which allocates from \a buffer, and fails once the
+//! buffer is exhausted.
+//!
+//! @param  buffer
+//!         Storage for the arena.  Must remain valid until the arena is
+//!         freed.  A small part of the buffer is used for bookkeeping.
+//! @param  size
+//!         The size of \a buffer.
+_mk_export mk_error_t
+mk_arena_init(void *buffer, size_t size, mk_arena_t *arena);
+
+//! Initializes an arena which allocates from \a buffer, if provided, and
+//! then from chunks created by the \a allocate callback.
+//!
+//! @param  buffer
+//!         Optional storage for the first chunk.  Must remain valid until the
+//!         arena is freed.
+//! @param  size
+//!         The size of \a buffer.
+//! @param  chunk_size
+//!         The minimum size of each chunk created by the \a allocate
+//!         callback.  Larger chunks are created for allocations which
+//!         would not fit.
+//! @param  backing
+//!         Passed to the \a allocate and \a deallocate callbacks.
+_mk_export mk_error_t
+mk_arena_init_with_allocator(void *buffer, size_t size, size_t chunk_size,
+                             void *backing, mk_arena_allocate_c allocate, mk_arena_deallocate_c deallocate,
+                             mk_arena_t *arena);
+
+//! Destroys every chunk created by the allocate callback.  All memory
+//! handed out by \a arena becomes invalid.
+_mk_export void
+mk_arena_free(mk_arena_t *arena);
+
+
+//----------------------------------------------------------------------------//
+#pragma mark -  Allocating Memory
+//! @name       Allocating Memory
+//----------------------------------------------------------------------------//
+
+//! Returns \a size bytes aligned to \a alignment, which must be a power of
+//! two.  Returns \c NULL if the arena is exhausted and can not grow.
+_mk_export void*
+mk_arena_alloc(mk_arena_t *arena, size_t size, size_t alignment);
+
+//! Allocates storage for \a COUNT instances of \a TYPE from \a ARENA.
+#define mk_arena_alloc_array(ARENA, TYPE, COUNT) \
+    ((TYPE*)((COUNT) > SIZE_MAX / sizeof(TYPE) ? NULL : mk_arena_alloc(ARENA, sizeof(TYPE) * (COUNT), __alignof__(TYPE))))
+
+//! Allocates storage for an instance of \a TYPE from \a ARENA.
+#define mk_arena_alloc_type(ARENA, TYPE) \
+    mk_arena_alloc_array(ARENA, TYPE, 1)
+
+//! Releases everything handed out by \a arena in one step.  The chunks are
+//! retained and reused by subsequent allocations.
+_mk_export void
+mk_arena_reset(mk_arena_t *arena);
+
+//! Returns the counters maintained by \a arena.
+_mk_export mk_arena_statistics_t
+mk_arena_get_statistics(mk_arena_t *arena);
+
+
+//! @} ARENA !//
+
+#endif /* _arena_h */
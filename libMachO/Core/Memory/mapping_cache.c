@@ -0,0 +1,252 @@
+//----------------------------------------------------------------------------//
+//|
+//|             MachOKit - A Lightweight Mach-O Parsing Library
+//|             mapping_cache.c
+//|
+//|             D.V.
+//|             Copyright (c) 2014-2015 D.V. All rights reserved.
+//|
+//| Permission is hereby granted, free of charge, to any person obtaining a
+//| copy of this software and associated documentation files (the "Software"),
+//| to deal in the Software without restriction, including without limitation
+//| the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//| and/or sell copies of the Software, and to permit persons to whom the
+//| Software is furnished to do so, subject to the following conditions:
+//|
+//| The above copyright notice and this permission notice shall be included
+//| in all copies or substantial portions of the Software.
+//|
+//| THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+//| OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+//| MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+//| IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+//| CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+//| TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//| SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//----------------------------------------------------------------------------//
+
+#include "core_internal.h"
+
+//----------------------------------------------------------------------------//
+#pragma mark -  Recently Used List
+//----------------------------------------------------------------------------//
+
+//|++++++++++++++++++++++++++++++++++++|//
+static void
+__mk_mapping_cache_unlink(mk_mapping_cache_t *cache, mk_mapping_cache_entry_t *entry)
+{
+    if (entry->prev) entry->prev->next = entry->next;
+    else cache->head = entry->next;
+    
+    if (entry->next) entry->next->prev = entry->prev;
+    else cache->tail = entry->prev;
+    
+    entry->prev = entry->next = NULL;
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+static void
+__mk_mapping_cache_push_front(mk_mapping_cache_t *cache, mk_mapping_cache_entry_t *entry)
+{
+    entry->prev = NULL;
+    entry->next = cache->head;
+    
+    if (cache->head) cache->head->prev = entry;
+    else cache->tail = entry;
+    
+    cache->head = entry;
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+static void
+__mk_mapping_cache_evict(mk_mapping_cache_t *cache, mk_mapping_cache_entry_t *entry)
+{
+    __mk_mapping_cache_unlink(cache, entry);
+    
+    cache->unmap(cache->backing, entry->local_address, entry->length);
+    cache->statistics.cached_entries--;
+    cache->statistics.cached_bytes -= entry->length;
+    
+    entry->length = 0;
+    entry->next = cache->free_list;
+    cache->free_list = entry;
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+//! Evicts unreferenced entries, least recently used first, until an entry is
+//! free and \a length additional bytes fit within the budget.
+static bool
+__mk_mapping_cache_make_room(mk_mapping_cache_t *cache, mk_vm_size_t length)
+{
+    if (length > cache->byte_budget)
+        return false;
+    
+    mk_mapping_cache_entry_t *entry = cache->tail;
+    
+    while (entry && (cache->free_list == NULL || cache->statistics.cached_bytes > cache->byte_budget - length)) {
+        mk_mapping_cache_entry_t *prev = entry->prev;
+        
+        if (entry->refcount == 0) {
+            __mk_mapping_cache_evict(cache, entry);
+            cache->statistics.evictions++;
+        }
+        
+        entry = prev;
+    }
+    
+    return (cache->free_list != NULL && cache->statistics.cached_bytes <= cache->byte_budget - length);
+}
+
+//----------------------------------------------------------------------------//
+#pragma mark -  Creating A Mapping Cache
+//----------------------------------------------------------------------------//
+
+//|++++++++++++++++++++++++++++++++++++|//
+mk_error_t
+mk_mapping_cache_init(mk_mapping_cache_entry_t *entries, uint32_t entry_count,
+                      mk_vm_size_t page_size, mk_vm_size_t byte_budget,
+                      void *backing, mk_mapping_cache_map_c map, mk_mapping_cache_unmap_c unmap,
+                      mk_mapping_cache_t *cache)
+{
+    if (cache == NULL) return MK_EINVAL;
+    if (entries == NULL || entry_count == 0) return MK_EINVAL;
+    if (page_size == 0 || (page_size & (page_size - 1))) return MK_EINVAL;
+    if (map == NULL || unmap == NULL) return MK_EINVAL;
+    
+    memset(cache, 0, sizeof(*cache));
+    memset(entries, 0, sizeof(*entries) * entry_count);
+    
+    for (uint32_t i = 0; i < entry_count; i++)
+        entries[i].next = (i + 1 < entry_count) ? &entries[i + 1] : NULL;
+    
+    cache->entries = entries;
+    cache->entry_count = entry_count;
+    cache->free_list = entries;
+    cache->page_size = page_size;
+    cache->byte_budget = byte_budget;
+    cache->backing = backing;
+    cache->map = map;
+    cache->unmap = unmap;
+    
+    return MK_ESUCCESS;
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+void
+mk_mapping_cache_free(mk_mapping_cache_t *cache)
+{
+    mk_mapping_cache_flush(cache);
+    
+    cache->entries = NULL;
+    cache->entry_count = 0;
+    cache->free_list = NULL;
+}
+
+//----------------------------------------------------------------------------//
+#pragma mark -  Acquiring Mappings
+//----------------------------------------------------------------------------//
+
+//|++++++++++++++++++++++++++++++++++++|//
+mk_error_t
+mk_mapping_cache_acquire(mk_mapping_cache_t *cache, mk_vm_address_t host_address, mk_vm_size_t length,
+                         bool require_full, mk_mapping_cache_entry_t **entry)
+{
+    mk_vm_size_t page_mask = cache->page_size - 1;
+    
+    // Search for an existing mapping, most recently used first.
+    for (mk_mapping_cache_entry_t *candidate = cache->head; candidate; candidate = candidate->next)
+    {
+        if (host_address < candidate->host_address)
+            continue;
+        
+        mk_vm_size_t slide = host_address - candidate->host_address;
+        if (slide >= candidate->length)
+            continue;
+        
+        // A truncated mapping already extends as far as the backing store
+        // would allow.
+        if (candidate->length - slide < length && (require_full || !candidate->truncated))
+            continue;
+        
+        candidate->refcount++;
+        __mk_mapping_cache_unlink(cache, candidate);
+        __mk_mapping_cache_push_front(cache, candidate);
+        
+        cache->statistics.hits++;
+        *entry = candidate;
+        return MK_ESUCCESS;
+    }
+    
+    cache->statistics.misses++;
+    
+    // Compute the page-aligned range to map.
+    mk_vm_address_t aligned_address = host_address & ~page_mask;
+    mk_vm_size_t aligned_length = (host_address - aligned_address) + length;
+    if (aligned_length < length || aligned_length + page_mask < aligned_length) {
+        // Overflow.  Only a short mapping can be satisfied.
+        if (require_full)
+            return MK_EOVERFLOW;
+        aligned_length = MK_VM_SIZE_MAX & ~page_mask;
+    } else
+        aligned_length = (aligned_length + page_mask) & ~page_mask;
+    if (MK_VM_ADDRESS_MAX - aligned_length < aligned_address) {
+        if (require_full)
+            return MK_EOVERFLOW;
+        aligned_length = (MK_VM_ADDRESS_MAX - aligned_address) & ~page_mask;
+    }
+    
+    if (!__mk_mapping_cache_make_room(cache, aligned_length)) {
+        cache->statistics.bypasses++;
+        return MK_EUNAVAILABLE;
+    }
+    
+    vm_address_t local_address;
+    mk_vm_size_t mapped_length;
+    mk_error_t err = cache->map(cache->backing, aligned_address, aligned_length, require_full, &local_address, &mapped_length);
+    if (err != MK_ESUCCESS)
+        return err;
+    
+    mk_mapping_cache_entry_t *new_entry = cache->free_list;
+    cache->free_list = new_entry->next;
+    
+    new_entry->host_address = aligned_address;
+    new_entry->length = mapped_length;
+    new_entry->local_address = local_address;
+    new_entry->refcount = 1;
+    new_entry->truncated = (mapped_length < aligned_length);
+    __mk_mapping_cache_push_front(cache, new_entry);
+    
+    cache->statistics.cached_entries++;
+    cache->statistics.cached_bytes += mapped_length;
+    
+    *entry = new_entry;
+    return MK_ESUCCESS;
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+void
+mk_mapping_cache_release(mk_mapping_cache_t *cache, mk_mapping_cache_entry_t *entry)
+{
+#pragma unused (cache)
+    _mk_assert(entry->refcount > 0, ((mk_context_t*)NULL), "Over-release of a mapping cache entry.");
+    entry->refcount--;
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+void
+mk_mapping_cache_flush(mk_mapping_cache_t *cache)
+{
+    mk_mapping_cache_entry_t *entry = cache->tail;
+    
+    while (entry) {
+        mk_mapping_cache_entry_t *prev = entry->prev;
+        if (entry->refcount == 0)
+            __mk_mapping_cache_evict(cache, entry);
+        entry = prev;
+    }
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+mk_mapping_cache_statistics_t
+mk_mapping_cache_get_statistics(mk_mapping_cache_t *cache)
+{ return cache->statistics; }
@@ -0,0 +1,205 @@
+//----------------------------------------------------------------------------//
+//|
+//|             MachOKit - A Lightweight Mach-O Parsing Library
+//! @file       mapping_cache.h
+//!
+//! @author     D.V.
+//! @copyright  Copyright (c) 2014-2015 D.V. All rights reserved.
+//|
+//| Permission is hereby granted, free of charge, to any person obtaining a
+//| copy of this software and associated documentation files (the "Software"),
+//| to deal in the Software without restriction, including without limitation
+//| the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//| and/or sell copies of the Software, and to permit persons to whom the
+//| Software is furnished to do so, subject to the following conditions:
+//|
+//| The above copyright notice and this permission notice shall be included
+//| in all copies or substantial portions of the Software.
+//|
+//| THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+//| OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+//| MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+//| IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+//| CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+//| TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//| SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//----------------------------------------------------------------------------//
+
+//----------------------------------------------------------------------------//
+//! @defgroup MAPPING_CACHE Mapping Cache
+//! @ingroup MEMORY
+//!
+//! A mapping cache retains page-aligned mappings created by a memory map so
+//! that overlapping requests can share a single mapping.  Cached mappings
+//! are reference counted; unreferenced mappings are retained until they are
+//! evicted in least-recently-used order to make room for new mappings.
+//!
+//! The cache does not create mappings itself.  The owner supplies a pair of
+//! callbacks which create and destroy mappings in the backing store.  The
+//! cache also does not allocate memory.  The owner supplies the storage for
+//! the cache entries, which bounds the number of mappings that may be cached
+//! at one time.
+//!
+//! Mapping caches are not thread-safe.  Acquiring a mapping reorders the
+//! recently-used list, and reference counts are updated without atomics, so
+//! the owner must serialize every call on a cache, including
+//! \ref mk_mapping_cache_release.
+//----------------------------------------------------------------------------//
+
+#ifndef _mapping_cache_h
+#define _mapping_cache_h
+
+//! @addtogroup MAPPING_CACHE
+//! @{
+//!
+
+//----------------------------------------------------------------------------//
+#pragma mark -  Types
+//! @name       Types
+//----------------------------------------------------------------------------//
+
+//! Prototype for the function invoked by a mapping cache to create a new
+//! mapping of \a length bytes at the page-aligned \a host_address.  If
+//! \a require_full is \c false, the mapping may be shorter than \a length.
+//! On success, the implementation should set \a local_address to the
+//! process-relative address of the mapping and \a mapped_length to the number
+//! of bytes that were mapped.
+typedef mk_error_t (*mk_mapping_cache_map_c)(void *backing, mk_vm_address_t host_address, mk_vm_size_t length, bool require_full, vm_address_t *local_address, mk_vm_size_t *mapped_length);
+
+//! Prototype for the function invoked by a mapping cache to destroy a
+//! mapping previously created by the \ref mk_mapping_cache_map_c function.
+typedef void (*mk_mapping_cache_unmap_c)(void *backing, vm_address_t local_address, mk_vm_size_t length);
+
+//◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
+//! @internal
+//
+typedef struct mk_mapping_cache_entry_s {
+    // The page-aligned host-relative address of the mapping.
+    mk_vm_address_t host_address;
+    // The length of the mapping.  Zero if this entry is unused.
+    mk_vm_size_t length;
+    // The process-relative address of the mapping.
+    vm_address_t local_address;
+    // The number of outstanding references to this mapping.
+    uint32_t refcount;
+    // true if the backing store returned a shorter mapping than was requested.
+    bool truncated;
+    // Links in the recently-used list (or the free list, if unused).
+    struct mk_mapping_cache_entry_s *prev;
+    struct mk_mapping_cache_entry_s *next;
+} mk_mapping_cache_entry_t;
+
+//◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
+//! Counters maintained by a mapping cache.
+//
+typedef struct {
+    //! The number of requests satisfied by an existing mapping.
+    uint64_t hits;
+    //! The number of requests which required a new mapping.
+    uint64_t misses;
+    //! The number of mappings destroyed to make room for new mappings.
+    uint64_t evictions;
+    //! The number of requests which could not be cached because the cache
+    //! was full of referenced mappings, or the mapping exceeded the byte
+    //! budget.
+    uint64_t bypasses;
+    //! The number of mappings currently held by the cache.
+    uint32_t cached_entries;
+    //! The total size of the mappings currently held by the cache.
+    mk_vm_size_t cached_bytes;
+} mk_mapping_cache_statistics_t;
+
+//◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
+//! @internal
+//
+typedef struct mk_mapping_cache_s {
+    // Caller-provided entry storage.
+    mk_mapping_cache_entry_t *entries;
+    uint32_t entry_count;
+    // Most recently used entry.
+    mk_mapping_cache_entry_t *head;
+    // Least recently used entry.
+    mk_mapping_cache_entry_t *tail;
+    // Unused entries.
+    mk_mapping_cache_entry_t *free_list;
+    // The alignment of cached mappings.  Must be a power of two.
+    mk_vm_size_t page_size;
+    // The maximum total size of the cached mappings.
+    mk_vm_size_t byte_budget;
+    // Backing store.
+    void *backing;
+    mk_mapping_cache_map_c map;
+    mk_mapping_cache_unmap_c unmap;
+    // Counters.
+    mk_mapping_cache_statistics_t statistics;
+} mk_mapping_cache_t;
+
+
+//----------------------------------------------------------------------------//
+#pragma mark -  Creating A Mapping Cache
+//! @name       Creating A Mapping Cache
+//----------------------------------------------------------------------------//
+
+//! Initializes a mapping cache.
+//!
+//! @param  entries
+//!         Storage for \a entry_count cache entries.  Must remain valid until
+//!         the cache is freed.
+//! @param  entry_count
+//!         The maximum number of mappings which may be cached.
+//! @param  page_size
+//!         The alignment of cached mappings.  Must be a power of two.
+//! @param  byte_budget
+//!         The maximum total size of the cached mappings.
+//! @param  backing
+//!         Passed to the \a map and \a unmap callbacks.
+_mk_export mk_error_t
+mk_mapping_cache_init(mk_mapping_cache_entry_t *entries, uint32_t entry_count,
+                      mk_vm_size_t page_size, mk_vm_size_t byte_budget,
+                      void *backing, mk_mapping_cache_map_c map, mk_mapping_cache_unmap_c unmap,
+                      mk_mapping_cache_t *cache);
+
+//! Destroys all mappings held by \a cache.  All mappings must have been
+//! released prior to calling this function.
+_mk_export void
+mk_mapping_cache_free(mk_mapping_cache_t *cache);
+
+
+//----------------------------------------------------------------------------//
+#pragma mark -  Acquiring Mappings
+//! @name       Acquiring Mappings
+//----------------------------------------------------------------------------//
+
+//! Returns a referenced cache entry whose mapping contains \a length bytes
+//! starting at the host-relative \a host_address.  A new mapping is created
+//! if no cached mapping contains the range.  If \a require_full is \c false,
+//! the returned mapping may be shorter than \a length.
+//!
+//! Returns \ref MK_EUNAVAILABLE if the mapping can not be cached.  Callers
+//! should fall back to creating an uncached mapping.
+//!
+//! This function is not thread-safe.
+_mk_export mk_error_t
+mk_mapping_cache_acquire(mk_mapping_cache_t *cache, mk_vm_address_t host_address, mk_vm_size_t length,
+                         bool require_full, mk_mapping_cache_entry_t **entry);
+
+//! Releases a reference to \a entry obtained from
+//! \ref mk_mapping_cache_acquire.  The mapping remains cached until it is
+//! evicted.
+//!
+//! This function is not thread-safe.
+_mk_export void
+mk_mapping_cache_release(mk_mapping_cache_t *cache, mk_mapping_cache_entry_t *entry);
+
+//! Destroys all unreferenced mappings held by \a cache.
+_mk_export void
+mk_mapping_cache_flush(mk_mapping_cache_t *cache);
+
+//! Returns the counters maintained by \a cache.
+_mk_export mk_mapping_cache_statistics_t
+mk_mapping_cache_get_statistics(mk_mapping_cache_t *cache);
+
+
+//! @} MAPPING_CACHE !//
+
+#endif /* _mapping_cache_h */
@@ -97,6 +97,45 @@ __mk_memory_map_copy_bytes(struct mk_memory_map_s* self, mk_vm_offset_t offset,
     return (vm_size_t)MIN(length, (mk_vm_size_t)mappingLength);
 }
 
+//|++++++++++++++++++++++++++++++++++++|//
+static void
+__mk_memory_map_map_run(void *context, mk_vm_address_t address, mk_vm_size_t length, mk_memory_map_copy_run_c copy, void *state)
+{
+    struct mk_memory_map_s *self = context;
+    mk_memory_object_t memory_object;
+    
+    // The memory object may be short; the requests are checked against
+    // require_full individually.
+    mk_error_t err = mk_memory_map_init_object(self, 0, address, length, false, &memory_object);
+    if (err) {
+        copy(state, 0, 0, err);
+        return;
+    }
+    
+    copy(state, mk_memory_object_address(&memory_object), mk_memory_object_length(&memory_object), MK_ESUCCESS);
+    mk_memory_map_free_object(self, &memory_object);
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+static mk_error_t
+__mk_memory_map_copy_bytes_vector(struct mk_memory_map_s* self, mk_memory_map_copy_request_t *requests, size_t count, bool require_full)
+{
+    mk_error_t err = mk_memory_map_copy_requests(requests, count, require_full, &__mk_memory_map_map_run, self);
+    
+    for (size_t i = 0; i < count && err; i++) {
+        if (requests[i].error == MK_ESUCCESS)
+            continue;
+        
+        // Report the offset address when it can be computed.
+        mk_vm_address_t address = requests[i].address;
+        mk_vm_address_apply_offset(address, requests[i].offset, &address);
+        _mkl_error_record(mk_type_get_context(self), MK_LOG_RECORD_COPY_FAILED, requests[i].error, address, requests[i].length, self);
+        break;
+    }
+    
+    return err;
+}
+
 //|++++++++++++++++++++++++++++++++++++|//
 static uint8_t
 __mk_memory_map_read_byte(struct mk_memory_map_s* self, mk_vm_offset_t offset, mk_vm_address_t address, mk_data_model_ref data_model, mk_error_t* error)
@@ -124,7 +163,7 @@ __mk_memory_map_read_word(struct mk_memory_map_s* self, mk_vm_offset_t offset, m
         return 0;
     
     if (data_model.data_model)
-        return mk_data_model_get_byte_order(data_model)->swap16( retValue );
+        return mk_byteorder_swap16(mk_data_model_get_byte_order(data_model), retValue);
     else
         return retValue;
 }
@@ -141,7 +180,7 @@ __mk_memory_map_read_dword(struct mk_memory_map_s* self, mk_vm_offset_t offset,
         return 0;
     
     if (data_model.data_model)
-        return mk_data_model_get_byte_order(data_model)->swap32( retValue );
+        return mk_byteorder_swap32(mk_data_model_get_byte_order(data_model), retValue);
     else
         return retValue;
 }
@@ -158,7 +197,7 @@ __mk_memory_map_read_qword(struct mk_memory_map_s* self, mk_vm_offset_t offset,
         return 0;
     
     if (data_model.data_model)
-        return mk_data_model_get_byte_order(data_model)->swap64( retValue );
+        return mk_byteorder_swap64(mk_data_model_get_byte_order(data_model), retValue);
     else
         return retValue;
 }
@@ -171,6 +210,7 @@ const struct _mk_memory_map_vtable _mk_memory_map_class = {
     .free_object                = &__mk_memory_map_free_object,
     .has_mapping                = &__mk_memory_map_has_mapping,
     .copy_bytes                 = &__mk_memory_map_copy_bytes,
+    .copy_bytes_vector          = &__mk_memory_map_copy_bytes_vector,
     .read_byte                  = &__mk_memory_map_read_byte,
     .read_word                  = &__mk_memory_map_read_word,
     .read_dword                 = &__mk_memory_map_read_dword,
@@ -207,6 +247,10 @@ bool mk_memory_map_has_mapping(mk_memory_map_ref map, mk_vm_offset_t offset, mk_
 vm_size_t mk_memory_map_copy_bytes(mk_memory_map_ref map, mk_vm_offset_t offset, mk_vm_address_t address, void* buffer, mk_vm_size_t length, bool require_full, mk_error_t* error)
 { MK_TYPE_INVOKE(map, memory_map, copy_bytes)(map, offset, address, buffer, length, require_full, error); }
 
+//|++++++++++++++++++++++++++++++++++++|//
+mk_error_t mk_memory_map_copy_bytes_vector(mk_memory_map_ref map, mk_memory_map_copy_request_t *requests, size_t count, bool require_full)
+{ MK_TYPE_INVOKE(map, memory_map, copy_bytes_vector)(map, requests, count, require_full); }
+
 //|++++++++++++++++++++++++++++++++++++|//
 uint8_t mk_memory_map_read_byte(mk_memory_map_ref map, mk_vm_offset_t offset, mk_vm_address_t address, mk_data_model_ref data_model, mk_error_t* error)
 { MK_TYPE_INVOKE(map, memory_map, read_byte)(map, offset, address, data_model, error); }
@@ -222,3 +266,148 @@ uint32_t mk_memory_map_read_dword(mk_memory_map_ref map, mk_vm_offset_t offset,
 //|++++++++++++++++++++++++++++++++++++|//
 uint64_t mk_memory_map_read_qword(mk_memory_map_ref map, mk_vm_offset_t offset, mk_vm_address_t address, mk_data_model_ref data_model, mk_error_t* error)
 { MK_TYPE_INVOKE(map, memory_map, read_qword)(map, offset, address, data_model, error); }
+
+//----------------------------------------------------------------------------//
+#pragma mark -  Batched Copies
+//----------------------------------------------------------------------------//
+
+//! The number of requests sorted together by mk_memory_map_copy_requests().
+#define MK_MEMORY_MAP_COPY_BATCH    128
+
+//◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
+// The run of requests passed through a mk_memory_map_map_run_c.
+typedef struct {
+    mk_memory_map_copy_request_t *requests;
+    // Indices into requests, sorted by start address.
+    const uint8_t *run;
+    size_t run_count;
+    mk_vm_address_t run_start;
+    bool require_full;
+    bool serviced;
+} __mk_memory_map_copy_run_t;
+
+//|++++++++++++++++++++++++++++++++++++|//
+static inline mk_vm_address_t
+__mk_memory_map_request_start(const mk_memory_map_copy_request_t *request)
+{ return request->address + request->offset; }
+
+//|++++++++++++++++++++++++++++++++++++|//
+static void
+__mk_memory_map_copy_run(void *state, vm_address_t address, mk_vm_size_t length, mk_error_t error)
+{
+    __mk_memory_map_copy_run_t *run = state;
+    
+    run->serviced = true;
+    
+    for (size_t i = 0; i < run->run_count; i++)
+    {
+        mk_memory_map_copy_request_t *request = &run->requests[run->run[i]];
+        
+        request->copied = 0;
+        
+        if (error) {
+            request->error = error;
+            continue;
+        }
+        
+        // Safe - the start of every request in the run is at or after
+        // run_start.
+        mk_vm_size_t slide = __mk_memory_map_request_start(request) - run->run_start;
+        mk_vm_size_t available = (slide < length) ? length - slide : 0;
+        
+        if (available == 0 || (run->require_full && available < request->length)) {
+            request->error = MK_EBAD_ACCESS;
+            continue;
+        }
+        
+        request->copied = MIN(available, request->length);
+        memcpy(request->buffer, (void*)(address + (vm_address_t)slide), (size_t)request->copied);
+        request->error = MK_ESUCCESS;
+    }
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+mk_error_t
+mk_memory_map_copy_requests(mk_memory_map_copy_request_t *requests, size_t count, bool require_full, mk_memory_map_map_run_c map_run, void *context)
+{
+    if (requests == NULL && count > 0) return MK_EINVAL;
+    if (map_run == NULL) return MK_EINVAL;
+    
+    // Requests separated by less than a page share the page anyway.
+    const mk_vm_size_t gap = vm_page_size;
+    uint8_t sorted[MK_MEMORY_MAP_COPY_BATCH];
+    
+    for (size_t base = 0; base < count; base += MK_MEMORY_MAP_COPY_BATCH)
+    {
+        mk_memory_map_copy_request_t *batch = requests + base;
+        size_t batch_count = MIN(count - base, (size_t)MK_MEMORY_MAP_COPY_BATCH);
+        size_t pending = 0;
+        
+        // Validate each request and insert it into sorted.  Requests are
+        // usually made in address order, in which case each insertion is a
+        // single comparison.
+        for (size_t i = 0; i < batch_count; i++)
+        {
+            mk_memory_map_copy_request_t *request = &batch[i];
+            mk_vm_address_t start;
+            
+            request->copied = 0;
+            
+            if ((request->error = mk_vm_address_apply_offset(request->address, request->offset, &start)) ||
+                (request->error = mk_vm_address_check_length(start, request->length)))
+                continue;
+            
+            // Nothing to copy.
+            if (request->length == 0)
+                continue;
+            
+            size_t j = pending++;
+            while (j > 0 && __mk_memory_map_request_start(&batch[sorted[j - 1]]) > start) {
+                sorted[j] = sorted[j - 1];
+                j--;
+            }
+            sorted[j] = (uint8_t)i;
+        }
+        
+        // Sweep the sorted requests, servicing each run of requests that
+        // overlap or are within a page of each other.
+        for (size_t first = 0, last; first < pending; first = last)
+        {
+            mk_vm_address_t run_start = __mk_memory_map_request_start(&batch[sorted[first]]);
+            mk_vm_address_t run_end = run_start + batch[sorted[first]].length;
+            
+            for (last = first + 1; last < pending; last++) {
+                const mk_memory_map_copy_request_t *request = &batch[sorted[last]];
+                mk_vm_address_t start = __mk_memory_map_request_start(request);
+                
+                if (start > run_end && start - run_end >= gap)
+                    break;
+                
+                run_end = MAX(run_end, start + request->length);
+            }
+            
+            __mk_memory_map_copy_run_t run = {
+                .requests = batch,
+                .run = &sorted[first],
+                .run_count = last - first,
+                .run_start = run_start,
+                .require_full = require_full,
+                .serviced = false
+            };
+            
+            map_run(context, run_start, run_end - run_start, &__mk_memory_map_copy_run, &run);
+            
+            if (!run.serviced) {
+                for (size_t i = first; i < last; i++)
+                    batch[sorted[i]].error = MK_EINTERNAL_ERROR;
+            }
+        }
+    }
+    
+    for (size_t i = 0; i < count; i++) {
+        if (requests[i].error)
+            return requests[i].error;
+    }
+    
+    return MK_ESUCCESS;
+}
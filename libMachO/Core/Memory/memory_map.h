@@ -67,11 +67,44 @@ typedef union {
     struct mk_memory_map_s *memory_map;
     struct mk_memory_map_task_s *memory_map_task;
     struct mk_memory_map_self_s *memory_map_self;
+    struct mk_memory_map_file_s *memory_map_file;
 } mk_memory_map_ref __attribute__((__transparent_union__));
 
 //! The identifier for the Memory Map type.
 _mk_export intptr_t mk_memory_map_type;
 
+//◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
+//! A single entry in a batched copy.  See
+//! \ref mk_memory_map_copy_bytes_vector.
+//
+typedef struct {
+    //! An offset to be added to \c address.
+    mk_vm_offset_t offset;
+    //! A context-relative address.
+    mk_vm_address_t address;
+    //! The number of bytes to copy.
+    mk_vm_size_t length;
+    //! The buffer to copy into.  Must be at least \c length bytes.
+    void *buffer;
+    //! [out] The number of bytes copied into \c buffer.
+    mk_vm_size_t copied;
+    //! [out] The result of copying this entry.
+    mk_error_t error;
+} mk_memory_map_copy_request_t;
+
+//! Prototype for the function invoked by \ref mk_memory_map_copy_requests
+//! with the bytes of a run of requests.  \a address is the local address of
+//! the first byte of the run, and \a length is the number of bytes that
+//! could be mapped, which may be less than requested.  \a error is set if
+//! the run could not be mapped.
+typedef void (*mk_memory_map_copy_run_c)(void *state, vm_address_t address, mk_vm_size_t length, mk_error_t error);
+
+//! Prototype for the function invoked by \ref mk_memory_map_copy_requests to
+//! map \a length bytes at the context-relative \a address.  The function
+//! must invoke \a copy, passing \a state, exactly once while the bytes are
+//! mapped.
+typedef void (*mk_memory_map_map_run_c)(void *context, mk_vm_address_t address, mk_vm_size_t length, mk_memory_map_copy_run_c copy, void *state);
+
 
 //----------------------------------------------------------------------------//
 #pragma mark -  Static Methods
@@ -120,6 +153,33 @@ mk_memory_map_has_mapping(mk_memory_map_ref map, mk_vm_offset_t offset, mk_vm_ad
 _mk_export vm_size_t
 mk_memory_map_copy_bytes(mk_memory_map_ref map, mk_vm_offset_t offset, mk_vm_address_t address, void* buffer, mk_vm_size_t length, bool require_full, mk_error_t* error);
 
+//! Copies the memory described by each of the \a count \a requests into the
+//! request's buffer.  Requests that overlap, or are separated by less than a
+//! page, are coalesced so that each group is serviced by a single memory
+//! object.  See \ref mk_memory_map_copy_requests.
+//!
+//! The \c copied and \c error fields of every request are set on return.  If
+//! \a require_full is \c true, a request fails unless all of its bytes could
+//! be copied.
+//!
+//! @return
+//! \ref MK_ESUCCESS if every request succeeded, otherwise the error of the
+//! first request that failed.
+_mk_export mk_error_t
+mk_memory_map_copy_bytes_vector(mk_memory_map_ref map, mk_memory_map_copy_request_t *requests, size_t count, bool require_full);
+
+//! Services the \a count \a requests with \a map_run, which is invoked once
+//! for each run of requests that overlap, or are separated by less than a
+//! page.  This is the implementation of
+//! \ref mk_memory_map_copy_bytes_vector, for clients which map memory
+//! without a \ref mk_memory_map_ref.
+//!
+//! The requests are sorted by address once, in batches of up to 128, and
+//! coalesced in a single pass.  Requests with a length of zero succeed
+//! without being mapped.
+_mk_export mk_error_t
+mk_memory_map_copy_requests(mk_memory_map_copy_request_t *requests, size_t count, bool require_full, mk_memory_map_map_run_c map_run, void *context);
+
 //! Returns the byte at \a offset from \a address, performing any necessary
 //! byte-swapping.
 _mk_export uint8_t
@@ -0,0 +1,194 @@
+//----------------------------------------------------------------------------//
+//|
+//|             MachOKit - A Lightweight Mach-O Parsing Library
+//|             memory_map_file.c
+//|
+//|             D.V.
+//|             Copyright (c) 2014-2015 D.V. All rights reserved.
+//|
+//| Permission is hereby granted, free of charge, to any person obtaining a
+//| copy of this software and associated documentation files (the "Software"),
+//| to deal in the Software without restriction, including without limitation
+//| the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//| and/or sell copies of the Software, and to permit persons to whom the
+//| Software is furnished to do so, subject to the following conditions:
+//|
+//| The above copyright notice and this permission notice shall be included
+//| in all copies or substantial portions of the Software.
+//|
+//| THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+//| OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+//| MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+//| IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+//| CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+//| TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//| SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//----------------------------------------------------------------------------//
+
+#include "core_internal.h"
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <string.h>
+
+//----------------------------------------------------------------------------//
+#pragma mark -  Classes
+//----------------------------------------------------------------------------//
+
+//|++++++++++++++++++++++++++++++++++++|//
+static mk_error_t
+__mk_memory_map_file_init_object(mk_memory_map_ref self, mk_vm_offset_t offset, mk_vm_address_t context_address, mk_vm_size_t length, bool require_full, mk_memory_object_t* memory_object)
+{
+    mk_error_t mk_err;
+    mk_vm_size_t file_size = self.memory_map_file->size;
+    
+    // Verify that the offset value won't overrun a native pointer and compute
+    // the offset address
+    if ((mk_err = mk_vm_address_apply_offset(context_address, offset, &context_address))) {
+        _mkl_error_record(mk_type_get_context(self.memory_map), MK_LOG_RECORD_OFFSET_OVERFLOW, mk_err, context_address, offset, self.memory_map);
+        return mk_err;
+    }
+    
+    // context_address must be within [0, file_size)
+    if (context_address >= file_size) {
+        _mkl_error_record(mk_type_get_context(self.memory_map), MK_LOG_RECORD_RANGE_NOT_WITHIN, MK_EBAD_ACCESS, context_address, length, self.memory_map);
+        return MK_EBAD_ACCESS;
+    }
+    
+    // Safe - context_address < file_size.
+    mk_vm_size_t available_length = file_size - context_address;
+    
+    if (length > available_length)
+    {
+        if (!require_full)
+            length = available_length;
+        else {
+            _mkl_error_record(mk_type_get_context(self.memory_map), MK_LOG_RECORD_RANGE_NOT_WITHIN, MK_EBAD_ACCESS, context_address, length, self.memory_map);
+            return MK_EBAD_ACCESS;
+        }
+    }
+    
+    // Initialize the memory object.  No additional mapping is required; the
+    // object is a window into the existing file mapping.
+    memory_object->vtable = &_mk_memory_object_class;
+    memory_object->mapping = self.memory_map;
+    memory_object->host_address = context_address;
+    memory_object->address = (vm_address_t)self.memory_map_file->address + (vm_address_t)context_address;
+    memory_object->length = (vm_size_t)length;
+    memory_object->reserved1 = 0;
+    memory_object->reserved2 = 0;
+    
+    return MK_ESUCCESS;
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+static void
+__mk_memory_map_file_free_object(mk_memory_map_ref self, mk_memory_object_t* memory_object)
+{
+#pragma unused (self)
+#pragma unused (memory_object)
+}
+
+const struct _mk_memory_map_vtable _mk_memory_map_file_class = {
+    .base.super                 = &_mk_memory_map_class,
+    .base.name                  = "memory_map_file",
+    .init_object                = &__mk_memory_map_file_init_object,
+    .free_object                = &__mk_memory_map_file_free_object
+};
+
+intptr_t mk_memory_map_file_type = (intptr_t)&_mk_memory_map_file_class;
+
+//----------------------------------------------------------------------------//
+#pragma mark -  Creating A File Memory Map
+//----------------------------------------------------------------------------//
+
+//|++++++++++++++++++++++++++++++++++++|//
+mk_error_t
+mk_memory_map_file_init(const char *path, mk_context_t *ctx, mk_memory_map_file_t *file_map)
+{
+    if (path == NULL) return MK_EINVAL;
+    if (file_map == NULL) return MK_EINVAL;
+    
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        // The logger may clobber errno.
+        int err = errno;
+        _mkl_error(ctx, "Failed to open %s: %s", path, strerror(err));
+        return (err == ENOENT) ? MK_ENOT_FOUND : MK_EUNAVAILABLE;
+    }
+    
+    mk_error_t err = mk_memory_map_file_init_with_fd(fd, ctx, file_map);
+    
+    // The mapping holds its own reference to the file.
+    close(fd);
+    
+    return err;
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+mk_error_t
+mk_memory_map_file_init_with_fd(int fd, mk_context_t *ctx, mk_memory_map_file_t *file_map)
+{
+    if (fd < 0) return MK_EINVAL;
+    if (file_map == NULL) return MK_EINVAL;
+    
+    struct stat st;
+    if (fstat(fd, &st)) {
+        int err = errno;
+        _mkl_error(ctx, "Failed to stat file descriptor %i: %s", fd, strerror(err));
+        return MK_EUNAVAILABLE;
+    }
+    
+    if (!S_ISREG(st.st_mode)) {
+        _mkl_error(ctx, "File descriptor %i does not reference a regular file.", fd);
+        return MK_EINVAL;
+    }
+    
+    if ((uint64_t)st.st_size > SIZE_MAX) {
+        _mkl_error(ctx, "File size %" PRIi64 " can not be mapped into the current process.", (int64_t)st.st_size);
+        return MK_EOVERFLOW;
+    }
+    
+    void *address = NULL;
+    
+    // mmap() rejects zero length mappings.  An empty file is represented by
+    // a NULL address; every access will fail the range check.
+    if (st.st_size > 0) {
+        address = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (address == MAP_FAILED) {
+            int err = errno;
+            _mkl_error(ctx, "Failed to map file descriptor %i: %s", fd, strerror(err));
+            return MK_EUNAVAILABLE;
+        }
+    }
+    
+    file_map->base.vtable = &_mk_memory_map_file_class;
+    file_map->base.context = ctx;
+    file_map->address = address;
+    file_map->size = (mk_vm_size_t)st.st_size;
+    
+    return MK_ESUCCESS;
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+mk_error_t
+mk_memory_map_file_free(mk_memory_map_file_t *file_map)
+{
+    if (file_map->address && munmap(file_map->address, (size_t)file_map->size)) {
+        int err = errno;
+        _mkl_error(file_map->base.context, "Failed to unmap <%s %p>: %s", mk_type_name(file_map), file_map, strerror(err));
+    }
+    
+    file_map->base.vtable = NULL;
+    file_map->address = NULL;
+    file_map->size = 0;
+    
+    return MK_ESUCCESS;
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+mk_vm_size_t
+mk_memory_map_file_get_size(mk_memory_map_file_t *file_map)
+{ return file_map->size; }
@@ -0,0 +1,97 @@
+//----------------------------------------------------------------------------//
+//|
+//|             MachOKit - A Lightweight Mach-O Parsing Library
+//! @file       memory_map_file.h
+//!
+//! @author     D.V.
+//! @copyright  Copyright (c) 2014-2015 D.V. All rights reserved.
+//|
+//| Permission is hereby granted, free of charge, to any person obtaining a
+//| copy of this software and associated documentation files (the "Software"),
+//| to deal in the Software without restriction, including without limitation
+//| the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//| and/or sell copies of the Software, and to permit persons to whom the
+//| Software is furnished to do so, subject to the following conditions:
+//|
+//| The above copyright notice and this permission notice shall be included
+//| in all copies or substantial portions of the Software.
+//|
+//| THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+//| OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+//| MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+//| IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+//| CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+//| TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//| SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//----------------------------------------------------------------------------//
+
+//----------------------------------------------------------------------------//
+//! @defgroup MEMORY_MAP_FILE File Memory Map
+//! @ingroup MEMORY_MAP
+//!
+//! A file memory map sources memory from a file on disk.  The file is mapped
+//! into the current process once, when the memory map is initialized.
+//! Memory objects vended by the map are windows into this single mapping and
+//! do not require any additional system calls to create or destroy.
+//!
+//! Host-relative addresses used with a file memory map are offsets from the
+//! start of the file.
+//----------------------------------------------------------------------------//
+
+#ifndef _memory_map_file_h
+#define _memory_map_file_h
+
+//! @addtogroup MEMORY_MAP_FILE
+//! @{
+//!
+
+//----------------------------------------------------------------------------//
+#pragma mark -  Types
+//! @name       Types
+//----------------------------------------------------------------------------//
+
+//◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
+//! @internal
+//
+typedef struct mk_memory_map_file_s {
+    struct mk_memory_map_s base;
+    //! The address at which the file has been mapped into the current
+    //! process.  \c NULL if the file is empty.
+    void *address;
+    //! The size of the file, in bytes.
+    mk_vm_size_t size;
+} mk_memory_map_file_t;
+
+//! The identifier for the Memory Map File type.
+_mk_export intptr_t mk_memory_map_file_type;
+
+
+//----------------------------------------------------------------------------//
+#pragma mark -  Creating A File Memory Map
+//! @name       Creating A File Memory Map
+//----------------------------------------------------------------------------//
+
+//! Initializes a memory map for the contents of the file at \a path.  The
+//! file is mapped read-only for the lifetime of the memory map.
+_mk_export mk_error_t
+mk_memory_map_file_init(const char *path, mk_context_t *ctx, mk_memory_map_file_t *file_map);
+
+//! Initializes a memory map for the contents of the file referenced by the
+//! open file descriptor \a fd.  The caller retains ownership of \a fd, which
+//! may be closed once this function returns.
+_mk_export mk_error_t
+mk_memory_map_file_init_with_fd(int fd, mk_context_t *ctx, mk_memory_map_file_t *file_map);
+
+//! Unmaps the file.  Any memory objects vended by \a file_map must be freed
+//! before calling this function.
+_mk_export mk_error_t
+mk_memory_map_file_free(mk_memory_map_file_t *file_map);
+
+//! Returns the size of the file backing \a file_map.
+_mk_export mk_vm_size_t
+mk_memory_map_file_get_size(mk_memory_map_file_t *file_map);
+
+
+//! @} MEMORY_MAP_FILE !//
+
+#endif /* _memory_map_file_h */
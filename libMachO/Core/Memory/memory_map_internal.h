@@ -53,6 +53,9 @@ typedef bool (*_mk_memory_map_has_mapping)(mk_memory_map_ref self, mk_vm_offset_
 //!
 typedef vm_size_t (*_mk_memory_map_copy_bytes)(mk_memory_map_ref self, mk_vm_offset_t offset, mk_vm_address_t address, void* buffer, mk_vm_size_t length, bool require_full, mk_error_t* error);
 
+//!
+typedef mk_error_t (*_mk_memory_map_copy_bytes_vector)(mk_memory_map_ref self, mk_memory_map_copy_request_t *requests, size_t count, bool require_full);
+
 //!
 typedef uint8_t (*_mk_memory_map_read_byte)(mk_memory_map_ref self, mk_vm_offset_t offset, mk_vm_address_t address, mk_data_model_ref data_model, mk_error_t* error);
 
@@ -78,6 +81,7 @@ struct _mk_memory_map_vtable {
     _mk_memory_map_free_object free_object;
     _mk_memory_map_has_mapping has_mapping;
     _mk_memory_map_copy_bytes copy_bytes;
+    _mk_memory_map_copy_bytes_vector copy_bytes_vector;
     _mk_memory_map_read_byte read_byte;
     _mk_memory_map_read_word read_word;
     _mk_memory_map_read_dword read_dword;
@@ -40,7 +40,7 @@ __mk_memory_map_self_init_object(mk_memory_map_ref self, mk_vm_offset_t offset,
     // Verify that the offset value won't overrun a native pointer and compute
     // the offset address
     if ((mk_err = mk_vm_address_apply_offset(context_address, offset, &context_address))) {
-        _mkl_error(mk_type_get_context(self.memory_map), "Arithmetic error %s when adding input offset %" MK_VM_PRIiOFFSET " to input address 0x%" MK_VM_PRIxADDR ".", mk_error_string(mk_err), offset, context_address);
+        _mkl_error_record(mk_type_get_context(self.memory_map), MK_LOG_RECORD_OFFSET_OVERFLOW, mk_err, context_address, offset, self.memory_map);
         return mk_err;
     }
     
@@ -57,7 +57,7 @@ __mk_memory_map_self_init_object(mk_memory_map_ref self, mk_vm_offset_t offset,
         if (!require_full)
             total_length = UINT64_MAX;
         else {
-            _mkl_error(mk_type_get_context(self.memory_map), "Input range (offset address = 0x%" MK_VM_PRIxADDR ", length = %" MK_VM_PRIuSIZE ") is not valid in this process.", context_address, length);
+            _mkl_error_record(mk_type_get_context(self.memory_map), MK_LOG_RECORD_RANGE_NOT_VALID, MK_EBAD_ACCESS, context_address, length, self.memory_map);
             return MK_EBAD_ACCESS;
         }
     }
@@ -67,7 +67,7 @@ __mk_memory_map_self_init_object(mk_memory_map_ref self, mk_vm_offset_t offset,
         if (!require_full)
             total_length = UINT64_MAX - base_context_address;
         else {
-            _mkl_error(mk_type_get_context(self.memory_map), "Input range (offset address = 0x%" MK_VM_PRIxADDR ", length = %" MK_VM_PRIuSIZE ") is not valid in this process.", context_address, length);
+            _mkl_error_record(mk_type_get_context(self.memory_map), MK_LOG_RECORD_RANGE_NOT_VALID, MK_EBAD_ACCESS, context_address, length, self.memory_map);
             return MK_EBAD_ACCESS;
         }
     }
@@ -91,7 +91,7 @@ __mk_memory_map_self_init_object(mk_memory_map_ref self, mk_vm_offset_t offset,
             if (!require_full)
                 break;
             
-            _mkl_error(mk_type_get_context(self.memory_map), "Input range (offset address = 0x%" MK_VM_PRIxADDR ", length = %" MK_VM_PRIuSIZE ") is not valid in this process.", context_address, length);
+            _mkl_error_record(mk_type_get_context(self.memory_map), MK_LOG_RECORD_RANGE_NOT_VALID, MK_EBAD_ACCESS, context_address, length, self.memory_map);
             return MK_EBAD_ACCESS;
         }
         
@@ -106,7 +106,7 @@ __mk_memory_map_self_init_object(mk_memory_map_ref self, mk_vm_offset_t offset,
     
     // No mappable pages found at contextAddress.
     if (mapped_length == 0) {
-        _mkl_error(mk_type_get_context(self.memory_map), "Input range (offset address = 0x%" MK_VM_PRIxADDR ", length = %" MK_VM_PRIuSIZE ") is not valid in this process.", context_address, length);
+        _mkl_error_record(mk_type_get_context(self.memory_map), MK_LOG_RECORD_RANGE_NOT_VALID, MK_EBAD_ACCESS, context_address, length, self.memory_map);
         return MK_EBAD_ACCESS;
     }
     
@@ -32,48 +32,13 @@
 //----------------------------------------------------------------------------//
 
 //|++++++++++++++++++++++++++++++++++++|//
+//! Maps \a total_length bytes starting at the page-aligned
+//! \a base_context_address in the target task into the current process.
 static mk_error_t
-__mk_memory_map_task_init_object(mk_memory_map_ref self, mk_vm_offset_t offset, mk_vm_address_t context_address, mk_vm_size_t length, bool require_full, mk_memory_object_t* memory_object)
+__mk_memory_map_task_map_pages(mk_memory_map_task_t *self, mach_vm_address_t base_context_address, mach_vm_size_t total_length, bool require_full, mach_vm_address_t *mapping_address_out, mach_vm_size_t *mapped_length_out)
 {
-    mk_error_t mk_err;
-    
-    // Verify that the offset value won't overrun a native pointer and compute
-    // the offset address
-    if ((mk_err = mk_vm_address_apply_offset(context_address, offset, &context_address))) {
-        _mkl_error(mk_type_get_context(self.memory_map), "Arithmetic error %s when adding input offset %" MK_VM_PRIiOFFSET " to input address 0x%" MK_VM_PRIxADDR ".", mk_error_string(mk_err), offset, context_address);
-        return mk_err;
-    }
-    
-    mach_vm_address_t base_context_address = mach_vm_trunc_page(context_address);
-    mach_vm_offset_t context_address_offset = context_address - base_context_address;
-    
-    // Derive a new length accounting for the added difference between the
-    // contextAddress and the baseContextAddress, rounded to the page size.
-    // This may overflow if length is sufficiently close to UINT64_MAX.
-    mach_vm_size_t total_length = mach_vm_round_page(length + context_address_offset);
-    // Check if we have overflowed.
-    if (total_length < length)
-    {
-        if (!require_full)
-            total_length = UINT64_MAX;
-        else {
-            _mkl_error(mk_type_get_context(self.memory_map), "Input range (offset address = 0x%" MK_VM_PRIxADDR ", length = %" MK_VM_PRIuSIZE ") is not within <%s %p>.", context_address, length, mk_type_name(self.memory_map), self.memory_map);
-            return MK_EBAD_ACCESS;
-        }
-    }
-    // Check if adding the total_length to the base_context_address would overflow.
-    else if (UINT64_MAX - total_length < base_context_address)
-    {
-        if (!require_full)
-            total_length = UINT64_MAX - base_context_address;
-        else {
-            _mkl_error(mk_type_get_context(self.memory_map), "Input range (offset address = 0x%" MK_VM_PRIxADDR ", length = %" MK_VM_PRIuSIZE ") is not within <%s %p>.", context_address, length, mk_type_name(self.memory_map), self.memory_map);
-            return MK_EBAD_ACCESS;
-        }
-    }
-    
     // total_length should still be page aligned.
-    _mk_assert((total_length & vm_page_mask) == 0x0, mk_type_get_context(self.memory_map), "total_length must be page aligned.");
+    _mk_assert((total_length & vm_page_mask) == 0x0, mk_type_get_context(self), "total_length must be page aligned.");
     
     // If short mappings are permitted, determine the actual mappable size of
     // the target range.
@@ -81,12 +46,12 @@ __mk_memory_map_task_init_object(mk_memory_map_ref self, mk_vm_offset_t offset,
     {
         mach_vm_size_t verified_length = 0;
         
-        while (verified_length < length) {
+        while (verified_length < total_length) {
             memory_object_size_t entry_length = total_length - verified_length;
             mach_port_t mem_handle;
             kern_return_t error;
             
-            error = mach_make_memory_entry_64(self.memory_map_task->task, &entry_length, base_context_address + verified_length, VM_PROT_READ, &mem_handle, MACH_PORT_NULL);
+            error = mach_make_memory_entry_64(self->task, &entry_length, base_context_address + verified_length, VM_PROT_READ, &mem_handle, MACH_PORT_NULL);
             // Break once we hit an unmappable page.
             if (error != KERN_SUCCESS)
                 break;
@@ -102,7 +67,7 @@ __mk_memory_map_task_init_object(mk_memory_map_ref self, mk_vm_offset_t offset,
         
         // No mappable pages found at contextAddress.
         if (verified_length == 0) {
-            _mkl_error(mk_type_get_context(self.memory_map), "Input range (offset address = 0x%" MK_VM_PRIxADDR ", length = %" MK_VM_PRIuSIZE ") is not within <%s %p>.", context_address, length, mk_type_name(self.memory_map), self.memory_map);
+            _mkl_error_record(mk_type_get_context(self), MK_LOG_RECORD_RANGE_NOT_WITHIN, MK_EBAD_ACCESS, base_context_address, total_length, self);
             return MK_EBAD_ACCESS;
         }
         
@@ -116,7 +81,7 @@ __mk_memory_map_task_init_object(mk_memory_map_ref self, mk_vm_offset_t offset,
     // Reserve enough pages to contain the mapping.
     kern_return_t err = mach_vm_allocate(mach_task_self(), &mapping_address, total_length, VM_FLAGS_ANYWHERE);
     if (err != KERN_SUCCESS) {
-        _mkl_error(mk_type_get_context(self.memory_map), "Failed to allocate a target page range for the page remapping.");
+        _mkl_error(mk_type_get_context(self), "Failed to allocate a target page range for the page remapping.");
         return MK_EBAD_ACCESS;
     }
     
@@ -128,7 +93,7 @@ __mk_memory_map_task_init_object(mk_memory_map_ref self, mk_vm_offset_t offset,
         
         // Create a reference to the target pages.  The returned entry may be
         // smaller than the entryLength.
-        err = mach_make_memory_entry_64(self.memory_map_task->task, &entry_length, base_context_address + mapped_length, VM_PROT_READ, &mem_handle, MACH_PORT_NULL);
+        err = mach_make_memory_entry_64(self->task, &entry_length, base_context_address + mapped_length, VM_PROT_READ, &mem_handle, MACH_PORT_NULL);
         if (err != KERN_SUCCESS)
         {
             // Cleanup the reserved pages
@@ -137,7 +102,7 @@ __mk_memory_map_task_init_object(mk_memory_map_ref self, mk_vm_offset_t offset,
                 // TODO - Log this.  We're leaking pages.
             }
             
-            _mkl_error(mk_type_get_context(self.memory_map), "Input range (offset address = 0x%" MK_VM_PRIxADDR ", length = %" MK_VM_PRIiSIZE ") is not within memory map.", context_address, length);
+            _mkl_error_record(mk_type_get_context(self), MK_LOG_RECORD_RANGE_NOT_WITHIN, MK_EBAD_ACCESS, base_context_address, total_length, self);
             return MK_EBAD_ACCESS;
         }
         
@@ -159,7 +124,7 @@ __mk_memory_map_task_init_object(mk_memory_map_ref self, mk_vm_offset_t offset,
                 // TODO - Log this.  We're leaking ports.
             }
             
-            _mkl_error(mk_type_get_context(self.memory_map), "mach_vm_map() failure.");
+            _mkl_error(mk_type_get_context(self), "mach_vm_map() failure.");
             return MK_EBAD_ACCESS;
         }
         
@@ -172,10 +137,125 @@ __mk_memory_map_task_init_object(mk_memory_map_ref self, mk_vm_offset_t offset,
         mapped_length += entry_length;
     }
     
+    *mapping_address_out = mapping_address;
+    *mapped_length_out = mapped_length;
+    return MK_ESUCCESS;
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+static mk_error_t
+__mk_memory_map_task_cache_map(void *backing, mk_vm_address_t host_address, mk_vm_size_t length, bool require_full, vm_address_t *local_address, mk_vm_size_t *mapped_length)
+{
+    mach_vm_address_t mapping_address;
+    mach_vm_size_t mapping_length;
+    
+    mk_error_t err = __mk_memory_map_task_map_pages(backing, host_address, length, require_full, &mapping_address, &mapping_length);
+    if (err != MK_ESUCCESS)
+        return err;
+    
+    *local_address = (vm_address_t)mapping_address;
+    *mapped_length = mapping_length;
+    return MK_ESUCCESS;
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+static void
+__mk_memory_map_task_cache_unmap(void *backing, vm_address_t local_address, mk_vm_size_t length)
+{
+#pragma unused (backing)
+    kern_return_t err = mach_vm_deallocate(mach_task_self(), local_address, length);
+    if (err != KERN_SUCCESS) {
+        // TODO - Warning
+    }
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+static mk_error_t
+__mk_memory_map_task_init_object(mk_memory_map_ref self, mk_vm_offset_t offset, mk_vm_address_t context_address, mk_vm_size_t length, bool require_full, mk_memory_object_t* memory_object)
+{
+    mk_error_t mk_err;
+    
+    // Verify that the offset value won't overrun a native pointer and compute
+    // the offset address
+    if ((mk_err = mk_vm_address_apply_offset(context_address, offset, &context_address))) {
+        _mkl_error_record(mk_type_get_context(self.memory_map), MK_LOG_RECORD_OFFSET_OVERFLOW, mk_err, context_address, offset, self.memory_map);
+        return mk_err;
+    }
+    
+    // Prefer a cached mapping, if the memory map was configured with a cache.
+    if (self.memory_map_task->cache.entries)
+    {
+        mk_mapping_cache_entry_t *entry;
+        
+        mk_err = mk_mapping_cache_acquire(&self.memory_map_task->cache, context_address, length, require_full, &entry);
+        if (mk_err == MK_ESUCCESS)
+        {
+            // The cache only returns entries which contain context_address.
+            mk_vm_size_t slide = context_address - entry->host_address;
+            
+            memory_object->vtable = &_mk_memory_object_class;
+            memory_object->mapping = self.memory_map;
+            memory_object->host_address = context_address;
+            memory_object->address = (vm_address_t)(entry->local_address + slide);
+            memory_object->length = (vm_size_t)(entry->length - slide);
+            // A zero reserved2 marks a cached mapping.
+            memory_object->reserved1 = (intptr_t)entry;
+            memory_object->reserved2 = 0;
+            
+            return MK_ESUCCESS;
+        }
+        else if (mk_err != MK_EUNAVAILABLE)
+        {
+            // Failures to map the pages were logged by
+            // __mk_memory_map_task_map_pages().  Only the range check
+            // performed by the cache itself is reported here.
+            if (mk_err == MK_EOVERFLOW)
+                _mkl_error_record(mk_type_get_context(self.memory_map), MK_LOG_RECORD_LENGTH_OVERFLOW, mk_err, context_address, length, self.memory_map);
+            return mk_err;
+        }
+        
+        // The cache is full of referenced mappings.  Fall through to an
+        // uncached mapping.
+    }
+    
+    mach_vm_address_t base_context_address = mach_vm_trunc_page(context_address);
+    mach_vm_offset_t context_address_offset = context_address - base_context_address;
+    
+    // Derive a new length accounting for the added difference between the
+    // contextAddress and the baseContextAddress, rounded to the page size.
+    // This may overflow if length is sufficiently close to UINT64_MAX.
+    mach_vm_size_t total_length = mach_vm_round_page(length + context_address_offset);
+    // Check if we have overflowed.
+    if (total_length < length)
+    {
+        if (!require_full)
+            total_length = mach_vm_trunc_page(UINT64_MAX);
+        else {
+            _mkl_error_record(mk_type_get_context(self.memory_map), MK_LOG_RECORD_RANGE_NOT_WITHIN, MK_EBAD_ACCESS, context_address, length, self.memory_map);
+            return MK_EBAD_ACCESS;
+        }
+    }
+    // Check if adding the total_length to the base_context_address would overflow.
+    if (UINT64_MAX - total_length < base_context_address)
+    {
+        if (!require_full)
+            total_length = mach_vm_trunc_page(UINT64_MAX - base_context_address);
+        else {
+            _mkl_error_record(mk_type_get_context(self.memory_map), MK_LOG_RECORD_RANGE_NOT_WITHIN, MK_EBAD_ACCESS, context_address, length, self.memory_map);
+            return MK_EBAD_ACCESS;
+        }
+    }
+    
+    mach_vm_address_t mapping_address;
+    mach_vm_size_t mapped_length;
+    
+    if ((mk_err = __mk_memory_map_task_map_pages(self.memory_map_task, base_context_address, total_length, require_full, &mapping_address, &mapped_length)))
+        return mk_err;
+    
     // Determine the correct offset into the mapping corresponding to the
     // requested address.
     vm_address_t vm_address = (vm_address_t)(mapping_address + context_address_offset);
-    length = mapped_length + context_address_offset;
+    length = mapped_length - context_address_offset;
     
     // Initialize the memory object.
     memory_object->vtable = &_mk_memory_object_class;
@@ -184,7 +264,7 @@ __mk_memory_map_task_init_object(mk_memory_map_ref self, mk_vm_offset_t offset,
     memory_object->address = vm_address;
     memory_object->length = (vm_size_t)length;
     memory_object->reserved1 = (intptr_t)mapping_address;
-    memory_object->reserved1 = (intptr_t)mapped_length;
+    memory_object->reserved2 = (intptr_t)mapped_length;
     
     return MK_ESUCCESS;
 }
@@ -193,8 +273,13 @@ __mk_memory_map_task_init_object(mk_memory_map_ref self, mk_vm_offset_t offset,
 static void
 __mk_memory_map_task_free_object(mk_memory_map_ref self, mk_memory_object_t* memory_object)
 {
-#pragma unused (self)
-    kern_return_t err = mach_vm_deallocate(mach_task_self(), memory_object->reserved1, memory_object->reserved2);
+    // Cached mappings are returned to the cache.
+    if (memory_object->reserved2 == 0) {
+        mk_mapping_cache_release(&self.memory_map_task->cache, (mk_mapping_cache_entry_t*)memory_object->reserved1);
+        return;
+    }
+    
+    kern_return_t err = mach_vm_deallocate(mach_task_self(), (mach_vm_address_t)memory_object->reserved1, (mach_vm_size_t)memory_object->reserved2);
     if (err != KERN_SUCCESS) {
         // TODO - Warning
     }
@@ -226,6 +311,27 @@ mk_memory_map_task_init(mach_port_t task, mk_context_t *ctx, mk_memory_map_task_
     task_map->base.vtable = &_mk_memory_map_task_class;
     task_map->base.context = ctx;
     task_map->task = task;
+    memset(&task_map->cache, 0, sizeof(task_map->cache));
+    
+    return MK_ESUCCESS;
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+mk_error_t
+mk_memory_map_task_init_with_cache(mach_port_t task, mk_context_t *ctx,
+                                   mk_mapping_cache_entry_t *cache_entries, uint32_t cache_entry_count,
+                                   mk_vm_size_t cache_byte_budget, mk_memory_map_task_t *task_map)
+{
+    mk_error_t err;
+    
+    if ((err = mk_memory_map_task_init(task, ctx, task_map)))
+        return err;
+    
+    if ((err = mk_mapping_cache_init(cache_entries, cache_entry_count, vm_page_size, cache_byte_budget, task_map, &__mk_memory_map_task_cache_map, &__mk_memory_map_task_cache_unmap, &task_map->cache))) {
+        _mkl_error(ctx, "Failed to initialize the mapping cache.");
+        mk_memory_map_task_free(task_map);
+        return err;
+    }
     
     return MK_ESUCCESS;
 }
@@ -234,8 +340,16 @@ mk_memory_map_task_init(mach_port_t task, mk_context_t *ctx, mk_memory_map_task_
 mk_error_t
 mk_memory_map_task_free(mk_memory_map_task_t *task_map)
 {
+    if (task_map->cache.entries)
+        mk_mapping_cache_free(&task_map->cache);
+    
     mach_port_mod_refs(mach_task_self(), task_map->task, MACH_PORT_RIGHT_SEND, -1);
     task_map->base.vtable = NULL;
     
     return MK_ESUCCESS;
 }
+
+//|++++++++++++++++++++++++++++++++++++|//
+mk_mapping_cache_statistics_t
+mk_memory_map_task_get_cache_statistics(mk_memory_map_task_t *task_map)
+{ return mk_mapping_cache_get_statistics(&task_map->cache); }
@@ -52,6 +52,8 @@ typedef struct mk_memory_map_task_s {
     struct mk_memory_map_s base;
     //! The target task for this memory map.
     mach_port_t task;
+    //! Optional cache of mappings.  Unused if \c cache.entries is \c NULL.
+    mk_mapping_cache_t cache;
 } mk_memory_map_task_t;
 
 //! The identifier for the Memory Map Task type.
@@ -66,9 +68,34 @@ _mk_export intptr_t mk_memory_map_task_type;
 _mk_export mk_error_t
 mk_memory_map_task_init(mach_port_t task, mk_context_t *ctx, mk_memory_map_task_t *task_map);
 
+//! Initializes a task memory map which caches the mappings it creates.
+//! Overlapping requests share a single reference counted mapping.
+//! Unreferenced mappings are retained until they are evicted, least recently
+//! used first, to stay within \a cache_byte_budget.
+//!
+//! The cache is not thread-safe.  Callers must serialize the creation and
+//! destruction of memory objects from a caching task memory map.
+//!
+//! @param  cache_entries
+//!         Storage for \a cache_entry_count cache entries.  Must remain valid
+//!         until \ref mk_memory_map_task_free is called.
+//! @param  cache_entry_count
+//!         The maximum number of mappings which may be cached.
+//! @param  cache_byte_budget
+//!         The maximum total size of the cached mappings.
+_mk_export mk_error_t
+mk_memory_map_task_init_with_cache(mach_port_t task, mk_context_t *ctx,
+                                   mk_mapping_cache_entry_t *cache_entries, uint32_t cache_entry_count,
+                                   mk_vm_size_t cache_byte_budget, mk_memory_map_task_t *task_map);
+
 _mk_export mk_error_t
 mk_memory_map_task_free(mk_memory_map_task_t *task_map);
 
+//! Returns the mapping cache counters for \a task_map.  All counters are
+//! zero if \a task_map was not initialized with a cache.
+_mk_export mk_mapping_cache_statistics_t
+mk_memory_map_task_get_cache_statistics(mk_memory_map_task_t *task_map);
+
 
 //! @} MEMORY_MAP_TASK !//
 
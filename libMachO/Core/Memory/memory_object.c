@@ -36,10 +36,19 @@ static mk_context_t*
 __mk_memory_object_get_context(mk_type_ref self)
 { return mk_type_get_context( mk_memory_map_for_object(self).memory_map ); }
 
+//|++++++++++++++++++++++++++++++++++++|//
+static size_t
+__mk_memory_object_copy_description(mk_type_ref self, char *output, size_t output_len)
+{
+    mk_memory_object_t *mobj = (mk_memory_object_t*)self;
+    return (size_t)snprintf(output, output_len, "<%s %p; host address = 0x%" MK_VM_PRIxADDR ", address = 0x%" PRIxPTR ", length = %" PRIuPTR ">", mk_type_name(self), self, mobj->host_address, (uintptr_t)mobj->address, (uintptr_t)mobj->length);
+}
+
 const struct mk_memory_object_vtable _mk_memory_object_class = {
     .base.super                 = &_mk_type_class,
     .base.name                  = "memory_object",
     .base.get_context           = &__mk_memory_object_get_context,
+    .base.copy_description      = &__mk_memory_object_copy_description,
 };
 
 intptr_t mk_memory_object_type = (intptr_t)&_mk_memory_object_class;
@@ -76,11 +85,9 @@ mk_vm_range_t mk_memory_object_host_range(mk_memory_object_ref mobj)
 bool
 mk_memory_object_verify_local_pointer(mk_memory_object_ref mobj, vm_offset_t offset, vm_address_t address, vm_size_t length, mk_error_t* error)
 {
-    mk_context_t *ctx = mk_type_get_context(mobj.memory_object);
-    
     // Verify that the offset value won't overrun a native pointer
     if (UINTPTR_MAX - offset < address) {
-        _mkl_error(ctx, "Adding input offset %" PRIuPTR " to input address 0x%" PRIxPTR " would overflow.", (uintptr_t)offset, (uintptr_t)address);
+        _mkl_error_record(mk_type_get_context(mobj.memory_object), MK_LOG_RECORD_OFFSET_OVERFLOW, MK_EOVERFLOW, address, offset, mobj.memory_object);
         MK_ERROR_OUT = MK_EOVERFLOW;
         return false;
     }
@@ -90,7 +97,7 @@ mk_memory_object_verify_local_pointer(mk_memory_object_ref mobj, vm_offset_t off
     
     // Verify that the address value won't overflow
     if (UINTPTR_MAX - length < address) {
-        _mkl_error(ctx, "Adding input length %" PRIuPTR " to offset input address 0x%" PRIxPTR " would overflow.", (uintptr_t)length, (uintptr_t)address);
+        _mkl_error_record(mk_type_get_context(mobj.memory_object), MK_LOG_RECORD_LENGTH_OVERFLOW, MK_EOVERFLOW, address, length, mobj.memory_object);
         MK_ERROR_OUT = MK_EOVERFLOW;
         return false;
     }
@@ -103,14 +110,14 @@ mk_memory_object_verify_local_pointer(mk_memory_object_ref mobj, vm_offset_t off
     
     // Verify that the address starts within range
     if (address < mobj_address) {
-        _mkl_error(ctx, "Input range (offset address = 0x%" PRIxPTR ", length = %" PRIuPTR ") is not within <mk_memory_object_t %p (base = 0x%" PRIxPTR ", length = %" PRIuPTR ")>", (uintptr_t)address, (uintptr_t)length, mobj.memory_object, (uintptr_t)mobj_address, (uintptr_t)mobj_length);
+        _mkl_error_record(mk_type_get_context(mobj.memory_object), MK_LOG_RECORD_RANGE_NOT_WITHIN, MK_EOUT_OF_RANGE, address, length, mobj.memory_object);
         MK_ERROR_OUT = MK_EOUT_OF_RANGE;
         return false;
     }
     
     // Check that the block ends within range
     if (mobj_address + mobj_length < address + length) {
-        _mkl_error(ctx, "Input range (offset address = 0x%" PRIxPTR ", length = %" PRIuPTR ") is not within <mk_memory_object_t %p (base = 0x%" PRIxPTR ", length = %" PRIuPTR ")>", (uintptr_t)address, (uintptr_t)length, mobj.memory_object, (uintptr_t)mobj_address, (uintptr_t)mobj_length);
+        _mkl_error_record(mk_type_get_context(mobj.memory_object), MK_LOG_RECORD_RANGE_NOT_WITHIN, MK_EOUT_OF_RANGE, address, length, mobj.memory_object);
         MK_ERROR_OUT = MK_EOUT_OF_RANGE;
         return false;
     }
@@ -124,18 +131,17 @@ vm_address_t
 mk_memory_object_remap_address(mk_memory_object_ref mobj, mk_vm_offset_t offset, mk_vm_address_t address, mk_vm_size_t length, mk_error_t* error)
 {
     mk_error_t err;
-    mk_context_t *ctx = mk_type_get_context(mobj.memory_object);
     
     // Adjust the address using the verified offset
     if ((err = mk_vm_address_apply_offset(address, offset, &address))) {
-        _mkl_error(ctx, "[mk_memory_object] Adding input offset %" MK_VM_PRIiOFFSET " to input address 0x%" MK_VM_PRIxADDR " would overflow.", offset, address);
+        _mkl_error_record(mk_type_get_context(mobj.memory_object), MK_LOG_RECORD_OFFSET_OVERFLOW, err, address, offset, mobj.memory_object);
         MK_ERROR_OUT = err;
         return UINTPTR_MAX;
     }
     
     // Verify that the address value won't overflow
     if (UINTPTR_MAX - length < address) {
-        _mkl_error(ctx, "[mk_memory_object] Adding input length %" MK_VM_PRIiSIZE " to offset input address 0x%" MK_VM_PRIxADDR " would overflow.", length, address);
+        _mkl_error_record(mk_type_get_context(mobj.memory_object), MK_LOG_RECORD_LENGTH_OVERFLOW, MK_EOVERFLOW, address, length, mobj.memory_object);
         MK_ERROR_OUT = MK_EOVERFLOW;
         return UINTPTR_MAX;
     }
@@ -149,14 +155,14 @@ mk_memory_object_remap_address(mk_memory_object_ref mobj, mk_vm_offset_t offset,
     
     // Verify that the address starts within range
     if (address < mobj_context_address) {
-        _mkl_error(ctx, "Input range (offset address = 0x%" MK_VM_PRIxADDR ", length = %" MK_VM_PRIuSIZE ") is not within <mk_memory_object_t %p (base = 0x%" MK_VM_PRIxADDR ", length = %" PRIuPTR ")>", address, length, mobj.memory_object, mobj_context_address, (uintptr_t)mobj_length);
+        _mkl_error_record(mk_type_get_context(mobj.memory_object), MK_LOG_RECORD_RANGE_NOT_WITHIN, MK_EOUT_OF_RANGE, address, length, mobj.memory_object);
         MK_ERROR_OUT = MK_EOUT_OF_RANGE;
         return UINTPTR_MAX;
     }
     
     // Verify that the block ends within range
     if (mobj_context_address + mobj_length < address + length) {
-        _mkl_error(ctx, "Input range (offset address = 0x%" MK_VM_PRIxADDR ", length = %" MK_VM_PRIuSIZE ") is not within <mk_memory_object_t %p (base = 0x%" MK_VM_PRIxADDR ", length = %" PRIuPTR ")>", address, length, mobj.memory_object, mobj_context_address, (uintptr_t)mobj_length);
+        _mkl_error_record(mk_type_get_context(mobj.memory_object), MK_LOG_RECORD_RANGE_NOT_WITHIN, MK_EOUT_OF_RANGE, address, length, mobj.memory_object);
         MK_ERROR_OUT = MK_EOUT_OF_RANGE;
         return UINTPTR_MAX;
     }
@@ -216,7 +222,7 @@ mk_memory_object_read_word(mk_memory_object_ref mobj, mk_vm_offset_t offset, mk_
     
     MK_ERROR_OUT = MK_ESUCCESS;
     if (data_model.data_model)
-        return mk_data_model_get_byte_order(data_model)->swap16( *(uint16_t*)remapped_address );
+        return mk_byteorder_swap16(mk_data_model_get_byte_order(data_model), *(uint16_t*)remapped_address);
     else
         return *(uint16_t*)remapped_address;
 }
@@ -231,7 +237,7 @@ mk_memory_object_read_dword(mk_memory_object_ref mobj, mk_vm_offset_t offset, mk
     
     MK_ERROR_OUT = MK_ESUCCESS;
     if (data_model.data_model)
-        return mk_data_model_get_byte_order(data_model)->swap32( *(uint32_t*)remapped_address );
+        return mk_byteorder_swap32(mk_data_model_get_byte_order(data_model), *(uint32_t*)remapped_address);
     else
         return *(uint32_t*)remapped_address;
 }
@@ -246,7 +252,7 @@ mk_memory_object_read_qword(mk_memory_object_ref mobj, mk_vm_offset_t offset, mk
     
     MK_ERROR_OUT = MK_ESUCCESS;
     if (data_model.data_model)
-        return mk_data_model_get_byte_order(data_model)->swap64( *(uint64_t*)remapped_address );
+        return mk_byteorder_swap64(mk_data_model_get_byte_order(data_model), *(uint64_t*)remapped_address);
     else
         return *(uint64_t*)remapped_address;
 }
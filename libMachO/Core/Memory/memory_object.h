@@ -184,6 +184,206 @@ _mk_export uint64_t
 mk_memory_object_read_qword(mk_memory_object_ref mobj, mk_vm_offset_t offset, mk_vm_address_t address, mk_data_model_ref data_model, mk_error_t *error);
 
 
+//----------------------------------------------------------------------------//
+#pragma mark -  Inline Readers
+//! @name       Inline Readers
+//!
+//! Header-only equivalents of the mk_memory_object_read_* functions.  The
+//! range check is performed inline against the fields of \a mobj, without a
+//! context lookup, and the byte order is selected by the caller rather than
+//! looked up through a data model on every read.  Callers that read many
+//! values from the same object should resolve the byte order once, with
+//! \ref mk_data_model_get_byte_order, and call the \c _direct or
+//! \c _swapped variants directly.
+//!
+//! If the range check fails these functions call through to the matching
+//! out-of-line function, so the returned value, error code and logging are
+//! identical to those of the existing functions.
+//----------------------------------------------------------------------------//
+
+//! Returns a process-relative pointer to \a length bytes at
+//! (\a address + \a offset) in \a mobj, or \c NULL if the range is not
+//! entirely within \a mobj.  Unlike \ref mk_memory_object_remap_address,
+//! this function does not log or report an error.
+static inline const void*
+mk_memory_object_fast_pointer(const mk_memory_object_t *mobj, mk_vm_offset_t offset, mk_vm_address_t address, mk_vm_size_t length)
+{
+    // Same overflow checks as mk_memory_object_remap_address().
+    if (MK_VM_ADDRESS_MAX - offset < address)
+        return NULL;
+    address += offset;
+    if (UINTPTR_MAX - length < address)
+        return NULL;
+    
+    if (address < mobj->host_address)
+        return NULL;
+    
+    mk_vm_size_t slide = address - mobj->host_address;
+    if (slide > mobj->length || mobj->length - slide < length)
+        return NULL;
+    
+    return (const void*)(mobj->address + (vm_address_t)slide);
+}
+
+//! @internal
+//! Wraps \a mobj for the out-of-line functions.  Transparent unions are not
+//! available to C++ callers of this header.
+static inline mk_memory_object_ref
+_mk_memory_object_slow_ref(const mk_memory_object_t *mobj)
+{
+    mk_memory_object_ref ref;
+    ref.memory_object = (struct mk_memory_object_s*)mobj;
+    return ref;
+}
+
+//! @internal
+static inline mk_data_model_ref
+_mk_memory_object_no_data_model(void)
+{
+    mk_data_model_ref ref;
+    ref.data_model = NULL;
+    return ref;
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+static inline uint8_t
+mk_memory_object_read_byte_fast(const mk_memory_object_t *mobj, mk_vm_offset_t offset, mk_vm_address_t address, mk_error_t *error)
+{
+    const uint8_t *local = (const uint8_t*)mk_memory_object_fast_pointer(mobj, offset, address, sizeof(uint8_t));
+    if (__builtin_expect(local == NULL, 0))
+        return mk_memory_object_read_byte(_mk_memory_object_slow_ref(mobj), offset, address, _mk_memory_object_no_data_model(), error);
+    
+    MK_ERROR_OUT = MK_ESUCCESS;
+    return *local;
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+static inline uint16_t
+mk_memory_object_read_word_direct(const mk_memory_object_t *mobj, mk_vm_offset_t offset, mk_vm_address_t address, mk_error_t *error)
+{
+    const void *local = mk_memory_object_fast_pointer(mobj, offset, address, sizeof(uint16_t));
+    if (__builtin_expect(local == NULL, 0))
+        return mk_memory_object_read_word(_mk_memory_object_slow_ref(mobj), offset, address, _mk_memory_object_no_data_model(), error);
+    
+    uint16_t value;
+    __builtin_memcpy(&value, local, sizeof(value));
+    MK_ERROR_OUT = MK_ESUCCESS;
+    return value;
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+static inline uint16_t
+mk_memory_object_read_word_swapped(const mk_memory_object_t *mobj, mk_vm_offset_t offset, mk_vm_address_t address, mk_error_t *error)
+{
+    const void *local = mk_memory_object_fast_pointer(mobj, offset, address, sizeof(uint16_t));
+    if (__builtin_expect(local == NULL, 0))
+        return mk_memory_object_read_word(_mk_memory_object_slow_ref(mobj), offset, address, _mk_memory_object_no_data_model(), error);
+    
+    uint16_t value;
+    __builtin_memcpy(&value, local, sizeof(value));
+    MK_ERROR_OUT = MK_ESUCCESS;
+    return __builtin_bswap16(value);
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+static inline uint16_t
+mk_memory_object_read_word_fast(const mk_memory_object_t *mobj, mk_vm_offset_t offset, mk_vm_address_t address, const mk_byteorder_t *byte_order, mk_error_t *error)
+{
+    switch (byte_order->kind) {
+        case MK_BYTEORDER_DIRECT:
+            return mk_memory_object_read_word_direct(mobj, offset, address, error);
+        case MK_BYTEORDER_SWAPPED:
+            return mk_memory_object_read_word_swapped(mobj, offset, address, error);
+        default:
+            return byte_order->swap16(mk_memory_object_read_word_direct(mobj, offset, address, error));
+    }
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+static inline uint32_t
+mk_memory_object_read_dword_direct(const mk_memory_object_t *mobj, mk_vm_offset_t offset, mk_vm_address_t address, mk_error_t *error)
+{
+    const void *local = mk_memory_object_fast_pointer(mobj, offset, address, sizeof(uint32_t));
+    if (__builtin_expect(local == NULL, 0))
+        return mk_memory_object_read_dword(_mk_memory_object_slow_ref(mobj), offset, address, _mk_memory_object_no_data_model(), error);
+    
+    uint32_t value;
+    __builtin_memcpy(&value, local, sizeof(value));
+    MK_ERROR_OUT = MK_ESUCCESS;
+    return value;
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+static inline uint32_t
+mk_memory_object_read_dword_swapped(const mk_memory_object_t *mobj, mk_vm_offset_t offset, mk_vm_address_t address, mk_error_t *error)
+{
+    const void *local = mk_memory_object_fast_pointer(mobj, offset, address, sizeof(uint32_t));
+    if (__builtin_expect(local == NULL, 0))
+        return mk_memory_object_read_dword(_mk_memory_object_slow_ref(mobj), offset, address, _mk_memory_object_no_data_model(), error);
+    
+    uint32_t value;
+    __builtin_memcpy(&value, local, sizeof(value));
+    MK_ERROR_OUT = MK_ESUCCESS;
+    return __builtin_bswap32(value);
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+static inline uint32_t
+mk_memory_object_read_dword_fast(const mk_memory_object_t *mobj, mk_vm_offset_t offset, mk_vm_address_t address, const mk_byteorder_t *byte_order, mk_error_t *error)
+{
+    switch (byte_order->kind) {
+        case MK_BYTEORDER_DIRECT:
+            return mk_memory_object_read_dword_direct(mobj, offset, address, error);
+        case MK_BYTEORDER_SWAPPED:
+            return mk_memory_object_read_dword_swapped(mobj, offset, address, error);
+        default:
+            return byte_order->swap32(mk_memory_object_read_dword_direct(mobj, offset, address, error));
+    }
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+static inline uint64_t
+mk_memory_object_read_qword_direct(const mk_memory_object_t *mobj, mk_vm_offset_t offset, mk_vm_address_t address, mk_error_t *error)
+{
+    const void *local = mk_memory_object_fast_pointer(mobj, offset, address, sizeof(uint64_t));
+    if (__builtin_expect(local == NULL, 0))
+        return mk_memory_object_read_qword(_mk_memory_object_slow_ref(mobj), offset, address, _mk_memory_object_no_data_model(), error);
+    
+    uint64_t value;
+    __builtin_memcpy(&value, local, sizeof(value));
+    MK_ERROR_OUT = MK_ESUCCESS;
+    return value;
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+static inline uint64_t
+mk_memory_object_read_qword_swapped(const mk_memory_object_t *mobj, mk_vm_offset_t offset, mk_vm_address_t address, mk_error_t *error)
+{
+    const void *local = mk_memory_object_fast_pointer(mobj, offset, address, sizeof(uint64_t));
+    if (__builtin_expect(local == NULL, 0))
+        return mk_memory_object_read_qword(_mk_memory_object_slow_ref(mobj), offset, address, _mk_memory_object_no_data_model(), error);
+    
+    uint64_t value;
+    __builtin_memcpy(&value, local, sizeof(value));
+    MK_ERROR_OUT = MK_ESUCCESS;
+    return __builtin_bswap64(value);
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+static inline uint64_t
+mk_memory_object_read_qword_fast(const mk_memory_object_t *mobj, mk_vm_offset_t offset, mk_vm_address_t address, const mk_byteorder_t *byte_order, mk_error_t *error)
+{
+    switch (byte_order->kind) {
+        case MK_BYTEORDER_DIRECT:
+            return mk_memory_object_read_qword_direct(mobj, offset, address, error);
+        case MK_BYTEORDER_SWAPPED:
+            return mk_memory_object_read_qword_swapped(mobj, offset, address, error);
+        default:
+            return byte_order->swap64(mk_memory_object_read_qword_direct(mobj, offset, address, error));
+    }
+}
+
+
 //! @} MEMORY_OBJECT !//
 
 #endif /* _memory_object_h */
@@ -48,6 +48,9 @@ typedef struct mk_context_s {
     void *user_data;
     //! Logging
     mk_logger_c logger;
+    //! Optional arena from which helpers such as \ref mk_macho_init_segments
+    //! allocate the objects they return.  May be \c NULL.
+    struct mk_arena_s *arena;
 } mk_context_t;
 
 
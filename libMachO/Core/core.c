@@ -185,7 +185,7 @@ mk_vm_address_check_length(mk_vm_address_t addr, mk_vm_size_t length)
 
 //|++++++++++++++++++++++++++++++++++++|//
 static uint16_t _mk_swap16 (uint16_t input)
-{ return OSSwapInt16(input); }
+{ return __builtin_bswap16(input); }
 
 //|++++++++++++++++++++++++++++++++++++|//
 static uint16_t _mk_nswap16 (uint16_t input)
@@ -193,7 +193,7 @@ static uint16_t _mk_nswap16 (uint16_t input)
 
 //|++++++++++++++++++++++++++++++++++++|//
 static uint32_t _mk_swap32 (uint32_t input)
-{ return OSSwapInt32(input); }
+{ return __builtin_bswap32(input); }
 
 //|++++++++++++++++++++++++++++++++++++|//
 static uint32_t _mk_nswap32 (uint32_t input)
@@ -201,7 +201,7 @@ static uint32_t _mk_nswap32 (uint32_t input)
 
 //|++++++++++++++++++++++++++++++++++++|//
 static uint64_t _mk_swap64 (uint64_t input)
-{ return OSSwapInt64(input); }
+{ return __builtin_bswap64(input); }
 
 //|++++++++++++++++++++++++++++++++++++|//
 static uint64_t _mk_nswap64 (uint64_t input)
@@ -225,17 +225,19 @@ static uint8_t* _mk_nswap (uint8_t *input, size_t __unused length)
 { return input; }
 
 const mk_byteorder_t mk_byteorder_direct = {
-    &_mk_nswap16,
-    &_mk_nswap32,
-    &_mk_nswap64,
-    &_mk_nswap
+    .swap16     = &_mk_nswap16,
+    .swap32     = &_mk_nswap32,
+    .swap64     = &_mk_nswap64,
+    .swap_any   = &_mk_nswap,
+    .kind       = MK_BYTEORDER_DIRECT
 };
 
 const mk_byteorder_t mk_byteorder_swapped = {
-    &_mk_swap16,
-    &_mk_swap32,
-    &_mk_swap64,
-    &_mk_swap
+    .swap16     = &_mk_swap16,
+    .swap32     = &_mk_swap32,
+    .swap64     = &_mk_swap64,
+    .swap_any   = &_mk_swap,
+    .kind       = MK_BYTEORDER_SWAPPED
 };
 
 //----------------------------------------------------------------------------//
@@ -217,6 +217,18 @@ mk_vm_address_check_length(mk_vm_address_t addr, mk_vm_size_t length);
 //! @name       Byte Order
 //----------------------------------------------------------------------------//
 
+//! Identifies the byte-swapping behavior of a \ref mk_byteorder_t so that
+//! callers can select an inlined swap instead of calling through the
+//! function pointers.
+typedef enum {
+    //! The swap functions must be called.
+    MK_BYTEORDER_CUSTOM = 0,
+    //! Values are not swapped.
+    MK_BYTEORDER_DIRECT,
+    //! Values are swapped.
+    MK_BYTEORDER_SWAPPED
+} mk_byteorder_kind_t;
+
 //◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
 //! A collection of byte swapping functions used to provide byte order neutral
 //! polymorphism when parsing Mach-O and other file formats.
@@ -230,17 +242,33 @@ typedef struct {
     uint64_t (*swap64)(uint64_t);
     //! The byte-swap function to use for arbitrary length values.
     uint8_t* (*swap_any)(uint8_t *input, size_t length);
+    //! The behavior of the swap functions.  Byte orders other than
+    //! \ref mk_byteorder_direct and \ref mk_byteorder_swapped should use
+    //! \ref MK_BYTEORDER_CUSTOM.
+    mk_byteorder_kind_t kind;
     
 #ifdef __cplusplus
 public:
     //! Byte swap a 16-bit value
-    uint16_t swap (uint16_t v) const { return swap16(v); }
+    uint16_t swap (uint16_t v) const {
+        if (kind == MK_BYTEORDER_DIRECT) return v;
+        if (kind == MK_BYTEORDER_SWAPPED) return __builtin_bswap16(v);
+        return swap16(v);
+    }
     //! Byte swap a 32-bit value
-    uint32_t swap (uint32_t v) const { return swap32(v); }
+    uint32_t swap (uint32_t v) const {
+        if (kind == MK_BYTEORDER_DIRECT) return v;
+        if (kind == MK_BYTEORDER_SWAPPED) return __builtin_bswap32(v);
+        return swap32(v);
+    }
     //! Byte swap a 64-bit value
-    uint64_t swap (uint64_t v) const { return swap64(v); }
+    uint64_t swap (uint64_t v) const {
+        if (kind == MK_BYTEORDER_DIRECT) return v;
+        if (kind == MK_BYTEORDER_SWAPPED) return __builtin_bswap64(v);
+        return swap64(v);
+    }
     //! Byte swap an arbitrary length value.
-    uint8_t* swap (uint8_t *input, size_t length) const { return swap(input, length); }
+    uint8_t* swap (uint8_t *input, size_t length) const { return swap_any(input, length); }
 #endif
 } mk_byteorder_t;
 
@@ -249,6 +277,51 @@ _mk_export const mk_byteorder_t mk_byteorder_direct;
 //! A \ref mk_byteorder_t that performs byte-swapping.
 _mk_export const mk_byteorder_t mk_byteorder_swapped;
 
+//! Byte swaps the 16-bit \a value according to \a byte_order.  The swap
+//! is inlined for \ref mk_byteorder_direct and \ref mk_byteorder_swapped.
+static inline uint16_t
+mk_byteorder_swap16(const mk_byteorder_t *byte_order, uint16_t value)
+{
+    switch (byte_order->kind) {
+        case MK_BYTEORDER_DIRECT:
+            return value;
+        case MK_BYTEORDER_SWAPPED:
+            return __builtin_bswap16(value);
+        default:
+            return byte_order->swap16(value);
+    }
+}
+
+//! Byte swaps the 32-bit \a value according to \a byte_order.  The swap
+//! is inlined for \ref mk_byteorder_direct and \ref mk_byteorder_swapped.
+static inline uint32_t
+mk_byteorder_swap32(const mk_byteorder_t *byte_order, uint32_t value)
+{
+    switch (byte_order->kind) {
+        case MK_BYTEORDER_DIRECT:
+            return value;
+        case MK_BYTEORDER_SWAPPED:
+            return __builtin_bswap32(value);
+        default:
+            return byte_order->swap32(value);
+    }
+}
+
+//! Byte swaps the 64-bit \a value according to \a byte_order.  The swap
+//! is inlined for \ref mk_byteorder_direct and \ref mk_byteorder_swapped.
+static inline uint64_t
+mk_byteorder_swap64(const mk_byteorder_t *byte_order, uint64_t value)
+{
+    switch (byte_order->kind) {
+        case MK_BYTEORDER_DIRECT:
+            return value;
+        case MK_BYTEORDER_SWAPPED:
+            return __builtin_bswap64(value);
+        default:
+            return byte_order->swap64(value);
+    }
+}
+
 
 //----------------------------------------------------------------------------//
 #pragma mark -  Runtime
@@ -300,8 +373,11 @@ mk_type_copy_description(mk_type_ref mk, char* output, size_t output_len);
 #include "context.h"
 #include "data_model.h"
 #include "memory_map.h"
+#include "mapping_cache.h"
+#include "arena.h"
 #include "memory_map_task.h"
 #include "memory_map_self.h"
+#include "memory_map_file.h"
 
 
 //! @} CORE !//
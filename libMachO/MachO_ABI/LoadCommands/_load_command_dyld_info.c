@@ -65,18 +65,18 @@ _mk_load_command_type_dyld_info_copy_native(mk_load_command_ref load_command, st
     const mk_byteorder_t * const byte_order = mk_macho_get_byte_order(load_command.load_command->image);
     struct dyld_info_command *mach_dyld_info_command = (struct dyld_info_command*)load_command.load_command->mach_load_command;
     
-    result->cmd = byte_order->swap32( mach_dyld_info_command->cmd );
-    result->cmdsize = byte_order->swap32( mach_dyld_info_command->cmdsize );
-    result->rebase_off = byte_order->swap32( mach_dyld_info_command->rebase_off );
-    result->rebase_size = byte_order->swap32( mach_dyld_info_command->rebase_size );
-    result->bind_off = byte_order->swap32( mach_dyld_info_command->bind_off );
-    result->bind_size = byte_order->swap32( mach_dyld_info_command->bind_size );
-    result->weak_bind_off = byte_order->swap32( mach_dyld_info_command->weak_bind_off );
-    result->weak_bind_size = byte_order->swap32( mach_dyld_info_command->weak_bind_size );
-    result->lazy_bind_off = byte_order->swap32( mach_dyld_info_command->lazy_bind_off );
-    result->lazy_bind_size = byte_order->swap32( mach_dyld_info_command->lazy_bind_size );
-    result->export_off = byte_order->swap32( mach_dyld_info_command->export_off );
-    result->export_size = byte_order->swap32( mach_dyld_info_command->export_size );
+    result->cmd = mk_byteorder_swap32(byte_order, mach_dyld_info_command->cmd);
+    result->cmdsize = mk_byteorder_swap32(byte_order, mach_dyld_info_command->cmdsize);
+    result->rebase_off = mk_byteorder_swap32(byte_order, mach_dyld_info_command->rebase_off);
+    result->rebase_size = mk_byteorder_swap32(byte_order, mach_dyld_info_command->rebase_size);
+    result->bind_off = mk_byteorder_swap32(byte_order, mach_dyld_info_command->bind_off);
+    result->bind_size = mk_byteorder_swap32(byte_order, mach_dyld_info_command->bind_size);
+    result->weak_bind_off = mk_byteorder_swap32(byte_order, mach_dyld_info_command->weak_bind_off);
+    result->weak_bind_size = mk_byteorder_swap32(byte_order, mach_dyld_info_command->weak_bind_size);
+    result->lazy_bind_off = mk_byteorder_swap32(byte_order, mach_dyld_info_command->lazy_bind_off);
+    result->lazy_bind_size = mk_byteorder_swap32(byte_order, mach_dyld_info_command->lazy_bind_size);
+    result->export_off = mk_byteorder_swap32(byte_order, mach_dyld_info_command->export_off);
+    result->export_size = mk_byteorder_swap32(byte_order, mach_dyld_info_command->export_size);
     
     return MK_ESUCCESS;
 }
@@ -86,7 +86,7 @@ uint32_t
 _mk_load_command_type_dyld_info_get_rebase_off(mk_load_command_ref load_command)
 {
     struct dyld_info_command *mach_dyld_info_command = (struct dyld_info_command*)load_command.load_command->mach_load_command;
-    return mk_macho_get_byte_order(load_command.load_command->image)->swap32( mach_dyld_info_command->rebase_off );
+    return mk_byteorder_swap32(mk_macho_get_byte_order(load_command.load_command->image), mach_dyld_info_command->rebase_off);
 }
 
 //|++++++++++++++++++++++++++++++++++++|//
@@ -94,7 +94,7 @@ uint32_t
 _mk_load_command_type_dyld_info_get_rebase_size(mk_load_command_ref load_command)
 {
     struct dyld_info_command *mach_dyld_info_command = (struct dyld_info_command*)load_command.load_command->mach_load_command;
-    return mk_macho_get_byte_order(load_command.load_command->image)->swap32( mach_dyld_info_command->rebase_size );
+    return mk_byteorder_swap32(mk_macho_get_byte_order(load_command.load_command->image), mach_dyld_info_command->rebase_size);
 }
 
 //|++++++++++++++++++++++++++++++++++++|//
@@ -102,7 +102,7 @@ uint32_t
 _mk_load_command_type_dyld_info_get_bind_off(mk_load_command_ref load_command)
 {
     struct dyld_info_command *mach_dyld_info_command = (struct dyld_info_command*)load_command.load_command->mach_load_command;
-    return mk_macho_get_byte_order(load_command.load_command->image)->swap32( mach_dyld_info_command->bind_off );
+    return mk_byteorder_swap32(mk_macho_get_byte_order(load_command.load_command->image), mach_dyld_info_command->bind_off);
 }
 
 //|++++++++++++++++++++++++++++++++++++|//
@@ -110,7 +110,7 @@ uint32_t
 _mk_load_command_type_dyld_info_get_bind_size(mk_load_command_ref load_command)
 {
     struct dyld_info_command *mach_dyld_info_command = (struct dyld_info_command*)load_command.load_command->mach_load_command;
-    return mk_macho_get_byte_order(load_command.load_command->image)->swap32( mach_dyld_info_command->bind_size );
+    return mk_byteorder_swap32(mk_macho_get_byte_order(load_command.load_command->image), mach_dyld_info_command->bind_size);
 }
 
 //|++++++++++++++++++++++++++++++++++++|//
@@ -118,7 +118,7 @@ uint32_t
 _mk_load_command_type_dyld_info_get_weak_bind_off(mk_load_command_ref load_command)
 {
     struct dyld_info_command *mach_dyld_info_command = (struct dyld_info_command*)load_command.load_command->mach_load_command;
-    return mk_macho_get_byte_order(load_command.load_command->image)->swap32( mach_dyld_info_command->weak_bind_off );
+    return mk_byteorder_swap32(mk_macho_get_byte_order(load_command.load_command->image), mach_dyld_info_command->weak_bind_off);
 }
 
 //|++++++++++++++++++++++++++++++++++++|//
@@ -126,7 +126,7 @@ uint32_t
 _mk_load_command_type_dyld_info_get_weak_bind_size(mk_load_command_ref load_command)
 {
     struct dyld_info_command *mach_dyld_info_command = (struct dyld_info_command*)load_command.load_command->mach_load_command;
-    return mk_macho_get_byte_order(load_command.load_command->image)->swap32( mach_dyld_info_command->weak_bind_size );
+    return mk_byteorder_swap32(mk_macho_get_byte_order(load_command.load_command->image), mach_dyld_info_command->weak_bind_size);
 }
 
 //|++++++++++++++++++++++++++++++++++++|//
@@ -134,7 +134,7 @@ uint32_t
 _mk_load_command_type_dyld_info_get_lazy_bind_off(mk_load_command_ref load_command)
 {
     struct dyld_info_command *mach_dyld_info_command = (struct dyld_info_command*)load_command.load_command->mach_load_command;
-    return mk_macho_get_byte_order(load_command.load_command->image)->swap32( mach_dyld_info_command->lazy_bind_off );
+    return mk_byteorder_swap32(mk_macho_get_byte_order(load_command.load_command->image), mach_dyld_info_command->lazy_bind_off);
 }
 
 //|++++++++++++++++++++++++++++++++++++|//
@@ -142,7 +142,7 @@ uint32_t
 _mk_load_command_type_dyld_info_get_lazy_bind_size(mk_load_command_ref load_command)
 {
     struct dyld_info_command *mach_dyld_info_command = (struct dyld_info_command*)load_command.load_command->mach_load_command;
-    return mk_macho_get_byte_order(load_command.load_command->image)->swap32( mach_dyld_info_command->lazy_bind_size );
+    return mk_byteorder_swap32(mk_macho_get_byte_order(load_command.load_command->image), mach_dyld_info_command->lazy_bind_size);
 }
 
 //|++++++++++++++++++++++++++++++++++++|//
@@ -150,7 +150,7 @@ uint32_t
 _mk_load_command_type_dyld_info_get_export_off(mk_load_command_ref load_command)
 {
     struct dyld_info_command *mach_dyld_info_command = (struct dyld_info_command*)load_command.load_command->mach_load_command;
-    return mk_macho_get_byte_order(load_command.load_command->image)->swap32( mach_dyld_info_command->export_off );
+    return mk_byteorder_swap32(mk_macho_get_byte_order(load_command.load_command->image), mach_dyld_info_command->export_off);
 }
 
 //|++++++++++++++++++++++++++++++++++++|//
@@ -158,5 +158,5 @@ uint32_t
 _mk_load_command_type_dyld_info_get_export_size(mk_load_command_ref load_command)
 {
     struct dyld_info_command *mach_dyld_info_command = (struct dyld_info_command*)load_command.load_command->mach_load_command;
-    return mk_macho_get_byte_order(load_command.load_command->image)->swap32( mach_dyld_info_command->export_size );
+    return mk_byteorder_swap32(mk_macho_get_byte_order(load_command.load_command->image), mach_dyld_info_command->export_size);
 }
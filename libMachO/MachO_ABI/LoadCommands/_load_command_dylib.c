@@ -56,11 +56,11 @@ _mk_load_command_type_dylib_copy_native(mk_load_command_ref load_command, struct
     const mk_byteorder_t * const byte_order = mk_macho_get_byte_order(load_command.load_command->image);
     struct dylib_command *mach_dylib_command = (struct dylib_command*)load_command.load_command->mach_load_command;
     
-    result->cmd = byte_order->swap32( mach_dylib_command->cmd );
-    result->cmdsize = byte_order->swap32( mach_dylib_command->cmdsize );
-    result->dylib.timestamp = byte_order->swap32( mach_dylib_command->dylib.timestamp );
-    result->dylib.current_version = byte_order->swap32( mach_dylib_command->dylib.current_version );
-    result->dylib.compatibility_version = byte_order->swap32( mach_dylib_command->dylib.compatibility_version );
+    result->cmd = mk_byteorder_swap32(byte_order, mach_dylib_command->cmd);
+    result->cmdsize = mk_byteorder_swap32(byte_order, mach_dylib_command->cmdsize);
+    result->dylib.timestamp = mk_byteorder_swap32(byte_order, mach_dylib_command->dylib.timestamp);
+    result->dylib.current_version = mk_byteorder_swap32(byte_order, mach_dylib_command->dylib.current_version);
+    result->dylib.compatibility_version = mk_byteorder_swap32(byte_order, mach_dylib_command->dylib.compatibility_version);
     _mk_mach_lc_str_copy_native(load_command,
                                 &mach_dylib_command->dylib.name,
                                 (struct load_command*)result,
@@ -75,7 +75,7 @@ uint32_t
 _mk_load_command_type_dylib_get_timestamp(mk_load_command_ref load_command)
 {
     struct dylib_command *mach_dylib_command = (struct dylib_command*)load_command.load_command->mach_load_command;
-    return mk_macho_get_byte_order(load_command.load_command->image)->swap32( mach_dylib_command->dylib.timestamp );
+    return mk_byteorder_swap32(mk_macho_get_byte_order(load_command.load_command->image), mach_dylib_command->dylib.timestamp);
 }
 
 //|++++++++++++++++++++++++++++++++++++|//
@@ -83,7 +83,7 @@ uint32_t
 _mk_load_command_type_dylib_get_current_version(mk_load_command_ref load_command)
 {
     struct dylib_command *mach_dylib_command = (struct dylib_command*)load_command.load_command->mach_load_command;
-    return mk_macho_get_byte_order(load_command.load_command->image)->swap32( mach_dylib_command->dylib.current_version );
+    return mk_byteorder_swap32(mk_macho_get_byte_order(load_command.load_command->image), mach_dylib_command->dylib.current_version);
 }
 
 //|++++++++++++++++++++++++++++++++++++|//
@@ -91,7 +91,7 @@ uint32_t
 _mk_load_command_type_dylib_get_current_compatibility_version(mk_load_command_ref load_command)
 {
     struct dylib_command *mach_dylib_command = (struct dylib_command*)load_command.load_command->mach_load_command;
-    return mk_macho_get_byte_order(load_command.load_command->image)->swap32( mach_dylib_command->dylib.compatibility_version );
+    return mk_byteorder_swap32(mk_macho_get_byte_order(load_command.load_command->image), mach_dylib_command->dylib.compatibility_version);
 }
 
 //|++++++++++++++++++++++++++++++++++++|//
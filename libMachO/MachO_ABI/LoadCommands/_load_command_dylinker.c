@@ -50,8 +50,8 @@ _mk_load_command_type_dylinker_copy_native(mk_load_command_ref load_command, str
     const mk_byteorder_t * const byte_order = mk_macho_get_byte_order(load_command.load_command->image);
     struct dylinker_command *mach_dylinker_command = (struct dylinker_command*)load_command.load_command->mach_load_command;
     
-    result->cmd = byte_order->swap32( mach_dylinker_command->cmd );
-    result->cmdsize = byte_order->swap32( mach_dylinker_command->cmdsize );
+    result->cmd = mk_byteorder_swap32(byte_order, mach_dylinker_command->cmd);
+    result->cmdsize = mk_byteorder_swap32(byte_order, mach_dylinker_command->cmdsize);
     _mk_mach_lc_str_copy_native(load_command,
                                 &mach_dylinker_command->name,
                                 (struct load_command*)result,
@@ -49,10 +49,10 @@ _mk_load_command_type_linkedit_copy_native(mk_load_command_ref load_command, str
     const mk_byteorder_t * const byte_order = mk_macho_get_byte_order(load_command.load_command->image);
     struct linkedit_data_command *mach_code_signature_command = (struct linkedit_data_command*)load_command.load_command->mach_load_command;
     
-    result->cmd = byte_order->swap32( mach_code_signature_command->cmd );
-    result->cmdsize = byte_order->swap32( mach_code_signature_command->cmdsize );
-    result->dataoff = byte_order->swap32( mach_code_signature_command->dataoff );
-    result->datasize = byte_order->swap32( mach_code_signature_command->datasize );
+    result->cmd = mk_byteorder_swap32(byte_order, mach_code_signature_command->cmd);
+    result->cmdsize = mk_byteorder_swap32(byte_order, mach_code_signature_command->cmdsize);
+    result->dataoff = mk_byteorder_swap32(byte_order, mach_code_signature_command->dataoff);
+    result->datasize = mk_byteorder_swap32(byte_order, mach_code_signature_command->datasize);
     
     return MK_ESUCCESS;
 }
@@ -62,7 +62,7 @@ uint32_t
 _mk_load_command_type_linkedit_get_dataoff(mk_load_command_ref load_command)
 {
     struct linkedit_data_command *mach_code_signature_command = (struct linkedit_data_command*)load_command.load_command->mach_load_command;
-    return mk_macho_get_byte_order(load_command.load_command->image)->swap32( mach_code_signature_command->dataoff );
+    return mk_byteorder_swap32(mk_macho_get_byte_order(load_command.load_command->image), mach_code_signature_command->dataoff);
 }
 
 //|++++++++++++++++++++++++++++++++++++|//
@@ -70,5 +70,5 @@ uint32_t
 _mk_load_command_type_linkedit_get_datasize(mk_load_command_ref load_command)
 {
     struct linkedit_data_command *mach_code_signature_command = (struct linkedit_data_command*)load_command.load_command->mach_load_command;
-    return mk_macho_get_byte_order(load_command.load_command->image)->swap32( mach_code_signature_command->datasize );
+    return mk_byteorder_swap32(mk_macho_get_byte_order(load_command.load_command->image), mach_code_signature_command->datasize);
 }
@@ -95,26 +95,26 @@ mk_load_command_dysymtab_copy_native(mk_load_command_ref load_command, struct dy
     const mk_byteorder_t * const byte_order = mk_macho_get_byte_order(load_command.load_command->image);
     struct dysymtab_command *mach_dsymtab_command = (struct dysymtab_command*)load_command.load_command->mach_load_command;
     
-    result->cmd = byte_order->swap32( mach_dsymtab_command->cmd );
-    result->cmdsize = byte_order->swap32( mach_dsymtab_command->cmdsize );
-    result->ilocalsym = byte_order->swap32( mach_dsymtab_command->ilocalsym );
-    result->nlocalsym = byte_order->swap32( mach_dsymtab_command->nlocalsym );
-    result->iextdefsym = byte_order->swap32( mach_dsymtab_command->iextdefsym );
-    result->nextdefsym = byte_order->swap32( mach_dsymtab_command->nextdefsym );
-    result->iundefsym = byte_order->swap32( mach_dsymtab_command->iundefsym );
-    result->nundefsym = byte_order->swap32( mach_dsymtab_command->nundefsym );
-    result->tocoff = byte_order->swap32( mach_dsymtab_command->tocoff );
-    result->ntoc = byte_order->swap32( mach_dsymtab_command->ntoc );
-    result->modtaboff = byte_order->swap32( mach_dsymtab_command->modtaboff );
-    result->nmodtab = byte_order->swap32( mach_dsymtab_command->nmodtab );
-    result->extrefsymoff = byte_order->swap32( mach_dsymtab_command->extrefsymoff );
-    result->nextrefsyms = byte_order->swap32( mach_dsymtab_command->nextrefsyms );
-    result->indirectsymoff = byte_order->swap32( mach_dsymtab_command->indirectsymoff );
-    result->nindirectsyms = byte_order->swap32( mach_dsymtab_command->nindirectsyms );
-    result->extreloff = byte_order->swap32( mach_dsymtab_command->extreloff );
-    result->nextrel = byte_order->swap32( mach_dsymtab_command->nextrel );
-    result->locreloff = byte_order->swap32( mach_dsymtab_command->locreloff );
-    result->nlocrel = byte_order->swap32( mach_dsymtab_command->nlocrel );
+    result->cmd = mk_byteorder_swap32(byte_order, mach_dsymtab_command->cmd);
+    result->cmdsize = mk_byteorder_swap32(byte_order, mach_dsymtab_command->cmdsize);
+    result->ilocalsym = mk_byteorder_swap32(byte_order, mach_dsymtab_command->ilocalsym);
+    result->nlocalsym = mk_byteorder_swap32(byte_order, mach_dsymtab_command->nlocalsym);
+    result->iextdefsym = mk_byteorder_swap32(byte_order, mach_dsymtab_command->iextdefsym);
+    result->nextdefsym = mk_byteorder_swap32(byte_order, mach_dsymtab_command->nextdefsym);
+    result->iundefsym = mk_byteorder_swap32(byte_order, mach_dsymtab_command->iundefsym);
+    result->nundefsym = mk_byteorder_swap32(byte_order, mach_dsymtab_command->nundefsym);
+    result->tocoff = mk_byteorder_swap32(byte_order, mach_dsymtab_command->tocoff);
+    result->ntoc = mk_byteorder_swap32(byte_order, mach_dsymtab_command->ntoc);
+    result->modtaboff = mk_byteorder_swap32(byte_order, mach_dsymtab_command->modtaboff);
+    result->nmodtab = mk_byteorder_swap32(byte_order, mach_dsymtab_command->nmodtab);
+    result->extrefsymoff = mk_byteorder_swap32(byte_order, mach_dsymtab_command->extrefsymoff);
+    result->nextrefsyms = mk_byteorder_swap32(byte_order, mach_dsymtab_command->nextrefsyms);
+    result->indirectsymoff = mk_byteorder_swap32(byte_order, mach_dsymtab_command->indirectsymoff);
+    result->nindirectsyms = mk_byteorder_swap32(byte_order, mach_dsymtab_command->nindirectsyms);
+    result->extreloff = mk_byteorder_swap32(byte_order, mach_dsymtab_command->extreloff);
+    result->nextrel = mk_byteorder_swap32(byte_order, mach_dsymtab_command->nextrel);
+    result->locreloff = mk_byteorder_swap32(byte_order, mach_dsymtab_command->locreloff);
+    result->nlocrel = mk_byteorder_swap32(byte_order, mach_dsymtab_command->nlocrel);
     
     return MK_ESUCCESS;
 }
@@ -127,7 +127,7 @@ mk_load_command_dysymtab_get_ilocalsym(mk_load_command_ref load_command)
     _MK_LOAD_COMMAND_IS_A(load_command, _mk_load_command_dysymtab_class, return UINT32_MAX);
     
     struct dysymtab_command *mach_dsymtab_command = (struct dysymtab_command*)load_command.load_command->mach_load_command;
-    return mk_macho_get_byte_order(load_command.load_command->image)->swap32( mach_dsymtab_command->ilocalsym );
+    return mk_byteorder_swap32(mk_macho_get_byte_order(load_command.load_command->image), mach_dsymtab_command->ilocalsym);
 }
 
 //|++++++++++++++++++++++++++++++++++++|//
@@ -138,7 +138,7 @@ mk_load_command_dysymtab_get_nlocalsym(mk_load_command_ref load_command)
     _MK_LOAD_COMMAND_IS_A(load_command, _mk_load_command_dysymtab_class, return UINT32_MAX);
     
     struct dysymtab_command *mach_dsymtab_command = (struct dysymtab_command*)load_command.load_command->mach_load_command;
-    return mk_macho_get_byte_order(load_command.load_command->image)->swap32( mach_dsymtab_command->nlocalsym );
+    return mk_byteorder_swap32(mk_macho_get_byte_order(load_command.load_command->image), mach_dsymtab_command->nlocalsym);
 }
 
 //|++++++++++++++++++++++++++++++++++++|//
@@ -149,7 +149,7 @@ mk_load_command_dysymtab_get_iextdefsym(mk_load_command_ref load_command)
     _MK_LOAD_COMMAND_IS_A(load_command, _mk_load_command_dysymtab_class, return UINT32_MAX);
     
     struct dysymtab_command *mach_dsymtab_command = (struct dysymtab_command*)load_command.load_command->mach_load_command;
-    return mk_macho_get_byte_order(load_command.load_command->image)->swap32( mach_dsymtab_command->iextdefsym );
+    return mk_byteorder_swap32(mk_macho_get_byte_order(load_command.load_command->image), mach_dsymtab_command->iextdefsym);
 }
 
 //|++++++++++++++++++++++++++++++++++++|//
@@ -160,7 +160,7 @@ mk_load_command_dysymtab_get_nextdefsym(mk_load_command_ref load_command)
     _MK_LOAD_COMMAND_IS_A(load_command, _mk_load_command_dysymtab_class, return UINT32_MAX);
     
     struct dysymtab_command *mach_dsymtab_command = (struct dysymtab_command*)load_command.load_command->mach_load_command;
-    return mk_macho_get_byte_order(load_command.load_command->image)->swap32( mach_dsymtab_command->nextdefsym );
+    return mk_byteorder_swap32(mk_macho_get_byte_order(load_command.load_command->image), mach_dsymtab_command->nextdefsym);
 }
 
 //|++++++++++++++++++++++++++++++++++++|//
@@ -171,7 +171,7 @@ mk_load_command_dysymtab_get_iundefsym(mk_load_command_ref load_command)
     _MK_LOAD_COMMAND_IS_A(load_command, _mk_load_command_dysymtab_class, return UINT32_MAX);
     
     struct dysymtab_command *mach_dsymtab_command = (struct dysymtab_command*)load_command.load_command->mach_load_command;
-    return mk_macho_get_byte_order(load_command.load_command->image)->swap32( mach_dsymtab_command->iundefsym );
+    return mk_byteorder_swap32(mk_macho_get_byte_order(load_command.load_command->image), mach_dsymtab_command->iundefsym);
 }
 
 //|++++++++++++++++++++++++++++++++++++|//
@@ -182,7 +182,7 @@ mk_load_command_dysymtab_get_nundefsym(mk_load_command_ref load_command)
     _MK_LOAD_COMMAND_IS_A(load_command, _mk_load_command_dysymtab_class, return UINT32_MAX);
     
     struct dysymtab_command *mach_dsymtab_command = (struct dysymtab_command*)load_command.load_command->mach_load_command;
-    return mk_macho_get_byte_order(load_command.load_command->image)->swap32( mach_dsymtab_command->nundefsym );
+    return mk_byteorder_swap32(mk_macho_get_byte_order(load_command.load_command->image), mach_dsymtab_command->nundefsym);
 }
 
 //|++++++++++++++++++++++++++++++++++++|//
@@ -193,7 +193,7 @@ mk_load_command_dysymtab_get_tocoff(mk_load_command_ref load_command)
     _MK_LOAD_COMMAND_IS_A(load_command, _mk_load_command_dysymtab_class, return UINT32_MAX);
     
     struct dysymtab_command *mach_dsymtab_command = (struct dysymtab_command*)load_command.load_command->mach_load_command;
-    return mk_macho_get_byte_order(load_command.load_command->image)->swap32( mach_dsymtab_command->tocoff );
+    return mk_byteorder_swap32(mk_macho_get_byte_order(load_command.load_command->image), mach_dsymtab_command->tocoff);
 }
 
 //|++++++++++++++++++++++++++++++++++++|//
@@ -204,7 +204,7 @@ mk_load_command_dysymtab_get_ntoc(mk_load_command_ref load_command)
     _MK_LOAD_COMMAND_IS_A(load_command, _mk_load_command_dysymtab_class, return UINT32_MAX);
     
     struct dysymtab_command *mach_dsymtab_command = (struct dysymtab_command*)load_command.load_command->mach_load_command;
-    return mk_macho_get_byte_order(load_command.load_command->image)->swap32( mach_dsymtab_command->ntoc );
+    return mk_byteorder_swap32(mk_macho_get_byte_order(load_command.load_command->image), mach_dsymtab_command->ntoc);
 }
 
 //|++++++++++++++++++++++++++++++++++++|//
@@ -215,7 +215,7 @@ mk_load_command_dysymtab_get_modtaboff(mk_load_command_ref load_command)
     _MK_LOAD_COMMAND_IS_A(load_command, _mk_load_command_dysymtab_class, return UINT32_MAX);
     
     struct dysymtab_command *mach_dsymtab_command = (struct dysymtab_command*)load_command.load_command->mach_load_command;
-    return mk_macho_get_byte_order(load_command.load_command->image)->swap32( mach_dsymtab_command->modtaboff );
+    return mk_byteorder_swap32(mk_macho_get_byte_order(load_command.load_command->image), mach_dsymtab_command->modtaboff);
 }
 
 //|++++++++++++++++++++++++++++++++++++|//
@@ -226,7 +226,7 @@ mk_load_command_dysymtab_get_nmodtab(mk_load_command_ref load_command)
     _MK_LOAD_COMMAND_IS_A(load_command, _mk_load_command_dysymtab_class, return UINT32_MAX);
     
     struct dysymtab_command *mach_dsymtab_command = (struct dysymtab_command*)load_command.load_command->mach_load_command;
-    return mk_macho_get_byte_order(load_command.load_command->image)->swap32( mach_dsymtab_command->nmodtab );
+    return mk_byteorder_swap32(mk_macho_get_byte_order(load_command.load_command->image), mach_dsymtab_command->nmodtab);
 }
 
 //|++++++++++++++++++++++++++++++++++++|//
@@ -237,7 +237,7 @@ mk_load_command_dysymtab_get_extrefsymoff(mk_load_command_ref load_command)
     _MK_LOAD_COMMAND_IS_A(load_command, _mk_load_command_dysymtab_class, return UINT32_MAX);
     
     struct dysymtab_command *mach_dsymtab_command = (struct dysymtab_command*)load_command.load_command->mach_load_command;
-    return mk_macho_get_byte_order(load_command.load_command->image)->swap32( mach_dsymtab_command->extrefsymoff );
+    return mk_byteorder_swap32(mk_macho_get_byte_order(load_command.load_command->image), mach_dsymtab_command->extrefsymoff);
 }
 
 //|++++++++++++++++++++++++++++++++++++|//
@@ -248,7 +248,7 @@ mk_load_command_dysymtab_get_nextrefsyms(mk_load_command_ref load_command)
     _MK_LOAD_COMMAND_IS_A(load_command, _mk_load_command_dysymtab_class, return UINT32_MAX);
     
     struct dysymtab_command *mach_dsymtab_command = (struct dysymtab_command*)load_command.load_command->mach_load_command;
-    return mk_macho_get_byte_order(load_command.load_command->image)->swap32( mach_dsymtab_command->nextrefsyms );
+    return mk_byteorder_swap32(mk_macho_get_byte_order(load_command.load_command->image), mach_dsymtab_command->nextrefsyms);
 }
 
 //|++++++++++++++++++++++++++++++++++++|//
@@ -259,7 +259,7 @@ mk_load_command_dysymtab_get_indirectsymoff(mk_load_command_ref load_command)
     _MK_LOAD_COMMAND_IS_A(load_command, _mk_load_command_dysymtab_class, return UINT32_MAX);
     
     struct dysymtab_command *mach_dsymtab_command = (struct dysymtab_command*)load_command.load_command->mach_load_command;
-    return mk_macho_get_byte_order(load_command.load_command->image)->swap32( mach_dsymtab_command->indirectsymoff );
+    return mk_byteorder_swap32(mk_macho_get_byte_order(load_command.load_command->image), mach_dsymtab_command->indirectsymoff);
 }
 
 //|++++++++++++++++++++++++++++++++++++|//
@@ -270,7 +270,7 @@ mk_load_command_dysymtab_get_nindirectsyms(mk_load_command_ref load_command)
     _MK_LOAD_COMMAND_IS_A(load_command, _mk_load_command_dysymtab_class, return UINT32_MAX);
     
     struct dysymtab_command *mach_dsymtab_command = (struct dysymtab_command*)load_command.load_command->mach_load_command;
-    return mk_macho_get_byte_order(load_command.load_command->image)->swap32( mach_dsymtab_command->nindirectsyms );
+    return mk_byteorder_swap32(mk_macho_get_byte_order(load_command.load_command->image), mach_dsymtab_command->nindirectsyms);
 }
 
 //|++++++++++++++++++++++++++++++++++++|//
@@ -281,7 +281,7 @@ mk_load_command_dysymtab_get_extreloff(mk_load_command_ref load_command)
     _MK_LOAD_COMMAND_IS_A(load_command, _mk_load_command_dysymtab_class, return UINT32_MAX);
     
     struct dysymtab_command *mach_dsymtab_command = (struct dysymtab_command*)load_command.load_command->mach_load_command;
-    return mk_macho_get_byte_order(load_command.load_command->image)->swap32( mach_dsymtab_command->extreloff );
+    return mk_byteorder_swap32(mk_macho_get_byte_order(load_command.load_command->image), mach_dsymtab_command->extreloff);
 }
 
 //|++++++++++++++++++++++++++++++++++++|//
@@ -292,7 +292,7 @@ mk_load_command_dysymtab_get_nextrel(mk_load_command_ref load_command)
     _MK_LOAD_COMMAND_IS_A(load_command, _mk_load_command_dysymtab_class, return UINT32_MAX);
     
     struct dysymtab_command *mach_dsymtab_command = (struct dysymtab_command*)load_command.load_command->mach_load_command;
-    return mk_macho_get_byte_order(load_command.load_command->image)->swap32( mach_dsymtab_command->nextrel );
+    return mk_byteorder_swap32(mk_macho_get_byte_order(load_command.load_command->image), mach_dsymtab_command->nextrel);
 }
 
 //|++++++++++++++++++++++++++++++++++++|//
@@ -303,7 +303,7 @@ mk_load_command_dysymtab_get_locreloff(mk_load_command_ref load_command)
     _MK_LOAD_COMMAND_IS_A(load_command, _mk_load_command_dysymtab_class, return UINT32_MAX);
     
     struct dysymtab_command *mach_dsymtab_command = (struct dysymtab_command*)load_command.load_command->mach_load_command;
-    return mk_macho_get_byte_order(load_command.load_command->image)->swap32( mach_dsymtab_command->locreloff );
+    return mk_byteorder_swap32(mk_macho_get_byte_order(load_command.load_command->image), mach_dsymtab_command->locreloff);
 }
 
 //|++++++++++++++++++++++++++++++++++++|//
@@ -314,5 +314,5 @@ mk_load_command_dysymtab_get_nlocrel(mk_load_command_ref load_command)
     _MK_LOAD_COMMAND_IS_A(load_command, _mk_load_command_dysymtab_class, return UINT32_MAX);
     
     struct dysymtab_command *mach_dsymtab_command = (struct dysymtab_command*)load_command.load_command->mach_load_command;
-    return mk_macho_get_byte_order(load_command.load_command->image)->swap32( mach_dsymtab_command->nlocrel );
+    return mk_byteorder_swap32(mk_macho_get_byte_order(load_command.load_command->image), mach_dsymtab_command->nlocrel);
 }
@@ -63,11 +63,11 @@ mk_load_command_encryption_info_copy_native(mk_load_command_ref load_command, st
     const mk_byteorder_t * const byte_order = mk_macho_get_byte_order(load_command.load_command->image);
     struct encryption_info_command *mach_encryption_info_command = (struct encryption_info_command*)load_command.load_command->mach_load_command;
     
-    result->cmd = byte_order->swap32( mach_encryption_info_command->cmd );
-    result->cmdsize = byte_order->swap32( mach_encryption_info_command->cmdsize );
-    result->cryptoff = byte_order->swap32( mach_encryption_info_command->cryptoff );
-    result->cryptsize = byte_order->swap32( mach_encryption_info_command->cryptsize );
-    result->cryptid = byte_order->swap32( mach_encryption_info_command->cryptid );
+    result->cmd = mk_byteorder_swap32(byte_order, mach_encryption_info_command->cmd);
+    result->cmdsize = mk_byteorder_swap32(byte_order, mach_encryption_info_command->cmdsize);
+    result->cryptoff = mk_byteorder_swap32(byte_order, mach_encryption_info_command->cryptoff);
+    result->cryptsize = mk_byteorder_swap32(byte_order, mach_encryption_info_command->cryptsize);
+    result->cryptid = mk_byteorder_swap32(byte_order, mach_encryption_info_command->cryptid);
     
     return MK_ESUCCESS;
 }
@@ -80,7 +80,7 @@ mk_load_command_encryption_info_get_cryptoff(mk_load_command_ref load_command)
     _MK_LOAD_COMMAND_IS_A(load_command, _mk_load_command_encryption_info_class, return UINT32_MAX);
     
     struct encryption_info_command *mach_encryption_info_command = (struct encryption_info_command*)load_command.load_command->mach_load_command;
-    return mk_macho_get_byte_order(load_command.load_command->image)->swap32( mach_encryption_info_command->cryptoff );
+    return mk_byteorder_swap32(mk_macho_get_byte_order(load_command.load_command->image), mach_encryption_info_command->cryptoff);
 }
 
 //|++++++++++++++++++++++++++++++++++++|//
@@ -91,7 +91,7 @@ mk_load_command_encryption_info_get_cryptsize(mk_load_command_ref load_command)
     _MK_LOAD_COMMAND_IS_A(load_command, _mk_load_command_encryption_info_class, return UINT32_MAX);
     
     struct encryption_info_command *mach_encryption_info_command = (struct encryption_info_command*)load_command.load_command->mach_load_command;
-    return mk_macho_get_byte_order(load_command.load_command->image)->swap32( mach_encryption_info_command->cryptsize );
+    return mk_byteorder_swap32(mk_macho_get_byte_order(load_command.load_command->image), mach_encryption_info_command->cryptsize);
 }
 
 //|++++++++++++++++++++++++++++++++++++|//
@@ -102,5 +102,5 @@ mk_load_command_encryption_info_get_cryptid(mk_load_command_ref load_command)
     _MK_LOAD_COMMAND_IS_A(load_command, _mk_load_command_encryption_info_class, return UINT32_MAX);
     
     struct encryption_info_command *mach_encryption_info_command = (struct encryption_info_command*)load_command.load_command->mach_load_command;
-    return mk_macho_get_byte_order(load_command.load_command->image)->swap32( mach_encryption_info_command->cryptid );
+    return mk_byteorder_swap32(mk_macho_get_byte_order(load_command.load_command->image), mach_encryption_info_command->cryptid);
 }
@@ -62,10 +62,10 @@ mk_load_command_main_copy_native(mk_load_command_ref load_command, struct entry_
     const mk_byteorder_t * const byte_order = mk_macho_get_byte_order(load_command.load_command->image);
     struct entry_point_command *mach_main_command = (struct entry_point_command*)load_command.load_command->mach_load_command;
     
-    result->cmd = byte_order->swap32( mach_main_command->cmd );
-    result->cmdsize = byte_order->swap32( mach_main_command->cmdsize );
-    result->entryoff = byte_order->swap64( mach_main_command->entryoff );
-    result->stacksize = byte_order->swap64( mach_main_command->stacksize );
+    result->cmd = mk_byteorder_swap32(byte_order, mach_main_command->cmd);
+    result->cmdsize = mk_byteorder_swap32(byte_order, mach_main_command->cmdsize);
+    result->entryoff = mk_byteorder_swap64(byte_order, mach_main_command->entryoff);
+    result->stacksize = mk_byteorder_swap64(byte_order, mach_main_command->stacksize);
     
     return MK_ESUCCESS;
 }
@@ -78,7 +78,7 @@ mk_load_command_main_get_entryoff(mk_load_command_ref load_command)
     _MK_LOAD_COMMAND_IS_A(load_command, _mk_load_command_main_class, return UINT64_MAX);
     
     struct entry_point_command *mach_main_command = (struct entry_point_command*)load_command.load_command->mach_load_command;
-    return mk_macho_get_byte_order(load_command.load_command->image)->swap64( mach_main_command->entryoff );
+    return mk_byteorder_swap64(mk_macho_get_byte_order(load_command.load_command->image), mach_main_command->entryoff);
 }
 
 //|++++++++++++++++++++++++++++++++++++|//
@@ -89,5 +89,5 @@ mk_load_command_main_get_stacksize(mk_load_command_ref load_command)
     _MK_LOAD_COMMAND_IS_A(load_command, _mk_load_command_main_class, return UINT64_MAX);
     
     struct entry_point_command *mach_main_command = (struct entry_point_command*)load_command.load_command->mach_load_command;
-    return mk_macho_get_byte_order(load_command.load_command->image)->swap64( mach_main_command->stacksize );
+    return mk_byteorder_swap64(mk_macho_get_byte_order(load_command.load_command->image), mach_main_command->stacksize);
 }
@@ -60,9 +60,9 @@ mk_load_command_prebind_cksum_copy_native(mk_load_command_ref load_command, stru
     const mk_byteorder_t * const byte_order = mk_macho_get_byte_order(load_command.load_command->image);
     struct prebind_cksum_command *mach_prebind_cksum_command = (struct prebind_cksum_command*)load_command.load_command->mach_load_command;
     
-    result->cmd = byte_order->swap32( mach_prebind_cksum_command->cmd );
-    result->cmdsize = byte_order->swap32( mach_prebind_cksum_command->cmdsize );
-    result->cksum = byte_order->swap32( mach_prebind_cksum_command->cksum );
+    result->cmd = mk_byteorder_swap32(byte_order, mach_prebind_cksum_command->cmd);
+    result->cmdsize = mk_byteorder_swap32(byte_order, mach_prebind_cksum_command->cmdsize);
+    result->cksum = mk_byteorder_swap32(byte_order, mach_prebind_cksum_command->cksum);
     
     return MK_ESUCCESS;
 }
@@ -75,5 +75,5 @@ mk_load_command_prebind_cksum_get_cksum(mk_load_command_ref load_command)
     _MK_LOAD_COMMAND_IS_A(load_command, _mk_load_command_prebind_cksum_class, return UINT8_MAX);
     
     struct prebind_cksum_command *mach_prebind_cksum_command = (struct prebind_cksum_command*)load_command.load_command->mach_load_command;
-    return mk_macho_get_byte_order(load_command.load_command->image)->swap32( mach_prebind_cksum_command->cksum );
+    return mk_byteorder_swap32(mk_macho_get_byte_order(load_command.load_command->image), mach_prebind_cksum_command->cksum);
 }
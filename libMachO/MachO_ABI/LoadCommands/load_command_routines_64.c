@@ -62,16 +62,16 @@ mk_load_command_routines_64_copy_native(mk_load_command_ref load_command, struct
     const mk_byteorder_t * const byte_order = mk_macho_get_byte_order(load_command.load_command->image);
     struct routines_command_64 *mach_routines_command = (struct routines_command_64*)load_command.load_command->mach_load_command;
     
-    result->cmd = byte_order->swap32( mach_routines_command->cmd );
-    result->cmdsize = byte_order->swap32( mach_routines_command->cmdsize );
-    result->init_address = byte_order->swap64( mach_routines_command->init_address );
-    result->init_module = byte_order->swap64( mach_routines_command->init_module );
-    result->reserved1 = byte_order->swap64( mach_routines_command->reserved1 );
-    result->reserved2 = byte_order->swap64( mach_routines_command->reserved2 );
-    result->reserved3 = byte_order->swap64( mach_routines_command->reserved3 );
-    result->reserved4 = byte_order->swap64( mach_routines_command->reserved4 );
-    result->reserved5 = byte_order->swap64( mach_routines_command->reserved5 );
-    result->reserved6 = byte_order->swap64( mach_routines_command->reserved6 );
+    result->cmd = mk_byteorder_swap32(byte_order, mach_routines_command->cmd);
+    result->cmdsize = mk_byteorder_swap32(byte_order, mach_routines_command->cmdsize);
+    result->init_address = mk_byteorder_swap64(byte_order, mach_routines_command->init_address);
+    result->init_module = mk_byteorder_swap64(byte_order, mach_routines_command->init_module);
+    result->reserved1 = mk_byteorder_swap64(byte_order, mach_routines_command->reserved1);
+    result->reserved2 = mk_byteorder_swap64(byte_order, mach_routines_command->reserved2);
+    result->reserved3 = mk_byteorder_swap64(byte_order, mach_routines_command->reserved3);
+    result->reserved4 = mk_byteorder_swap64(byte_order, mach_routines_command->reserved4);
+    result->reserved5 = mk_byteorder_swap64(byte_order, mach_routines_command->reserved5);
+    result->reserved6 = mk_byteorder_swap64(byte_order, mach_routines_command->reserved6);
     
     return MK_ESUCCESS;
 }
@@ -83,7 +83,7 @@ mk_load_command_routines_64_get_init_address(mk_load_command_ref load_command)
     _MK_LOAD_COMMAND_NOT_NULL(load_command, return UINT64_MAX);
     _MK_LOAD_COMMAND_IS_A(load_command, _mk_load_command_routines_64_class, return UINT64_MAX);
     struct routines_command_64 *mach_routines_command = (struct routines_command_64*)load_command.load_command->mach_load_command;
-    return mk_macho_get_byte_order(load_command.load_command->image)->swap64( mach_routines_command->init_address );
+    return mk_byteorder_swap64(mk_macho_get_byte_order(load_command.load_command->image), mach_routines_command->init_address);
 }
 
 //|++++++++++++++++++++++++++++++++++++|//
@@ -93,5 +93,5 @@ mk_load_command_routines_64_get_init_module(mk_load_command_ref load_command)
     _MK_LOAD_COMMAND_NOT_NULL(load_command, return UINT64_MAX);
     _MK_LOAD_COMMAND_IS_A(load_command, _mk_load_command_routines_64_class, return UINT64_MAX);
     struct routines_command_64 *mach_routines_command = (struct routines_command_64*)load_command.load_command->mach_load_command;
-    return mk_macho_get_byte_order(load_command.load_command->image)->swap64( mach_routines_command->init_module );
+    return mk_byteorder_swap64(mk_macho_get_byte_order(load_command.load_command->image), mach_routines_command->init_module);
 }
@@ -60,8 +60,8 @@ mk_load_command_rpath_copy_native(mk_load_command_ref load_command, struct rpath
     const mk_byteorder_t * const byte_order = mk_macho_get_byte_order(load_command.load_command->image);
     struct rpath_command *mach_rpath_command = (struct rpath_command*)load_command.load_command->mach_load_command;
     
-    result->cmd = byte_order->swap32( mach_rpath_command->cmd );
-    result->cmdsize = byte_order->swap32( mach_rpath_command->cmdsize );
+    result->cmd = mk_byteorder_swap32(byte_order, mach_rpath_command->cmd);
+    result->cmdsize = mk_byteorder_swap32(byte_order, mach_rpath_command->cmdsize);
     _mk_mach_lc_str_copy_native(load_command,
                                 &mach_rpath_command->path,
                                 (struct load_command*)result,
@@ -80,17 +80,17 @@ mk_load_command_segment_64_copy_native(mk_load_command_ref load_command, struct
     const mk_byteorder_t * const byte_order = mk_macho_get_byte_order(load_command.load_command->image);
     struct segment_command_64 *mach_segment_command = (struct segment_command_64*)load_command.load_command->mach_load_command;
     
-    result->cmd = byte_order->swap32( mach_segment_command->cmd );
-    result->cmdsize = byte_order->swap32( mach_segment_command->cmdsize );
+    result->cmd = mk_byteorder_swap32(byte_order, mach_segment_command->cmd);
+    result->cmdsize = mk_byteorder_swap32(byte_order, mach_segment_command->cmdsize);
     memcpy(result->segname, mach_segment_command->segname, sizeof(result->segname));
-    result->vmaddr = byte_order->swap64( mach_segment_command->vmaddr );
-    result->vmsize = byte_order->swap64( mach_segment_command->vmsize );
-    result->fileoff = byte_order->swap64( mach_segment_command->fileoff );
-    result->filesize = byte_order->swap64( mach_segment_command->filesize );
-    result->maxprot = byte_order->swap32( mach_segment_command->maxprot );
-    result->initprot = byte_order->swap32( mach_segment_command->initprot );
-    result->nsects = byte_order->swap32( mach_segment_command->nsects );
-    result->flags = byte_order->swap32( mach_segment_command->flags );
+    result->vmaddr = mk_byteorder_swap64(byte_order, mach_segment_command->vmaddr);
+    result->vmsize = mk_byteorder_swap64(byte_order, mach_segment_command->vmsize);
+    result->fileoff = mk_byteorder_swap64(byte_order, mach_segment_command->fileoff);
+    result->filesize = mk_byteorder_swap64(byte_order, mach_segment_command->filesize);
+    result->maxprot = mk_byteorder_swap32(byte_order, mach_segment_command->maxprot);
+    result->initprot = mk_byteorder_swap32(byte_order, mach_segment_command->initprot);
+    result->nsects = mk_byteorder_swap32(byte_order, mach_segment_command->nsects);
+    result->flags = mk_byteorder_swap32(byte_order, mach_segment_command->flags);
     
     return MK_ESUCCESS;
 }
@@ -115,7 +115,7 @@ mk_load_command_segment_64_get_vmaddr(mk_load_command_ref load_command)
     _MK_LOAD_COMMAND_NOT_NULL(load_command, return UINT64_MAX);
     _MK_LOAD_COMMAND_IS_A(load_command, _mk_load_command_segment_64_class, return UINT64_MAX);
     struct segment_command_64 *mach_segment_command = (struct segment_command_64*)load_command.load_command->mach_load_command;
-    return mk_macho_get_byte_order(load_command.load_command->image)->swap64( mach_segment_command->vmaddr );
+    return mk_byteorder_swap64(mk_macho_get_byte_order(load_command.load_command->image), mach_segment_command->vmaddr);
 }
 
 //|++++++++++++++++++++++++++++++++++++|//
@@ -125,7 +125,7 @@ mk_load_command_segment_64_get_vmsize(mk_load_command_ref load_command)
     _MK_LOAD_COMMAND_NOT_NULL(load_command, return UINT64_MAX);
     _MK_LOAD_COMMAND_IS_A(load_command, _mk_load_command_segment_64_class, return UINT64_MAX);
     struct segment_command_64 *mach_segment_command = (struct segment_command_64*)load_command.load_command->mach_load_command;
-    return mk_macho_get_byte_order(load_command.load_command->image)->swap64( mach_segment_command->vmsize );
+    return mk_byteorder_swap64(mk_macho_get_byte_order(load_command.load_command->image), mach_segment_command->vmsize);
 }
 
 //|++++++++++++++++++++++++++++++++++++|//
@@ -135,7 +135,7 @@ mk_load_command_segment_64_get_fileoff(mk_load_command_ref load_command)
     _MK_LOAD_COMMAND_NOT_NULL(load_command, return UINT64_MAX);
     _MK_LOAD_COMMAND_IS_A(load_command, _mk_load_command_segment_64_class, return UINT64_MAX);
     struct segment_command_64 *mach_segment_command = (struct segment_command_64*)load_command.load_command->mach_load_command;
-    return mk_macho_get_byte_order(load_command.load_command->image)->swap64( mach_segment_command->fileoff );
+    return mk_byteorder_swap64(mk_macho_get_byte_order(load_command.load_command->image), mach_segment_command->fileoff);
 }
 
 //|++++++++++++++++++++++++++++++++++++|//
@@ -145,7 +145,7 @@ mk_load_command_segment_64_get_filesize(mk_load_command_ref load_command)
     _MK_LOAD_COMMAND_NOT_NULL(load_command, return UINT64_MAX);
     _MK_LOAD_COMMAND_IS_A(load_command, _mk_load_command_segment_64_class, return UINT64_MAX);
     struct segment_command_64 *mach_segment_command = (struct segment_command_64*)load_command.load_command->mach_load_command;
-    return mk_macho_get_byte_order(load_command.load_command->image)->swap64( mach_segment_command->filesize );
+    return mk_byteorder_swap64(mk_macho_get_byte_order(load_command.load_command->image), mach_segment_command->filesize);
 }
 
 //|++++++++++++++++++++++++++++++++++++|//
@@ -155,7 +155,7 @@ mk_load_command_segment_64_get_maxprot(mk_load_command_ref load_command)
     _MK_LOAD_COMMAND_NOT_NULL(load_command, return INT_MAX);
     _MK_LOAD_COMMAND_IS_A(load_command, _mk_load_command_segment_64_class, return INT_MAX);
     struct segment_command_64 *mach_segment_command = (struct segment_command_64*)load_command.load_command->mach_load_command;
-    return mk_macho_get_byte_order(load_command.load_command->image)->swap32( mach_segment_command->maxprot );
+    return mk_byteorder_swap32(mk_macho_get_byte_order(load_command.load_command->image), mach_segment_command->maxprot);
 }
 
 //|++++++++++++++++++++++++++++++++++++|//
@@ -165,7 +165,7 @@ mk_load_command_segment_64_get_initprot(mk_load_command_ref load_command)
     _MK_LOAD_COMMAND_NOT_NULL(load_command, return INT_MAX);
     _MK_LOAD_COMMAND_IS_A(load_command, _mk_load_command_segment_64_class, return INT_MAX);
     struct segment_command_64 *mach_segment_command = (struct segment_command_64*)load_command.load_command->mach_load_command;
-    return mk_macho_get_byte_order(load_command.load_command->image)->swap32( mach_segment_command->initprot );
+    return mk_byteorder_swap32(mk_macho_get_byte_order(load_command.load_command->image), mach_segment_command->initprot);
 }
 
 //|++++++++++++++++++++++++++++++++++++|//
@@ -175,7 +175,7 @@ mk_load_command_segment_64_get_nsects(mk_load_command_ref load_command)
     _MK_LOAD_COMMAND_NOT_NULL(load_command, return UINT32_MAX);
     _MK_LOAD_COMMAND_IS_A(load_command, _mk_load_command_segment_64_class, return UINT32_MAX);
     struct segment_command_64 *mach_segment_command = (struct segment_command_64*)load_command.load_command->mach_load_command;
-    return mk_macho_get_byte_order(load_command.load_command->image)->swap32( mach_segment_command->nsects );
+    return mk_byteorder_swap32(mk_macho_get_byte_order(load_command.load_command->image), mach_segment_command->nsects);
 }
 
 //|++++++++++++++++++++++++++++++++++++|//
@@ -185,7 +185,7 @@ mk_load_command_segment_64_get_flags(mk_load_command_ref load_command)
     _MK_LOAD_COMMAND_NOT_NULL(load_command, return UINT32_MAX);
     _MK_LOAD_COMMAND_IS_A(load_command, _mk_load_command_segment_64_class, return UINT32_MAX);
     struct segment_command_64 *mach_segment_command = (struct segment_command_64*)load_command.load_command->mach_load_command;
-    return mk_macho_get_byte_order(load_command.load_command->image)->swap32( mach_segment_command->flags );
+    return mk_byteorder_swap32(mk_macho_get_byte_order(load_command.load_command->image), mach_segment_command->flags);
 }
 
 //|++++++++++++++++++++++++++++++++++++|//
@@ -294,16 +294,16 @@ mk_load_command_segment_64_section_copy_native(mk_load_command_section_64_t *sec
     
     memcpy(result->sectname, mach_section->sectname, sizeof(mach_section->sectname));
     memcpy(result->segname, mach_section->segname, sizeof(mach_section->segname));
-    result->addr = byte_order->swap64( mach_section->addr );
-    result->size = byte_order->swap64( mach_section->size );
-    result->offset = byte_order->swap32( mach_section->offset );
-    result->align = byte_order->swap32( mach_section->align );
-    result->reloff = byte_order->swap32( mach_section->reloff );
-    result->nreloc = byte_order->swap32( mach_section->nreloc );
-    result->flags = byte_order->swap32( mach_section->flags );
-    result->reserved1 = byte_order->swap32( mach_section->reserved1 );
-    result->reserved2 = byte_order->swap32( mach_section->reserved2 );
-    result->reserved3 = byte_order->swap32( mach_section->reserved3 );
+    result->addr = mk_byteorder_swap64(byte_order, mach_section->addr);
+    result->size = mk_byteorder_swap64(byte_order, mach_section->size);
+    result->offset = mk_byteorder_swap32(byte_order, mach_section->offset);
+    result->align = mk_byteorder_swap32(byte_order, mach_section->align);
+    result->reloff = mk_byteorder_swap32(byte_order, mach_section->reloff);
+    result->nreloc = mk_byteorder_swap32(byte_order, mach_section->nreloc);
+    result->flags = mk_byteorder_swap32(byte_order, mach_section->flags);
+    result->reserved1 = mk_byteorder_swap32(byte_order, mach_section->reserved1);
+    result->reserved2 = mk_byteorder_swap32(byte_order, mach_section->reserved2);
+    result->reserved3 = mk_byteorder_swap32(byte_order, mach_section->reserved3);
     
     return MK_ESUCCESS;
 }
@@ -338,7 +338,7 @@ mk_load_command_segment_64_section_get_addr(mk_load_command_section_64_t *sectio
 {
     if (section == NULL) return UINT64_MAX;
     struct section_64 *mach_section = (struct section_64*)section->mach_section;
-    return mk_macho_get_byte_order(section->segment.load_command->image)->swap64( mach_section->addr );
+    return mk_byteorder_swap64(mk_macho_get_byte_order(section->segment.load_command->image), mach_section->addr);
 }
 
 //|++++++++++++++++++++++++++++++++++++|//
@@ -347,7 +347,7 @@ mk_load_command_segment_64_section_get_size(mk_load_command_section_64_t *sectio
 {
     if (section == NULL) return UINT64_MAX;
     struct section_64 *mach_section = (struct section_64*)section->mach_section;
-    return mk_macho_get_byte_order(section->segment.load_command->image)->swap64( mach_section->size );
+    return mk_byteorder_swap64(mk_macho_get_byte_order(section->segment.load_command->image), mach_section->size);
 }
 
 //|++++++++++++++++++++++++++++++++++++|//
@@ -356,7 +356,7 @@ mk_load_command_segment_64_section_get_offset(mk_load_command_section_64_t *sect
 {
     if (section == NULL) return UINT32_MAX;
     struct section_64 *mach_section = (struct section_64*)section->mach_section;
-    return mk_macho_get_byte_order(section->segment.load_command->image)->swap32( mach_section->offset );
+    return mk_byteorder_swap32(mk_macho_get_byte_order(section->segment.load_command->image), mach_section->offset);
 }
 
 //|++++++++++++++++++++++++++++++++++++|//
@@ -365,7 +365,7 @@ mk_load_command_segment_64_section_get_align(mk_load_command_section_64_t *secti
 {
     if (section == NULL) return UINT32_MAX;
     struct section_64 *mach_section = (struct section_64*)section->mach_section;
-    return mk_macho_get_byte_order(section->segment.load_command->image)->swap32( mach_section->align );
+    return mk_byteorder_swap32(mk_macho_get_byte_order(section->segment.load_command->image), mach_section->align);
 }
 
 //|++++++++++++++++++++++++++++++++++++|//
@@ -374,7 +374,7 @@ mk_load_command_segment_64_section_get_reloff(mk_load_command_section_64_t *sect
 {
     if (section == NULL) return UINT32_MAX;
     struct section_64 *mach_section = (struct section_64*)section->mach_section;
-    return mk_macho_get_byte_order(section->segment.load_command->image)->swap32( mach_section->reloff );
+    return mk_byteorder_swap32(mk_macho_get_byte_order(section->segment.load_command->image), mach_section->reloff);
 }
 
 //|++++++++++++++++++++++++++++++++++++|//
@@ -383,7 +383,7 @@ mk_load_command_segment_64_section_get_nreloc(mk_load_command_section_64_t *sect
 {
     if (section == NULL) return UINT32_MAX;
     struct section_64 *mach_section = (struct section_64*)section->mach_section;
-    return mk_macho_get_byte_order(section->segment.load_command->image)->swap32( mach_section->nreloc );
+    return mk_byteorder_swap32(mk_macho_get_byte_order(section->segment.load_command->image), mach_section->nreloc);
 }
 
 //|++++++++++++++++++++++++++++++++++++|//
@@ -392,7 +392,7 @@ mk_load_command_segment_64_section_get_type(mk_load_command_section_64_t *sectio
 {
     if (section == NULL) return UINT8_MAX;
     struct section_64 *mach_section = (struct section_64*)section->mach_section;
-    return mk_macho_get_byte_order(section->segment.load_command->image)->swap32( mach_section->flags ) & SECTION_TYPE;
+    return mk_byteorder_swap32(mk_macho_get_byte_order(section->segment.load_command->image), mach_section->flags) & SECTION_TYPE;
 }
 
 //|++++++++++++++++++++++++++++++++++++|//
@@ -401,7 +401,7 @@ mk_load_command_segment_64_section_get_attributes(mk_load_command_section_64_t *
 {
     if (section == NULL) return UINT32_MAX;
     struct section_64 *mach_section = (struct section_64*)section->mach_section;
-    return mk_macho_get_byte_order(section->segment.load_command->image)->swap32( mach_section->flags ) & SECTION_ATTRIBUTES;
+    return mk_byteorder_swap32(mk_macho_get_byte_order(section->segment.load_command->image), mach_section->flags) & SECTION_ATTRIBUTES;
 }
 
 //|++++++++++++++++++++++++++++++++++++|//
@@ -410,7 +410,7 @@ mk_load_command_segment_64_section_get_reserved1(mk_load_command_section_64_t *s
 {
     if (section == NULL) return UINT32_MAX;
     struct section_64 *mach_section = (struct section_64*)section->mach_section;
-    return mk_macho_get_byte_order(section->segment.load_command->image)->swap32( mach_section->reserved1 );
+    return mk_byteorder_swap32(mk_macho_get_byte_order(section->segment.load_command->image), mach_section->reserved1);
 }
 
 //|++++++++++++++++++++++++++++++++++++|//
@@ -419,7 +419,7 @@ mk_load_command_segment_64_section_get_reserved2(mk_load_command_section_64_t *s
 {
     if (section == NULL) return UINT32_MAX;
     struct section_64 *mach_section = (struct section_64*)section->mach_section;
-    return mk_macho_get_byte_order(section->segment.load_command->image)->swap32( mach_section->reserved2 );
+    return mk_byteorder_swap32(mk_macho_get_byte_order(section->segment.load_command->image), mach_section->reserved2);
 }
 
 //|++++++++++++++++++++++++++++++++++++|//
@@ -428,5 +428,5 @@ mk_load_command_segment_64_section_get_reserved3(mk_load_command_section_64_t *s
 {
     if (section == NULL) return UINT32_MAX;
     struct section_64 *mach_section = (struct section_64*)section->mach_section;
-    return mk_macho_get_byte_order(section->segment.load_command->image)->swap32( mach_section->reserved3 );
+    return mk_byteorder_swap32(mk_macho_get_byte_order(section->segment.load_command->image), mach_section->reserved3);
 }
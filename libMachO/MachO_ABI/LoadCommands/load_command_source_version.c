@@ -60,9 +60,9 @@ mk_load_command_source_version_copy_native(mk_load_command_ref load_command, str
     const mk_byteorder_t * const byte_order = mk_macho_get_byte_order(load_command.load_command->image);
     struct source_version_command *mach_source_version_command = (struct source_version_command*)load_command.load_command->mach_load_command;
     
-    result->cmd = byte_order->swap32( mach_source_version_command->cmd );
-    result->cmdsize = byte_order->swap32( mach_source_version_command->cmdsize );
-    result->version = byte_order->swap64( mach_source_version_command->version );
+    result->cmd = mk_byteorder_swap32(byte_order, mach_source_version_command->cmd);
+    result->cmdsize = mk_byteorder_swap32(byte_order, mach_source_version_command->cmdsize);
+    result->version = mk_byteorder_swap64(byte_order, mach_source_version_command->version);
     
     return MK_ESUCCESS;
 }
@@ -76,7 +76,7 @@ mk_load_command_source_version_copy_components(mk_load_command_ref load_command,
     if (components == NULL) return MK_EINVAL;
     
     struct source_version_command *mach_source_version_command = (struct source_version_command*)load_command.load_command->mach_load_command;
-    uint64_t version = mk_macho_get_byte_order(load_command.load_command->image)->swap64( mach_source_version_command->version );
+    uint64_t version = mk_byteorder_swap64(mk_macho_get_byte_order(load_command.load_command->image), mach_source_version_command->version);
     
     components[0] = (version >> 40) & 0x7FFFFF;
     components[1] = (version >> 30) & 0x3FF;
@@ -61,8 +61,8 @@ mk_load_command_sub_framework_copy_native(mk_load_command_ref load_command, stru
     const mk_byteorder_t * const byte_order = mk_macho_get_byte_order(load_command.load_command->image);
     struct sub_framework_command *mach_sub_framework_command = (struct sub_framework_command*)load_command.load_command->mach_load_command;
     
-    result->cmd = byte_order->swap32( mach_sub_framework_command->cmd );
-    result->cmdsize = byte_order->swap32( mach_sub_framework_command->cmdsize );
+    result->cmd = mk_byteorder_swap32(byte_order, mach_sub_framework_command->cmd);
+    result->cmdsize = mk_byteorder_swap32(byte_order, mach_sub_framework_command->cmdsize);
     
     _mk_mach_lc_str_copy_native(load_command,
                                 &mach_sub_framework_command->umbrella,
@@ -60,8 +60,8 @@ mk_load_command_sub_library_copy_native(mk_load_command_ref load_command, struct
     const mk_byteorder_t * const byte_order = mk_macho_get_byte_order(load_command.load_command->image);
     struct sub_library_command *mach_sub_library_command = (struct sub_library_command*)load_command.load_command->mach_load_command;
     
-    result->cmd = byte_order->swap32( mach_sub_library_command->cmd );
-    result->cmdsize = -byte_order->swap32( mach_sub_library_command->cmdsize );
+    result->cmd = mk_byteorder_swap32(byte_order, mach_sub_library_command->cmd);
+    result->cmdsize = mk_byteorder_swap32(byte_order, mach_sub_library_command->cmdsize);
     
     _mk_mach_lc_str_copy_native(load_command,
                                 &mach_sub_library_command->sub_library,
@@ -66,12 +66,12 @@ mk_load_command_symtab_copy_native(mk_load_command_ref load_command, struct symt
     const mk_byteorder_t * const byte_order = mk_macho_get_byte_order(load_command.load_command->image);
     struct symtab_command *mach_symtab_command = (struct symtab_command*)load_command.load_command->mach_load_command;
     
-    result->cmd = byte_order->swap32( mach_symtab_command->cmd );
-    result->cmdsize = byte_order->swap32( mach_symtab_command->cmdsize );
-    result->symoff = byte_order->swap32( mach_symtab_command->symoff );
-    result->nsyms = byte_order->swap32( mach_symtab_command->nsyms );
-    result->stroff = byte_order->swap32( mach_symtab_command->stroff );
-    result->strsize = byte_order->swap32( mach_symtab_command->strsize );
+    result->cmd = mk_byteorder_swap32(byte_order, mach_symtab_command->cmd);
+    result->cmdsize = mk_byteorder_swap32(byte_order, mach_symtab_command->cmdsize);
+    result->symoff = mk_byteorder_swap32(byte_order, mach_symtab_command->symoff);
+    result->nsyms = mk_byteorder_swap32(byte_order, mach_symtab_command->nsyms);
+    result->stroff = mk_byteorder_swap32(byte_order, mach_symtab_command->stroff);
+    result->strsize = mk_byteorder_swap32(byte_order, mach_symtab_command->strsize);
     
     return MK_ESUCCESS;
 }
@@ -84,7 +84,7 @@ mk_load_command_symtab_get_symoff(mk_load_command_ref load_command)
     _MK_LOAD_COMMAND_IS_A(load_command, _mk_load_command_symtab_class, return UINT32_MAX);
     
     struct symtab_command *mach_symtab_command = (struct symtab_command*)load_command.load_command->mach_load_command;
-    return mk_macho_get_byte_order(load_command.load_command->image)->swap32( mach_symtab_command->symoff );
+    return mk_byteorder_swap32(mk_macho_get_byte_order(load_command.load_command->image), mach_symtab_command->symoff);
 }
 
 //|++++++++++++++++++++++++++++++++++++|//
@@ -95,7 +95,7 @@ mk_load_command_symtab_get_nsyms(mk_load_command_ref load_command)
     _MK_LOAD_COMMAND_IS_A(load_command, _mk_load_command_symtab_class, return UINT32_MAX);
     
     struct symtab_command *mach_symtab_command = (struct symtab_command*)load_command.load_command->mach_load_command;
-    return mk_macho_get_byte_order(load_command.load_command->image)->swap32( mach_symtab_command->nsyms );
+    return mk_byteorder_swap32(mk_macho_get_byte_order(load_command.load_command->image), mach_symtab_command->nsyms);
 }
 
 //|++++++++++++++++++++++++++++++++++++|//
@@ -106,7 +106,7 @@ mk_load_command_symtab_get_stroff(mk_load_command_ref load_command)
     _MK_LOAD_COMMAND_IS_A(load_command, _mk_load_command_symtab_class, return UINT32_MAX);
     
     struct symtab_command *mach_symtab_command = (struct symtab_command*)load_command.load_command->mach_load_command;
-    return mk_macho_get_byte_order(load_command.load_command->image)->swap32( mach_symtab_command->stroff );
+    return mk_byteorder_swap32(mk_macho_get_byte_order(load_command.load_command->image), mach_symtab_command->stroff);
 }
 
 //|++++++++++++++++++++++++++++++++++++|//
@@ -117,6 +117,6 @@ mk_load_command_symtab_get_strsize(mk_load_command_ref load_command)
     _MK_LOAD_COMMAND_IS_A(load_command, _mk_load_command_symtab_class, return UINT32_MAX);
     
     struct symtab_command *mach_symtab_command = (struct symtab_command*)load_command.load_command->mach_load_command;
-    return mk_macho_get_byte_order(load_command.load_command->image)->swap32( mach_symtab_command->strsize );
+    return mk_byteorder_swap32(mk_macho_get_byte_order(load_command.load_command->image), mach_symtab_command->strsize);
 }
 
@@ -62,10 +62,10 @@ mk_load_command_twolevel_hints_copy_native(mk_load_command_ref load_command, str
     const mk_byteorder_t * const byte_order = mk_macho_get_byte_order(load_command.load_command->image);
     struct twolevel_hints_command *mach_twolevel_hints_command = (struct twolevel_hints_command*)load_command.load_command->mach_load_command;
     
-    result->cmd = byte_order->swap32( mach_twolevel_hints_command->cmd );
-    result->cmdsize = byte_order->swap32( mach_twolevel_hints_command->cmdsize );
-    result->offset = byte_order->swap32( mach_twolevel_hints_command->offset );
-    result->nhints = byte_order->swap32( mach_twolevel_hints_command->nhints );
+    result->cmd = mk_byteorder_swap32(byte_order, mach_twolevel_hints_command->cmd);
+    result->cmdsize = mk_byteorder_swap32(byte_order, mach_twolevel_hints_command->cmdsize);
+    result->offset = mk_byteorder_swap32(byte_order, mach_twolevel_hints_command->offset);
+    result->nhints = mk_byteorder_swap32(byte_order, mach_twolevel_hints_command->nhints);
     
     return MK_ESUCCESS;
 }
@@ -78,7 +78,7 @@ mk_load_command_twolevel_hints_get_offset(mk_load_command_ref load_command)
     _MK_LOAD_COMMAND_IS_A(load_command, _mk_load_command_twolevel_hints_class, return UINT8_MAX);
     
     struct twolevel_hints_command *mach_twolevel_hints_command = (struct twolevel_hints_command*)load_command.load_command->mach_load_command;
-    return mk_macho_get_byte_order(load_command.load_command->image)->swap32( mach_twolevel_hints_command->offset );
+    return mk_byteorder_swap32(mk_macho_get_byte_order(load_command.load_command->image), mach_twolevel_hints_command->offset);
 }
 
 //|++++++++++++++++++++++++++++++++++++|//
@@ -89,5 +89,5 @@ mk_load_command_twolevel_hints_get_nhints(mk_load_command_ref load_command)
     _MK_LOAD_COMMAND_IS_A(load_command, _mk_load_command_twolevel_hints_class, return UINT8_MAX);
     
     struct twolevel_hints_command *mach_twolevel_hints_command = (struct twolevel_hints_command*)load_command.load_command->mach_load_command;
-    return mk_macho_get_byte_order(load_command.load_command->image)->swap32( mach_twolevel_hints_command->nhints );
+    return mk_byteorder_swap32(mk_macho_get_byte_order(load_command.load_command->image), mach_twolevel_hints_command->nhints);
 }
@@ -60,8 +60,8 @@ mk_load_command_uuid_copy_native(mk_load_command_ref load_command, struct uuid_c
     const mk_byteorder_t * const byte_order = mk_macho_get_byte_order(load_command.load_command->image);
     struct uuid_command *mach_uuid_command = (struct uuid_command*)load_command.load_command->mach_load_command;
     
-    result->cmd = byte_order->swap32( mach_uuid_command->cmd );
-    result->cmdsize = byte_order->swap32( mach_uuid_command->cmdsize );
+    result->cmd = mk_byteorder_swap32(byte_order, mach_uuid_command->cmd);
+    result->cmdsize = mk_byteorder_swap32(byte_order, mach_uuid_command->cmdsize);
     memcpy(result->uuid, mach_uuid_command->uuid, sizeof(result->uuid));
     
     return MK_ESUCCESS;
@@ -62,10 +62,10 @@ mk_load_command_version_min_iphoneos_copy_native(mk_load_command_ref load_comman
     const mk_byteorder_t * const byte_order = mk_macho_get_byte_order(load_command.load_command->image);
     struct version_min_command *mach_version_min_command = (struct version_min_command*)load_command.load_command->mach_load_command;
     
-    result->cmd = byte_order->swap32( mach_version_min_command->cmd );
-    result->cmdsize = byte_order->swap32( mach_version_min_command->cmdsize );
-    result->version = byte_order->swap32( mach_version_min_command->version );
-    result->sdk = byte_order->swap32( mach_version_min_command->sdk );
+    result->cmd = mk_byteorder_swap32(byte_order, mach_version_min_command->cmd);
+    result->cmdsize = mk_byteorder_swap32(byte_order, mach_version_min_command->cmdsize);
+    result->version = mk_byteorder_swap32(byte_order, mach_version_min_command->version);
+    result->sdk = mk_byteorder_swap32(byte_order, mach_version_min_command->sdk);
     
     return MK_ESUCCESS;
 }
@@ -78,7 +78,7 @@ mk_load_command_version_min_iphoneos_get_version_primary(mk_load_command_ref loa
     _MK_LOAD_COMMAND_IS_A(load_command, _mk_load_command_version_min_iphoneos_class, return UINT8_MAX);
     
     struct version_min_command *mach_version_min_command = (struct version_min_command*)load_command.load_command->mach_load_command;
-    uint32_t version = mk_macho_get_byte_order(load_command.load_command->image)->swap32( mach_version_min_command->version );
+    uint32_t version = mk_byteorder_swap32(mk_macho_get_byte_order(load_command.load_command->image), mach_version_min_command->version);
     return (version >> 16) & 0xF;
 }
 
@@ -90,7 +90,7 @@ mk_load_command_version_min_iphoneos_get_version_major(mk_load_command_ref load_
     _MK_LOAD_COMMAND_IS_A(load_command, _mk_load_command_version_min_iphoneos_class, return UINT8_MAX);
     
     struct version_min_command *mach_version_min_command = (struct version_min_command*)load_command.load_command->mach_load_command;
-    uint32_t version = mk_macho_get_byte_order(load_command.load_command->image)->swap32( mach_version_min_command->version );
+    uint32_t version = mk_byteorder_swap32(mk_macho_get_byte_order(load_command.load_command->image), mach_version_min_command->version);
     return (version >> 8) & 0xF;
 }
 
@@ -102,7 +102,7 @@ mk_load_command_version_min_iphoneos_get_version_minor(mk_load_command_ref load_
     _MK_LOAD_COMMAND_IS_A(load_command, _mk_load_command_version_min_iphoneos_class, return UINT8_MAX);
     
     struct version_min_command *mach_version_min_command = (struct version_min_command*)load_command.load_command->mach_load_command;
-    uint32_t version = mk_macho_get_byte_order(load_command.load_command->image)->swap32( mach_version_min_command->version );
+    uint32_t version = mk_byteorder_swap32(mk_macho_get_byte_order(load_command.load_command->image), mach_version_min_command->version);
     return (version >> 0) & 0xF;
 }
 
@@ -127,7 +127,7 @@ mk_load_command_version_min_iphoneos_get_sdk_primary(mk_load_command_ref load_co
     _MK_LOAD_COMMAND_IS_A(load_command, _mk_load_command_version_min_iphoneos_class, return UINT8_MAX);
     
     struct version_min_command *mach_version_min_command = (struct version_min_command*)load_command.load_command->mach_load_command;
-    uint32_t sdk = mk_macho_get_byte_order(load_command.load_command->image)->swap32( mach_version_min_command->sdk );
+    uint32_t sdk = mk_byteorder_swap32(mk_macho_get_byte_order(load_command.load_command->image), mach_version_min_command->sdk);
     return (sdk >> 16) & 0xF;
 }
 
@@ -139,7 +139,7 @@ mk_load_command_version_min_iphoneos_get_sdk_major(mk_load_command_ref load_comm
     _MK_LOAD_COMMAND_IS_A(load_command, _mk_load_command_version_min_iphoneos_class, return UINT8_MAX);
     
     struct version_min_command *mach_version_min_command = (struct version_min_command*)load_command.load_command->mach_load_command;
-    uint32_t sdk = mk_macho_get_byte_order(load_command.load_command->image)->swap32( mach_version_min_command->sdk );
+    uint32_t sdk = mk_byteorder_swap32(mk_macho_get_byte_order(load_command.load_command->image), mach_version_min_command->sdk);
     return (sdk >> 8) & 0xF;
 }
 
@@ -151,7 +151,7 @@ mk_load_command_version_min_iphoneos_get_sdk_minor(mk_load_command_ref load_comm
     _MK_LOAD_COMMAND_IS_A(load_command, _mk_load_command_version_min_iphoneos_class, return UINT8_MAX);
     
     struct version_min_command *mach_version_min_command = (struct version_min_command*)load_command.load_command->mach_load_command;
-    uint32_t sdk = mk_macho_get_byte_order(load_command.load_command->image)->swap32( mach_version_min_command->sdk );
+    uint32_t sdk = mk_byteorder_swap32(mk_macho_get_byte_order(load_command.load_command->image), mach_version_min_command->sdk);
     return (sdk >> 0) & 0xF;
 }
 
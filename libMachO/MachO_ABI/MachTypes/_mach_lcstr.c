@@ -35,7 +35,7 @@ _mk_mach_lc_str_copy_native(mk_load_command_ref source_lc, union lc_str *source_
     const mk_macho_ref image = source_lc.load_command->image;
     size_t lc_base_size = mk_load_command_base_size(source_lc);
     
-    size_t src_cmd_size = mk_macho_get_byte_order(image)->swap32( src_lc->cmdsize );
+    size_t src_cmd_size = mk_byteorder_swap32(mk_macho_get_byte_order(image), src_lc->cmdsize);
     mk_vm_range_t src_cmd_range = mk_vm_range_make((mk_vm_address_t)src_lc, src_cmd_size);
     
     if (lc_base_size > src_cmd_size) {
@@ -44,7 +44,7 @@ _mk_mach_lc_str_copy_native(mk_load_command_ref source_lc, union lc_str *source_
     }
     
     size_t src_string_contents_len = src_cmd_size - lc_base_size;
-    uint32_t src_string_offset = mk_macho_get_byte_order(image)->swap32( source_str->offset );
+    uint32_t src_string_offset = mk_byteorder_swap32(mk_macho_get_byte_order(image), source_str->offset);
     char * src_string = (char*)( (uint8_t*)src_lc + src_string_offset );
     
     if (mk_vm_range_contains_range(src_cmd_range, mk_vm_range_make((mk_vm_address_t)src_string, src_string_contents_len), false) == false)
@@ -87,7 +87,7 @@ _mk_mach_lc_str_copy(mk_load_command_ref source_lc, union lc_str *source_str, ch
     const mk_macho_ref image = source_lc.load_command->image;
     size_t lc_base_size = mk_load_command_base_size(source_lc);
     
-    uint32_t cmd_len = mk_macho_get_byte_order(image)->swap32( lc->cmdsize );
+    uint32_t cmd_len = mk_byteorder_swap32(mk_macho_get_byte_order(image), lc->cmdsize);
     mk_vm_range_t cmd_range = mk_vm_range_make((mk_vm_address_t)lc, cmd_len);
     
     if (lc_base_size > cmd_len) {
@@ -96,7 +96,7 @@ _mk_mach_lc_str_copy(mk_load_command_ref source_lc, union lc_str *source_str, ch
     }
     
     size_t string_contents_len = cmd_len - lc_base_size;
-    uint32_t string_offset = mk_macho_get_byte_order(image)->swap32( source_str->offset );
+    uint32_t string_offset = mk_byteorder_swap32(mk_macho_get_byte_order(image), source_str->offset);
     char * string = (char*)( (uint8_t*)lc + string_offset );
     
     if (mk_vm_range_contains_range(cmd_range, mk_vm_range_make((mk_vm_address_t)string, string_contents_len), false))
@@ -34,7 +34,7 @@
 //|++++++++++++++++++++++++++++++++++++|//
 static mk_context_t*
 __mk_section_get_context(mk_type_ref self)
-{ return mk_type_get_context( &((mk_section_t*)self)->segment ); }
+{ return mk_type_get_context( ((mk_section_t*)self)->segment.segment ); }
 
 const struct _mk_section_vtable _mk_section_class = {
     .base.super                 = &_mk_type_class,
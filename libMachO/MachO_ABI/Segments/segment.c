@@ -288,3 +288,120 @@ mk_segment_enumerate_sections(mk_segment_ref segment, void (^enumerator)(mk_mach
 }
 #endif
 
+
+//----------------------------------------------------------------------------//
+#pragma mark -  Allocating Segments From An Arena
+//----------------------------------------------------------------------------//
+
+//|++++++++++++++++++++++++++++++++++++|//
+static mk_arena_t*
+__mk_segment_get_arena(mk_context_t *ctx, const char *purpose)
+{
+    if (ctx == NULL || ctx->arena == NULL) {
+        _mkl_error(ctx, "Can not allocate %s without a context arena.", purpose);
+        return NULL;
+    }
+    
+    return ctx->arena;
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+mk_error_t
+mk_macho_init_segments(mk_macho_ref image, mk_segment_t **segments, uint32_t *count)
+{
+    if (image.macho == NULL) return MK_EINVAL;
+    if (segments == NULL) return MK_EINVAL;
+    if (count == NULL) return MK_EINVAL;
+    
+    mk_context_t *ctx = mk_type_get_context(image.macho);
+    mk_arena_t *arena = __mk_segment_get_arena(ctx, "segments");
+    if (arena == NULL)
+        return MK_EUNAVAILABLE;
+    
+    uint32_t segment_cmd = mk_macho_is_64_bit(image) ? LC_SEGMENT_64 : LC_SEGMENT;
+    uint32_t capacity = 0;
+    struct load_command *lc = NULL;
+    
+    while ((lc = mk_macho_next_command_type(image, lc, segment_cmd, NULL)))
+        capacity++;
+    
+    mk_segment_t *result = mk_arena_alloc_array(arena, mk_segment_t, capacity);
+    if (result == NULL && capacity > 0) {
+        _mkl_error(ctx, "The context arena is exhausted; could not allocate %" PRIu32 " segments.", capacity);
+        return MK_EOVERFLOW;
+    }
+    
+    uint32_t initialized = 0;
+    
+    while ((lc = mk_macho_next_command_type(image, lc, segment_cmd, NULL)) && initialized < capacity)
+    {
+        mk_load_command_t load_command;
+        mk_error_t err;
+        
+        if ((err = mk_load_command_init(image, lc, &load_command)) == MK_ESUCCESS)
+            err = mk_segment_init(&load_command, &result[initialized]);
+        
+        if (err == MK_EUNAVAILABLE)
+            continue;
+        
+        if (err) {
+            mk_macho_free_segments(result, initialized);
+            return err;
+        }
+        
+        initialized++;
+    }
+    
+    *segments = result;
+    *count = initialized;
+    
+    return MK_ESUCCESS;
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+void
+mk_macho_free_segments(mk_segment_t *segments, uint32_t count)
+{
+    for (uint32_t i = 0; i < count; i++)
+        mk_segment_free(&segments[i]);
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+mk_error_t
+mk_segment_init_sections(mk_segment_ref segment, mk_section_t **sections, uint32_t *count)
+{
+    if (segment.segment == NULL) return MK_EINVAL;
+    if (sections == NULL) return MK_EINVAL;
+    if (count == NULL) return MK_EINVAL;
+    
+    mk_context_t *ctx = mk_type_get_context(segment.segment);
+    mk_arena_t *arena = __mk_segment_get_arena(ctx, "sections");
+    if (arena == NULL)
+        return MK_EUNAVAILABLE;
+    
+    uint32_t capacity = mk_segment_get_nsects(segment);
+    
+    mk_section_t *result = mk_arena_alloc_array(arena, mk_section_t, capacity);
+    if (result == NULL && capacity > 0) {
+        _mkl_error(ctx, "The context arena is exhausted; could not allocate %" PRIu32 " sections.", capacity);
+        return MK_EOVERFLOW;
+    }
+    
+    mk_mach_section mach_section; mach_section.any = NULL;
+    uint32_t initialized = 0;
+    
+    while (initialized < capacity && (mach_section = mk_segment_next_section(segment, mach_section, NULL)).any)
+    {
+        mk_error_t err;
+        
+        if ((err = mk_section_init_wih_mach_section(segment, mach_section, &result[initialized])))
+            return err;
+        
+        initialized++;
+    }
+    
+    *sections = result;
+    *count = initialized;
+    
+    return MK_ESUCCESS;
+}
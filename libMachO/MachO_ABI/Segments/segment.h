@@ -166,6 +166,42 @@ mk_segment_enumerate_sections(mk_segment_ref segment,
 #endif
 
 
+//----------------------------------------------------------------------------//
+#pragma mark -  Allocating Segments From An Arena
+//! @name       Allocating Segments From An Arena
+//!
+//! These functions allocate from the arena of the context that the image
+//! was initialized with.  They return \ref MK_EUNAVAILABLE if the context
+//! does not have an arena, and \ref MK_EOVERFLOW if the arena is exhausted.
+//! The memory is reclaimed when the arena is reset.
+//----------------------------------------------------------------------------//
+
+//! Initializes an \ref mk_segment_t for each segment load command in
+//! \a image.  Segments which can not be mapped, such as \c __PAGEZERO, are
+//! skipped.
+//!
+//! @param  segments [out]
+//!         Set to the array of initialized segments, in load command order.
+//! @param  count [out]
+//!         Set to the number of elements in \a segments.
+_mk_export mk_error_t
+mk_macho_init_segments(mk_macho_ref image, mk_segment_t **segments, uint32_t *count);
+
+//! Releases the resources held by the \a count \a segments initialized by
+//! \ref mk_macho_init_segments.  Must be called before the arena is reset.
+_mk_export void
+mk_macho_free_segments(mk_segment_t *segments, uint32_t count);
+
+//! Initializes an \ref mk_section_t for each section in \a segment.
+//!
+//! @param  sections [out]
+//!         Set to the array of initialized sections, in load command order.
+//! @param  count [out]
+//!         Set to the number of elements in \a sections.
+_mk_export mk_error_t
+mk_segment_init_sections(mk_segment_ref segment, mk_section_t **sections, uint32_t *count);
+
+
 //! @} SEGMENTS !//
 
 #endif /* _segment_h */
@@ -34,7 +34,7 @@
 //|++++++++++++++++++++++++++++++++++++|//
 static mk_context_t*
 __mk_symbol_get_context(mk_type_ref self)
-{ return mk_type_get_context( &((mk_symbol_t*)self)->symbol_table ); }
+{ return mk_type_get_context( ((mk_symbol_t*)self)->symbol_table.symbol_table ); }
 
 const struct _mk_symbol_vtable _mk_symbol_class = {
     .base.super                 = &_mk_type_class,
@@ -116,7 +116,7 @@ mk_symbol_get_range(mk_symbol_ref symbol)
 
 //|++++++++++++++++++++++++++++++++++++|//
 uint32_t mk_symbol_get_strx(mk_symbol_ref symbol)
-{ return mk_macho_get_byte_order(mk_symbol_get_macho(symbol))->swap32( symbol.symbol->nlist.nlist->n_un.n_strx ); }
+{ return mk_byteorder_swap32(mk_macho_get_byte_order(mk_symbol_get_macho(symbol)), symbol.symbol->nlist.nlist->n_un.n_strx); }
 
 //|++++++++++++++++++++++++++++++++++++|//
 uint8_t mk_symbol_get_type(mk_symbol_ref symbol)
@@ -128,7 +128,7 @@ uint8_t mk_symbol_get_sect(mk_symbol_ref symbol)
 
 //|++++++++++++++++++++++++++++++++++++|//
 int16_t mk_symbol_get_desc(mk_symbol_ref symbol)
-{ return mk_macho_get_byte_order(mk_symbol_get_macho(symbol))->swap16( symbol.symbol->nlist.nlist->n_desc ); }
+{ return mk_byteorder_swap16(mk_macho_get_byte_order(mk_symbol_get_macho(symbol)), symbol.symbol->nlist.nlist->n_desc); }
 
 //|++++++++++++++++++++++++++++++++++++|//
 uint64_t
@@ -136,7 +136,7 @@ mk_symbol_get_value(mk_symbol_ref symbol)
 {
     mk_data_model_ref data_model = mk_macho_get_data_model(mk_symbol_get_macho(symbol));
     if (mk_data_model_get_pointer_size(data_model) == 8)
-        return mk_data_model_get_byte_order(data_model)->swap64( symbol.symbol->nlist.nlist_64->n_value );
+        return mk_byteorder_swap64(mk_data_model_get_byte_order(data_model), symbol.symbol->nlist.nlist_64->n_value);
     else
-        return mk_data_model_get_byte_order(data_model)->swap32( symbol.symbol->nlist.nlist->n_value );
+        return mk_byteorder_swap32(mk_data_model_get_byte_order(data_model), symbol.symbol->nlist.nlist->n_value);
 }
@@ -0,0 +1,810 @@
+//----------------------------------------------------------------------------//
+//|
+//|             MachOKit - A Lightweight Mach-O Parsing Library
+//|             dyld_info.c
+//|
+//|             D.V.
+//|             Copyright (c) 2014-2015 D.V. All rights reserved.
+//|
+//| Permission is hereby granted, free of charge, to any person obtaining a
+//| copy of this software and associated documentation files (the "Software"),
+//| to deal in the Software without restriction, including without limitation
+//| the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//| and/or sell copies of the Software, and to permit persons to whom the
+//| Software is furnished to do so, subject to the following conditions:
+//|
+//| The above copyright notice and this permission notice shall be included
+//| in all copies or substantial portions of the Software.
+//|
+//| THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+//| OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+//| MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+//| IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+//| CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+//| TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//| SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//----------------------------------------------------------------------------//
+
+
+#include "macho_abi_internal.h"
+
+//----------------------------------------------------------------------------//
+#pragma mark -  Interpreter
+//----------------------------------------------------------------------------//
+
+//|++++++++++++++++++++++++++++++++++++|//
+static void
+__mk_dyld_info_opcodes_init(mk_macho_ref image, const uint8_t *opcodes, size_t length, mk_dyld_info_opcodes_t *state)
+{
+    state->image = image.macho;
+    state->start = opcodes;
+    state->cursor = opcodes;
+    state->end = opcodes + length;
+    state->remaining = 0;
+    state->stride = 0;
+    state->segment_offset = 0;
+    state->segment_address = 0;
+    state->segment_size = 0;
+    state->segment_index = 0;
+    state->type = 0;
+    state->pointer_size = (uint8_t)mk_data_model_get_pointer_size(mk_macho_get_data_model(image));
+    state->segment_resolved = false;
+    state->finished = false;
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+static mk_error_t
+__mk_dyld_info_opcodes_map(mk_load_command_ref load_command, mk_segment_ref link_edit, uint32_t offset, uint32_t size, mk_dyld_info_opcodes_t *state)
+{
+    mk_macho_ref image = mk_load_command_get_macho(load_command);
+    mk_context_t *context = mk_type_get_context(load_command.load_command);
+    mk_error_t err;
+    
+    if (mk_segment_get_macho(link_edit).macho != image.macho)
+        return MK_EINVAL;
+    
+    if (size == 0) {
+        __mk_dyld_info_opcodes_init(image, NULL, 0, state);
+        return MK_ESUCCESS;
+    }
+    
+    // Locate the opcodes in __LINKEDIT, in the same way as the symbol table.
+    mk_vm_address_t vm_address = mk_segment_get_range(link_edit).location;
+    
+    if ((err = mk_vm_address_add(vm_address, offset, &vm_address))) {
+        _mkl_error(context, "Arithmetic error %s while adding offset (%" PRIi32 ") to __LINKEDIT vm_address (0x%" MK_VM_PRIxADDR ")", mk_error_string(err), offset, vm_address);
+        return err;
+    }
+    
+    if ((err = mk_vm_address_substract(vm_address, mk_segment_get_fileoff(link_edit), &vm_address))) {
+        _mkl_error(context, "Arithmetic error %s while subtracting __LINKEDIT file offset (0x%" MK_VM_PRIxADDR ") from (0x%" MK_VM_PRIxADDR ")", mk_error_string(err), mk_segment_get_fileoff(link_edit), vm_address);
+        return err;
+    }
+    
+    vm_address_t opcodes = mk_memory_object_remap_address(mk_segment_get_mobj(link_edit), 0, vm_address, size, &err);
+    if (opcodes == UINTPTR_MAX) {
+        _mkl_error(context, "__LINKEDIT segment does not fully contain the opcodes at offset (%" PRIi32 ").", offset);
+        return err;
+    }
+    
+    __mk_dyld_info_opcodes_init(image, (const uint8_t*)opcodes, size, state);
+    return MK_ESUCCESS;
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+static inline mk_error_t
+__mk_read_uleb128(const uint8_t **cursor, const uint8_t *end, uint64_t *result)
+{
+    const uint8_t *p = *cursor;
+    uint64_t value = 0;
+    uint32_t shift = 0;
+    
+    while (p < end)
+    {
+        uint8_t byte = *p++;
+        
+        if (shift >= 64 || (shift == 63 && (byte & 0x7F) > 1))
+            return MK_EOVERFLOW;
+        
+        value |= (uint64_t)(byte & 0x7F) << shift;
+        shift += 7;
+        
+        if ((byte & 0x80) == 0) {
+            *cursor = p;
+            *result = value;
+            return MK_ESUCCESS;
+        }
+    }
+    
+    return MK_EINVALID_DATA;
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+static inline mk_error_t
+__mk_dyld_info_read_uleb128(mk_dyld_info_opcodes_t *state, uint64_t *result)
+{ return __mk_read_uleb128(&state->cursor, state->end, result); }
+
+//|++++++++++++++++++++++++++++++++++++|//
+static inline mk_error_t
+__mk_dyld_info_read_sleb128(mk_dyld_info_opcodes_t *state, int64_t *result)
+{
+    uint64_t value = 0;
+    uint32_t shift = 0;
+    uint8_t byte;
+    
+    do {
+        if (state->cursor >= state->end)
+            return MK_EINVALID_DATA;
+        if (shift >= 64)
+            return MK_EOVERFLOW;
+        
+        byte = *state->cursor++;
+        value |= (uint64_t)(byte & 0x7F) << shift;
+        shift += 7;
+    } while (byte & 0x80);
+    
+    // Sign extend.
+    if (shift < 64 && (byte & 0x40))
+        value |= UINT64_MAX << shift;
+    
+    *result = (int64_t)value;
+    return MK_ESUCCESS;
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+static inline void
+__mk_dyld_info_set_segment(mk_dyld_info_opcodes_t *state, uint8_t segment_index, uint64_t segment_offset)
+{
+    if (segment_index != state->segment_index)
+        state->segment_resolved = false;
+    
+    state->segment_index = segment_index;
+    state->segment_offset = segment_offset;
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+static inline mk_error_t
+__mk_dyld_info_set_repeat(mk_dyld_info_opcodes_t *state, uint64_t count, uint64_t skip)
+{
+    // A stride that wraps to zero would never advance the offset, and with a
+    // large count the iterator would not finish.
+    uint64_t stride = skip + state->pointer_size;
+    if (stride < skip || stride == 0)
+        return MK_EOVERFLOW;
+    
+    state->remaining = count;
+    state->stride = stride;
+    return MK_ESUCCESS;
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+static mk_error_t
+__mk_dyld_info_resolve_segment(mk_dyld_info_opcodes_t *state)
+{
+    bool is_64_bit = mk_macho_is_64_bit(state->image);
+    struct load_command *lc = NULL;
+    uint32_t index = 0;
+    mk_error_t err;
+    
+    // Only done when the segment changes, which is rare compared to the
+    // number of fixups.
+    while ((lc = mk_macho_next_command_type(state->image, lc, is_64_bit ? LC_SEGMENT_64 : LC_SEGMENT, NULL)))
+    {
+        if (index++ != state->segment_index)
+            continue;
+        
+        mk_load_command_t segment;
+        if ((err = mk_load_command_init(state->image, lc, &segment)))
+            return err;
+        
+        mk_vm_address_t vm_address = is_64_bit ? mk_load_command_segment_64_get_vmaddr(&segment) : mk_load_command_segment_get_vmaddr(&segment);
+        if ((err = mk_vm_address_apply_offset(vm_address, mk_macho_get_slide(state->image), &vm_address)))
+            return err;
+        
+        state->segment_address = vm_address;
+        state->segment_size = is_64_bit ? mk_load_command_segment_64_get_vmsize(&segment) : mk_load_command_segment_get_vmsize(&segment);
+        state->segment_resolved = true;
+        return MK_ESUCCESS;
+    }
+    
+    return MK_EOUT_OF_RANGE;
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+static inline mk_error_t
+__mk_dyld_info_take_fixup(mk_dyld_info_opcodes_t *state, mk_vm_address_t *address, mk_vm_offset_t *segment_offset)
+{
+    mk_error_t err;
+    
+    if (!state->segment_resolved && (err = __mk_dyld_info_resolve_segment(state)))
+        return err;
+    
+    if (state->segment_size < state->pointer_size || state->segment_offset > state->segment_size - state->pointer_size)
+        return MK_EOUT_OF_RANGE;
+    
+    *address = state->segment_address + state->segment_offset;
+    *segment_offset = state->segment_offset;
+    
+    // Offsets may wrap, as dyld permits; the range check above catches any
+    // that leave the segment.
+    state->segment_offset += state->stride;
+    state->remaining--;
+    
+    return MK_ESUCCESS;
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+static bool
+__mk_dyld_info_fail(mk_dyld_info_opcodes_t *state, const char *kind, const uint8_t *opcode, mk_error_t err, mk_error_t *error)
+{
+    _mkl_error(mk_type_get_context(state->image), "Failed to interpret %s opcode 0x%02x at offset (%td).  Error %s.", kind, *opcode, opcode - state->start, mk_error_string(err));
+    
+    state->remaining = 0;
+    state->finished = true;
+    
+    MK_ERROR_OUT = err;
+    return false;
+}
+
+
+//----------------------------------------------------------------------------//
+#pragma mark -  Rebase Information
+//----------------------------------------------------------------------------//
+
+//|++++++++++++++++++++++++++++++++++++|//
+mk_error_t
+mk_rebase_iterator_init(mk_load_command_ref load_command, mk_segment_ref link_edit, mk_rebase_iterator_t *iterator)
+{
+    if (load_command.load_command == NULL) return MK_EINVAL;
+    if (link_edit.segment == NULL) return MK_EINVAL;
+    if (iterator == NULL) return MK_EINVAL;
+    
+    uint32_t command_id = mk_load_command_id(load_command);
+    if (command_id != mk_load_command_dyld_info_id() && command_id != mk_load_command_dyld_info_only_id())
+        return MK_EINVAL;
+    
+    return __mk_dyld_info_opcodes_map(load_command, link_edit,
+                                      _mk_load_command_type_dyld_info_get_rebase_off(load_command),
+                                      _mk_load_command_type_dyld_info_get_rebase_size(load_command),
+                                      &iterator->opcodes);
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+mk_error_t
+mk_rebase_iterator_init_with_opcodes(mk_macho_ref image, const uint8_t *opcodes, size_t length, mk_rebase_iterator_t *iterator)
+{
+    if (image.macho == NULL) return MK_EINVAL;
+    if (opcodes == NULL && length != 0) return MK_EINVAL;
+    if (iterator == NULL) return MK_EINVAL;
+    
+    __mk_dyld_info_opcodes_init(image, opcodes, length, &iterator->opcodes);
+    return MK_ESUCCESS;
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+bool
+mk_rebase_iterator_next(mk_rebase_iterator_t *iterator, mk_rebase_fixup_t *fixup, mk_error_t *error)
+{
+    mk_dyld_info_opcodes_t *state = &iterator->opcodes;
+    const uint8_t *opcode = NULL;
+    mk_error_t err;
+    
+    while (state->remaining == 0)
+    {
+        if (state->finished || state->cursor >= state->end) {
+            state->finished = true;
+            MK_ERROR_OUT = MK_ESUCCESS;
+            return false;
+        }
+        
+        opcode = state->cursor++;
+        uint8_t immediate = *opcode & REBASE_IMMEDIATE_MASK;
+        uint64_t count, skip;
+        
+        switch (*opcode & REBASE_OPCODE_MASK) {
+            case REBASE_OPCODE_DONE:
+                state->finished = true;
+                break;
+            case REBASE_OPCODE_SET_TYPE_IMM:
+                state->type = immediate;
+                break;
+            case REBASE_OPCODE_SET_SEGMENT_AND_OFFSET_ULEB:
+                if ((err = __mk_dyld_info_read_uleb128(state, &skip)))
+                    return __mk_dyld_info_fail(state, "rebase", opcode, err, error);
+                __mk_dyld_info_set_segment(state, immediate, skip);
+                break;
+            case REBASE_OPCODE_ADD_ADDR_ULEB:
+                if ((err = __mk_dyld_info_read_uleb128(state, &skip)))
+                    return __mk_dyld_info_fail(state, "rebase", opcode, err, error);
+                state->segment_offset += skip;
+                break;
+            case REBASE_OPCODE_ADD_ADDR_IMM_SCALED:
+                state->segment_offset += (uint64_t)immediate * state->pointer_size;
+                break;
+            case REBASE_OPCODE_DO_REBASE_IMM_TIMES:
+                state->remaining = immediate;
+                state->stride = state->pointer_size;
+                break;
+            case REBASE_OPCODE_DO_REBASE_ULEB_TIMES:
+                if ((err = __mk_dyld_info_read_uleb128(state, &count)))
+                    return __mk_dyld_info_fail(state, "rebase", opcode, err, error);
+                state->remaining = count;
+                state->stride = state->pointer_size;
+                break;
+            case REBASE_OPCODE_DO_REBASE_ADD_ADDR_ULEB:
+                if ((err = __mk_dyld_info_read_uleb128(state, &skip)))
+                    return __mk_dyld_info_fail(state, "rebase", opcode, err, error);
+                state->remaining = 1;
+                state->stride = skip + state->pointer_size;
+                break;
+            case REBASE_OPCODE_DO_REBASE_ULEB_TIMES_SKIPPING_ULEB:
+                if ((err = __mk_dyld_info_read_uleb128(state, &count)) || (err = __mk_dyld_info_read_uleb128(state, &skip)) || (err = __mk_dyld_info_set_repeat(state, count, skip)))
+                    return __mk_dyld_info_fail(state, "rebase", opcode, err, error);
+                break;
+            default:
+                return __mk_dyld_info_fail(state, "rebase", opcode, MK_EINVALID_DATA, error);
+        }
+    }
+    
+    if ((err = __mk_dyld_info_take_fixup(state, &fixup->address, &fixup->segment_offset)))
+        return __mk_dyld_info_fail(state, "rebase", opcode ?: state->cursor - 1, err, error);
+    
+    fixup->segment_index = state->segment_index;
+    fixup->type = state->type;
+    
+    MK_ERROR_OUT = MK_ESUCCESS;
+    return true;
+}
+
+
+//----------------------------------------------------------------------------//
+#pragma mark -  Bind Information
+//----------------------------------------------------------------------------//
+
+//|++++++++++++++++++++++++++++++++++++|//
+static void
+__mk_bind_iterator_init(bool lazy, mk_bind_iterator_t *iterator)
+{
+    iterator->symbol_name = NULL;
+    iterator->addend = 0;
+    iterator->library_ordinal = 0;
+    iterator->symbol_flags = 0;
+    iterator->lazy = lazy;
+    // dyld assumes pointer binds unless the stream says otherwise.
+    iterator->opcodes.type = BIND_TYPE_POINTER;
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+mk_error_t
+mk_bind_iterator_init(mk_load_command_ref load_command, mk_segment_ref link_edit, mk_dyld_info_bind_stream_t stream, mk_bind_iterator_t *iterator)
+{
+    if (load_command.load_command == NULL) return MK_EINVAL;
+    if (link_edit.segment == NULL) return MK_EINVAL;
+    if (iterator == NULL) return MK_EINVAL;
+    
+    uint32_t command_id = mk_load_command_id(load_command);
+    if (command_id != mk_load_command_dyld_info_id() && command_id != mk_load_command_dyld_info_only_id())
+        return MK_EINVAL;
+    
+    uint32_t offset, size;
+    switch (stream) {
+        case MK_DYLD_INFO_BIND:
+            offset = _mk_load_command_type_dyld_info_get_bind_off(load_command);
+            size = _mk_load_command_type_dyld_info_get_bind_size(load_command);
+            break;
+        case MK_DYLD_INFO_WEAK_BIND:
+            offset = _mk_load_command_type_dyld_info_get_weak_bind_off(load_command);
+            size = _mk_load_command_type_dyld_info_get_weak_bind_size(load_command);
+            break;
+        case MK_DYLD_INFO_LAZY_BIND:
+            offset = _mk_load_command_type_dyld_info_get_lazy_bind_off(load_command);
+            size = _mk_load_command_type_dyld_info_get_lazy_bind_size(load_command);
+            break;
+        default:
+            return MK_EINVAL;
+    }
+    
+    mk_error_t err = __mk_dyld_info_opcodes_map(load_command, link_edit, offset, size, &iterator->opcodes);
+    if (err) return err;
+    
+    __mk_bind_iterator_init(stream == MK_DYLD_INFO_LAZY_BIND, iterator);
+    return MK_ESUCCESS;
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+mk_error_t
+mk_bind_iterator_init_with_opcodes(mk_macho_ref image, const uint8_t *opcodes, size_t length, bool lazy, mk_bind_iterator_t *iterator)
+{
+    if (image.macho == NULL) return MK_EINVAL;
+    if (opcodes == NULL && length != 0) return MK_EINVAL;
+    if (iterator == NULL) return MK_EINVAL;
+    
+    __mk_dyld_info_opcodes_init(image, opcodes, length, &iterator->opcodes);
+    __mk_bind_iterator_init(lazy, iterator);
+    return MK_ESUCCESS;
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+bool
+mk_bind_iterator_next(mk_bind_iterator_t *iterator, mk_bind_fixup_t *fixup, mk_error_t *error)
+{
+    mk_dyld_info_opcodes_t *state = &iterator->opcodes;
+    const uint8_t *opcode = NULL;
+    mk_error_t err;
+    
+    while (state->remaining == 0)
+    {
+        if (state->finished || state->cursor >= state->end) {
+            state->finished = true;
+            MK_ERROR_OUT = MK_ESUCCESS;
+            return false;
+        }
+        
+        opcode = state->cursor++;
+        uint8_t immediate = *opcode & BIND_IMMEDIATE_MASK;
+        uint64_t count, skip;
+        
+        switch (*opcode & BIND_OPCODE_MASK) {
+            case BIND_OPCODE_DONE:
+                // Each lazy binding ends with BIND_OPCODE_DONE.
+                if (!iterator->lazy)
+                    state->finished = true;
+                break;
+            case BIND_OPCODE_SET_DYLIB_ORDINAL_IMM:
+                iterator->library_ordinal = immediate;
+                break;
+            case BIND_OPCODE_SET_DYLIB_ORDINAL_ULEB:
+                if ((err = __mk_dyld_info_read_uleb128(state, &count)))
+                    return __mk_dyld_info_fail(state, "bind", opcode, err, error);
+                if (count > INT32_MAX)
+                    return __mk_dyld_info_fail(state, "bind", opcode, MK_EOVERFLOW, error);
+                iterator->library_ordinal = (int32_t)count;
+                break;
+            case BIND_OPCODE_SET_DYLIB_SPECIAL_IMM:
+                // The special ordinals are small negative numbers.
+                iterator->library_ordinal = immediate ? (int8_t)(BIND_OPCODE_MASK | immediate) : 0;
+                break;
+            case BIND_OPCODE_SET_SYMBOL_TRAILING_FLAGS_IMM:
+            {
+                const uint8_t *terminator = memchr(state->cursor, '\0', (size_t)(state->end - state->cursor));
+                if (terminator == NULL)
+                    return __mk_dyld_info_fail(state, "bind", opcode, MK_EINVALID_DATA, error);
+                iterator->symbol_name = (const char*)state->cursor;
+                iterator->symbol_flags = immediate;
+                state->cursor = terminator + 1;
+                break;
+            }
+            case BIND_OPCODE_SET_TYPE_IMM:
+                state->type = immediate;
+                break;
+            case BIND_OPCODE_SET_ADDEND_SLEB:
+                if ((err = __mk_dyld_info_read_sleb128(state, &iterator->addend)))
+                    return __mk_dyld_info_fail(state, "bind", opcode, err, error);
+                break;
+            case BIND_OPCODE_SET_SEGMENT_AND_OFFSET_ULEB:
+                if ((err = __mk_dyld_info_read_uleb128(state, &skip)))
+                    return __mk_dyld_info_fail(state, "bind", opcode, err, error);
+                __mk_dyld_info_set_segment(state, immediate, skip);
+                break;
+            case BIND_OPCODE_ADD_ADDR_ULEB:
+                if ((err = __mk_dyld_info_read_uleb128(state, &skip)))
+                    return __mk_dyld_info_fail(state, "bind", opcode, err, error);
+                state->segment_offset += skip;
+                break;
+            case BIND_OPCODE_DO_BIND:
+                state->remaining = 1;
+                state->stride = state->pointer_size;
+                break;
+            case BIND_OPCODE_DO_BIND_ADD_ADDR_ULEB:
+                if ((err = __mk_dyld_info_read_uleb128(state, &skip)))
+                    return __mk_dyld_info_fail(state, "bind", opcode, err, error);
+                state->remaining = 1;
+                state->stride = skip + state->pointer_size;
+                break;
+            case BIND_OPCODE_DO_BIND_ADD_ADDR_IMM_SCALED:
+                state->remaining = 1;
+                state->stride = (uint64_t)immediate * state->pointer_size + state->pointer_size;
+                break;
+            case BIND_OPCODE_DO_BIND_ULEB_TIMES_SKIPPING_ULEB:
+                if ((err = __mk_dyld_info_read_uleb128(state, &count)) || (err = __mk_dyld_info_read_uleb128(state, &skip)) || (err = __mk_dyld_info_set_repeat(state, count, skip)))
+                    return __mk_dyld_info_fail(state, "bind", opcode, err, error);
+                break;
+            default:
+                // Includes BIND_OPCODE_THREADED, which is not supported.
+                return __mk_dyld_info_fail(state, "bind", opcode, MK_EINVALID_DATA, error);
+        }
+        
+        if (state->remaining && iterator->symbol_name == NULL)
+            return __mk_dyld_info_fail(state, "bind", opcode, MK_EINVALID_DATA, error);
+    }
+    
+    if ((err = __mk_dyld_info_take_fixup(state, &fixup->address, &fixup->segment_offset)))
+        return __mk_dyld_info_fail(state, "bind", opcode ?: state->cursor - 1, err, error);
+    
+    fixup->addend = iterator->addend;
+    fixup->symbol_name = iterator->symbol_name;
+    fixup->library_ordinal = iterator->library_ordinal;
+    fixup->segment_index = state->segment_index;
+    fixup->type = state->type;
+    fixup->symbol_flags = iterator->symbol_flags;
+    
+    MK_ERROR_OUT = MK_ESUCCESS;
+    return true;
+}
+
+
+//----------------------------------------------------------------------------//
+#pragma mark -  Export Information
+//----------------------------------------------------------------------------//
+
+//|++++++++++++++++++++++++++++++++++++|//
+mk_error_t
+mk_export_trie_init(mk_load_command_ref load_command, mk_segment_ref link_edit, mk_export_trie_t *trie)
+{
+    if (load_command.load_command == NULL) return MK_EINVAL;
+    if (link_edit.segment == NULL) return MK_EINVAL;
+    if (trie == NULL) return MK_EINVAL;
+    
+    uint32_t command_id = mk_load_command_id(load_command);
+    if (command_id != mk_load_command_dyld_info_id() && command_id != mk_load_command_dyld_info_only_id())
+        return MK_EINVAL;
+    
+    // The trie is mapped the same way as the opcode streams.
+    mk_dyld_info_opcodes_t state;
+    mk_error_t err = __mk_dyld_info_opcodes_map(load_command, link_edit,
+                                                _mk_load_command_type_dyld_info_get_export_off(load_command),
+                                                _mk_load_command_type_dyld_info_get_export_size(load_command),
+                                                &state);
+    if (err) return err;
+    
+    trie->start = state.start;
+    trie->length = (size_t)(state.end - state.start);
+    return MK_ESUCCESS;
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+mk_error_t
+mk_export_trie_init_with_bytes(const uint8_t *bytes, size_t length, mk_export_trie_t *trie)
+{
+    if (bytes == NULL && length != 0) return MK_EINVAL;
+    if (trie == NULL) return MK_EINVAL;
+    
+    // Node offsets are encoded in a uint32_t by the iterator.
+    if (length >= UINT32_MAX) return MK_EOVERFLOW;
+    
+    trie->start = bytes;
+    trie->length = length;
+    return MK_ESUCCESS;
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+//! Reads the export information of the node at \a node.  On return,
+//! \a children points to the child count of the node.
+static mk_error_t
+__mk_export_trie_read_node(const mk_export_trie_t *trie, const uint8_t *node, bool *terminal, mk_export_t *result, const uint8_t **children)
+{
+    const uint8_t *end = trie->start + trie->length;
+    const uint8_t *p = node;
+    uint64_t terminal_size;
+    mk_error_t err;
+    
+    if ((err = __mk_read_uleb128(&p, end, &terminal_size)))
+        return err;
+    if (terminal_size >= (uint64_t)(end - p))
+        return MK_EINVALID_DATA;
+    
+    *children = p + terminal_size;
+    *terminal = (terminal_size != 0);
+    if (!*terminal || result == NULL)
+        return MK_ESUCCESS;
+    
+    const uint8_t *info_end = *children;
+    result->offset = 0;
+    result->resolver_offset = 0;
+    result->library_ordinal = 0;
+    result->import_name = NULL;
+    
+    if ((err = __mk_read_uleb128(&p, info_end, &result->flags)))
+        return err;
+    
+    if (result->flags & EXPORT_SYMBOL_FLAGS_REEXPORT) {
+        if ((err = __mk_read_uleb128(&p, info_end, &result->library_ordinal)))
+            return err;
+        const uint8_t *terminator = memchr(p, '\0', (size_t)(info_end - p));
+        if (terminator == NULL)
+            return MK_EINVALID_DATA;
+        if (terminator != p)
+            result->import_name = (const char*)p;
+    } else {
+        if ((err = __mk_read_uleb128(&p, info_end, &result->offset)))
+            return err;
+        if ((result->flags & EXPORT_SYMBOL_FLAGS_STUB_AND_RESOLVER) && (err = __mk_read_uleb128(&p, info_end, &result->resolver_offset)))
+            return err;
+    }
+    
+    return MK_ESUCCESS;
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+mk_error_t
+mk_export_trie_find(const mk_export_trie_t *trie, const char *name, mk_export_t *result)
+{
+    if (trie == NULL) return MK_EINVAL;
+    if (name == NULL) return MK_EINVAL;
+    if (result == NULL) return MK_EINVAL;
+    
+    const uint8_t *end = trie->start + trie->length;
+    const uint8_t *node = trie->start;
+    const char *remaining = name;
+    mk_error_t err;
+    
+    if (trie->length == 0)
+        return MK_ENOT_FOUND;
+    
+    // Every edge consumes at least one character of the name, so this
+    // terminates even if the trie contains a cycle.
+    while (true)
+    {
+        const uint8_t *p;
+        bool terminal;
+        
+        if (*remaining == '\0') {
+            if ((err = __mk_export_trie_read_node(trie, node, &terminal, result, &p)))
+                return err;
+            if (!terminal)
+                return MK_ENOT_FOUND;
+            
+            result->name = name;
+            return MK_ESUCCESS;
+        }
+        
+        if ((err = __mk_export_trie_read_node(trie, node, &terminal, NULL, &p)))
+            return err;
+        
+        uint8_t edge_count = *p++;
+        const uint8_t *child = NULL;
+        
+        for (uint8_t i = 0; i < edge_count && child == NULL; i++)
+        {
+            // Compare the edge label to the name, then skip the rest of
+            // the label if it did not match.
+            const char *c = remaining;
+            while (p < end && *p != '\0' && *p == (uint8_t)*c) {
+                p++;
+                c++;
+            }
+            bool matched = (p < end && *p == '\0' && c != remaining);
+            
+            const uint8_t *terminator = memchr(p, '\0', (size_t)(end - p));
+            if (terminator == NULL)
+                return MK_EINVALID_DATA;
+            p = terminator + 1;
+            
+            uint64_t child_offset;
+            if ((err = __mk_read_uleb128(&p, end, &child_offset)))
+                return err;
+            
+            if (matched) {
+                if (child_offset >= trie->length)
+                    return MK_EINVALID_DATA;
+                child = trie->start + child_offset;
+                remaining = c;
+            }
+        }
+        
+        if (child == NULL)
+            return MK_ENOT_FOUND;
+        node = child;
+    }
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+mk_error_t
+mk_export_iterator_init(const mk_export_trie_t *trie, char *name, size_t name_size, mk_export_iterator_frame_t *frames, uint32_t frame_capacity, mk_export_iterator_t *iterator)
+{
+    if (trie == NULL) return MK_EINVAL;
+    if (name == NULL || name_size == 0) return MK_EINVAL;
+    if (frames == NULL || frame_capacity == 0) return MK_EINVAL;
+    if (iterator == NULL) return MK_EINVAL;
+    if (trie->length >= UINT32_MAX) return MK_EOVERFLOW;
+    
+    iterator->trie = *trie;
+    iterator->name = name;
+    iterator->name_size = name_size;
+    iterator->frames = frames;
+    iterator->frame_capacity = frame_capacity;
+    iterator->frame_count = 0;
+    iterator->pending_node = (trie->length != 0) ? 0 : UINT32_MAX;
+    iterator->pending_name_length = 0;
+    
+    name[0] = '\0';
+    return MK_ESUCCESS;
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+static bool
+__mk_export_iterator_fail(mk_export_iterator_t *iterator, mk_error_t err, mk_error_t *error)
+{
+    iterator->frame_count = 0;
+    iterator->pending_node = UINT32_MAX;
+    
+    MK_ERROR_OUT = err;
+    return false;
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+bool
+mk_export_iterator_next(mk_export_iterator_t *iterator, mk_export_t *result, mk_error_t *error)
+{
+    const mk_export_trie_t *trie = &iterator->trie;
+    const uint8_t *end = trie->start + trie->length;
+    mk_error_t err;
+    
+    while (true)
+    {
+        // Enter the pending node, reporting its export if it has one.
+        if (iterator->pending_node != UINT32_MAX)
+        {
+            const uint8_t *p;
+            bool terminal;
+            
+            if (iterator->frame_count == iterator->frame_capacity)
+                return __mk_export_iterator_fail(iterator, MK_EOVERFLOW, error);
+            
+            if ((err = __mk_export_trie_read_node(trie, trie->start + iterator->pending_node, &terminal, result, &p)))
+                return __mk_export_iterator_fail(iterator, err, error);
+            if (p >= end)
+                return __mk_export_iterator_fail(iterator, MK_EINVALID_DATA, error);
+            
+            mk_export_iterator_frame_t *frame = &iterator->frames[iterator->frame_count++];
+            frame->edges_remaining = *p;
+            frame->edge_offset = (uint32_t)(p + 1 - trie->start);
+            frame->name_length = iterator->pending_name_length;
+            
+            iterator->pending_node = UINT32_MAX;
+            
+            if (terminal) {
+                iterator->name[frame->name_length] = '\0';
+                result->name = iterator->name;
+                MK_ERROR_OUT = MK_ESUCCESS;
+                return true;
+            }
+            continue;
+        }
+        
+        if (iterator->frame_count == 0) {
+            MK_ERROR_OUT = MK_ESUCCESS;
+            return false;
+        }
+        
+        mk_export_iterator_frame_t *frame = &iterator->frames[iterator->frame_count - 1];
+        if (frame->edges_remaining == 0) {
+            iterator->frame_count--;
+            continue;
+        }
+        
+        // Follow the next edge, appending its label to the name.
+        const uint8_t *p = trie->start + frame->edge_offset;
+        const uint8_t *terminator = memchr(p, '\0', (size_t)(end - p));
+        if (terminator == NULL || terminator == p)
+            return __mk_export_iterator_fail(iterator, MK_EINVALID_DATA, error);
+        
+        size_t label_length = (size_t)(terminator - p);
+        if (label_length >= iterator->name_size - frame->name_length)
+            return __mk_export_iterator_fail(iterator, MK_EOVERFLOW, error);
+        memcpy(iterator->name + frame->name_length, p, label_length);
+        
+        p = terminator + 1;
+        uint64_t child_offset;
+        if ((err = __mk_read_uleb128(&p, end, &child_offset)))
+            return __mk_export_iterator_fail(iterator, err, error);
+        if (child_offset >= trie->length)
+            return __mk_export_iterator_fail(iterator, MK_EINVALID_DATA, error);
+        
+        frame->edge_offset = (uint32_t)(p - trie->start);
+        frame->edges_remaining--;
+        
+        iterator->pending_node = (uint32_t)child_offset;
+        iterator->pending_name_length = frame->name_length + (uint32_t)label_length;
+    }
+}
@@ -0,0 +1,291 @@
+//----------------------------------------------------------------------------//
+//|
+//|             MachOKit - A Lightweight Mach-O Parsing Library
+//! @file       dyld_info.h
+//!
+//! @author     D.V.
+//! @copyright  Copyright (c) 2014-2015 D.V. All rights reserved.
+//|
+//| Permission is hereby granted, free of charge, to any person obtaining a
+//| copy of this software and associated documentation files (the "Software"),
+//| to deal in the Software without restriction, including without limitation
+//| the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//| and/or sell copies of the Software, and to permit persons to whom the
+//| Software is furnished to do so, subject to the following conditions:
+//|
+//| The above copyright notice and this permission notice shall be included
+//| in all copies or substantial portions of the Software.
+//|
+//| THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+//| OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+//| MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+//| IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+//| CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+//| TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//| SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//----------------------------------------------------------------------------//
+
+
+#ifndef _dyld_info_h
+#define _dyld_info_h
+
+//! @addtogroup MACH
+//! @{
+//!
+
+//----------------------------------------------------------------------------//
+#pragma mark -  Dyld Info Opcodes
+//! @name       Dyld Info Opcodes
+//!
+//! The rebase and bind information referenced by \c LC_DYLD_INFO and
+//! \c LC_DYLD_INFO_ONLY is encoded as a stream of opcodes.  The iterators
+//! below interpret a stream in place, one fixup at a time, without
+//! allocating memory.  Opcodes that apply a fixup repeatedly are not
+//! expanded; the iterator steps through the repetitions as the fixups are
+//! requested.
+//----------------------------------------------------------------------------//
+
+//◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
+//! The bind opcode streams referenced by a dyld info load command.
+//
+typedef enum {
+    MK_DYLD_INFO_BIND = 0,
+    MK_DYLD_INFO_WEAK_BIND,
+    MK_DYLD_INFO_LAZY_BIND
+} mk_dyld_info_bind_stream_t;
+
+//◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
+//! Interpreter state shared by the rebase and bind iterators.  Should be
+//! considered opaque.
+//
+typedef struct mk_dyld_info_opcodes_s {
+    struct mk_macho_s *image;
+    const uint8_t *start;
+    const uint8_t *cursor;
+    const uint8_t *end;
+    //! Fixups remaining for the current DO_* opcode.
+    uint64_t remaining;
+    //! Amount the segment offset is advanced after each of those fixups.
+    uint64_t stride;
+    uint64_t segment_offset;
+    mk_vm_address_t segment_address;
+    mk_vm_size_t segment_size;
+    uint8_t segment_index;
+    uint8_t type;
+    uint8_t pointer_size;
+    bool segment_resolved;
+    bool finished;
+} mk_dyld_info_opcodes_t;
+
+//◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
+//! A location that must be rebased.
+//
+typedef struct mk_rebase_fixup_s {
+    //! The address to rebase, including the slide of the image.
+    mk_vm_address_t address;
+    //! Offset of \c address from the start of its segment.
+    mk_vm_offset_t segment_offset;
+    //! Index of the segment containing \c address.
+    uint8_t segment_index;
+    //! One of the \c REBASE_TYPE_* constants.
+    uint8_t type;
+} mk_rebase_fixup_t;
+
+//◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
+//! A location that must be bound to a symbol.
+//
+typedef struct mk_bind_fixup_s {
+    //! The address to bind, including the slide of the image.
+    mk_vm_address_t address;
+    //! Offset of \c address from the start of its segment.
+    mk_vm_offset_t segment_offset;
+    //! The value added to the address of the symbol.
+    int64_t addend;
+    //! The name of the symbol.  Points into the opcode stream, and is valid
+    //! for as long as the stream is mapped.
+    const char *symbol_name;
+    //! The library the symbol is imported from, or one of the
+    //! \c BIND_SPECIAL_DYLIB_* constants.
+    int32_t library_ordinal;
+    //! Index of the segment containing \c address.
+    uint8_t segment_index;
+    //! One of the \c BIND_TYPE_* constants.
+    uint8_t type;
+    //! The \c BIND_SYMBOL_FLAGS_* for the symbol.
+    uint8_t symbol_flags;
+} mk_bind_fixup_t;
+
+//◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
+//! Iterates the rebase opcode stream of an image.
+//
+typedef struct mk_rebase_iterator_s {
+    mk_dyld_info_opcodes_t opcodes;
+} mk_rebase_iterator_t;
+
+//◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
+//! Iterates one of the bind opcode streams of an image.
+//
+typedef struct mk_bind_iterator_s {
+    mk_dyld_info_opcodes_t opcodes;
+    const char *symbol_name;
+    int64_t addend;
+    int32_t library_ordinal;
+    uint8_t symbol_flags;
+    //! In the lazy bind stream, \c BIND_OPCODE_DONE ends each entry rather
+    //! than the stream.
+    bool lazy;
+} mk_bind_iterator_t;
+
+
+//----------------------------------------------------------------------------//
+#pragma mark -  Rebase Information
+//! @name       Rebase Information
+//----------------------------------------------------------------------------//
+
+//! Initializes \a iterator with the rebase opcodes referenced by
+//! \a load_command, which must be an \c LC_DYLD_INFO or \c LC_DYLD_INFO_ONLY
+//! load command.  The opcodes are read in place from \a link_edit.
+_mk_export mk_error_t
+mk_rebase_iterator_init(mk_load_command_ref load_command, mk_segment_ref link_edit, mk_rebase_iterator_t *iterator);
+
+//! Initializes \a iterator with the \a length bytes of rebase opcodes at
+//! \a opcodes.  Segment indices in the opcodes refer to the segments of
+//! \a image.
+_mk_export mk_error_t
+mk_rebase_iterator_init_with_opcodes(mk_macho_ref image, const uint8_t *opcodes, size_t length, mk_rebase_iterator_t *iterator);
+
+//! Interprets opcodes until the next rebase, which is stored in \a fixup.
+//! Returns \c false at the end of the stream, or if the opcodes are
+//! invalid, in which case \a error is set.
+_mk_export bool
+mk_rebase_iterator_next(mk_rebase_iterator_t *iterator, mk_rebase_fixup_t *fixup, mk_error_t *error);
+
+
+//----------------------------------------------------------------------------//
+#pragma mark -  Bind Information
+//! @name       Bind Information
+//----------------------------------------------------------------------------//
+
+//! Initializes \a iterator with the opcodes of the bind \a stream referenced
+//! by \a load_command, which must be an \c LC_DYLD_INFO or
+//! \c LC_DYLD_INFO_ONLY load command.  The opcodes are read in place from
+//! \a link_edit.
+_mk_export mk_error_t
+mk_bind_iterator_init(mk_load_command_ref load_command, mk_segment_ref link_edit, mk_dyld_info_bind_stream_t stream, mk_bind_iterator_t *iterator);
+
+//! Initializes \a iterator with the \a length bytes of bind opcodes at
+//! \a opcodes.  If \a lazy is \c true, the opcodes are interpreted as a lazy
+//! bind stream.  Segment indices in the opcodes refer to the segments of
+//! \a image.
+_mk_export mk_error_t
+mk_bind_iterator_init_with_opcodes(mk_macho_ref image, const uint8_t *opcodes, size_t length, bool lazy, mk_bind_iterator_t *iterator);
+
+//! Interprets opcodes until the next bind, which is stored in \a fixup.
+//! Returns \c false at the end of the stream, or if the opcodes are
+//! invalid, in which case \a error is set.
+_mk_export bool
+mk_bind_iterator_next(mk_bind_iterator_t *iterator, mk_bind_fixup_t *fixup, mk_error_t *error);
+
+
+//----------------------------------------------------------------------------//
+#pragma mark -  Export Information
+//! @name       Export Information
+//!
+//! The symbols exported by an image are encoded as a trie.  Each node of the
+//! trie may describe an export, and has edges labelled with the next
+//! characters of the names below it.
+//----------------------------------------------------------------------------//
+
+//◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
+//! An export trie, read in place.
+//
+typedef struct mk_export_trie_s {
+    const uint8_t *start;
+    size_t length;
+} mk_export_trie_t;
+
+//◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
+//! An exported symbol.
+//
+typedef struct mk_export_s {
+    //! The name of the symbol.
+    const char *name;
+    //! The \c EXPORT_SYMBOL_FLAGS_* for the symbol.
+    uint64_t flags;
+    //! Offset of the symbol from the Mach header, or its value if the symbol
+    //! is absolute.  Zero for re-exports.
+    mk_vm_offset_t offset;
+    //! For \c EXPORT_SYMBOL_FLAGS_STUB_AND_RESOLVER, the offset of the
+    //! resolver function from the Mach header.
+    mk_vm_offset_t resolver_offset;
+    //! For \c EXPORT_SYMBOL_FLAGS_REEXPORT, the library the symbol is
+    //! re-exported from.
+    uint64_t library_ordinal;
+    //! For \c EXPORT_SYMBOL_FLAGS_REEXPORT, the name of the symbol in that
+    //! library, or \c NULL if it is the same.  Points into the trie.
+    const char *import_name;
+} mk_export_t;
+
+//◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
+//! A node of the export trie on the stack of an \ref mk_export_iterator_t.
+//
+typedef struct mk_export_iterator_frame_s {
+    //! Offset of the next unvisited edge of the node.
+    uint32_t edge_offset;
+    //! Number of unvisited edges of the node.
+    uint32_t edges_remaining;
+    //! Length of the name of the node.
+    uint32_t name_length;
+} mk_export_iterator_frame_t;
+
+//◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
+//! Enumerates the exports in an export trie, depth first.  The caller
+//! provides the storage for the name of the current export and for the
+//! stack of nodes.
+//
+typedef struct mk_export_iterator_s {
+    mk_export_trie_t trie;
+    char *name;
+    size_t name_size;
+    mk_export_iterator_frame_t *frames;
+    uint32_t frame_capacity;
+    uint32_t frame_count;
+    //! Offset of the node to visit next, or \c UINT32_MAX.
+    uint32_t pending_node;
+    uint32_t pending_name_length;
+} mk_export_iterator_t;
+
+//! Initializes \a trie with the export trie referenced by \a load_command,
+//! which must be an \c LC_DYLD_INFO or \c LC_DYLD_INFO_ONLY load command.
+//! The trie is read in place from \a link_edit.
+_mk_export mk_error_t
+mk_export_trie_init(mk_load_command_ref load_command, mk_segment_ref link_edit, mk_export_trie_t *trie);
+
+//! Initializes \a trie with the \a length bytes at \a bytes.
+_mk_export mk_error_t
+mk_export_trie_init_with_bytes(const uint8_t *bytes, size_t length, mk_export_trie_t *trie);
+
+//! Looks up the export named \a name by descending the trie, without
+//! visiting any other exports.  Returns \ref MK_ENOT_FOUND if \a name is
+//! not exported.
+_mk_export mk_error_t
+mk_export_trie_find(const mk_export_trie_t *trie, const char *name, mk_export_t *result);
+
+//! Initializes \a iterator to enumerate the exports in \a trie.  The name
+//! of each export is assembled in the \a name_size bytes at \a name.
+//! \a frames must have room for one more frame than the longest path
+//! through the trie.
+_mk_export mk_error_t
+mk_export_iterator_init(const mk_export_trie_t *trie, char *name, size_t name_size, mk_export_iterator_frame_t *frames, uint32_t frame_capacity, mk_export_iterator_t *iterator);
+
+//! Advances to the next export, which is stored in \a result.  The name of
+//! \a result is only valid until the next call.  Returns \c false after the
+//! last export, or if the trie is invalid or does not fit in the storage
+//! provided to the iterator, in which case \a error is set.
+_mk_export bool
+mk_export_iterator_next(mk_export_iterator_t *iterator, mk_export_t *result, mk_error_t *error);
+
+
+//! @} MACH !//
+
+#endif /* _dyld_info_h */
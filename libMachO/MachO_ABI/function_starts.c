@@ -0,0 +1,239 @@
+//----------------------------------------------------------------------------//
+//|
+//|             MachOKit - A Lightweight Mach-O Parsing Library
+//|             function_starts.c
+//|
+//|             D.V.
+//|             Copyright (c) 2014-2015 D.V. All rights reserved.
+//|
+//| Permission is hereby granted, free of charge, to any person obtaining a
+//| copy of this software and associated documentation files (the "Software"),
+//| to deal in the Software without restriction, including without limitation
+//| the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//| and/or sell copies of the Software, and to permit persons to whom the
+//| Software is furnished to do so, subject to the following conditions:
+//|
+//| The above copyright notice and this permission notice shall be included
+//| in all copies or substantial portions of the Software.
+//|
+//| THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+//| OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+//| MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+//| IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+//| CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+//| TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//| SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//----------------------------------------------------------------------------//
+
+#include "macho_abi_internal.h"
+
+//----------------------------------------------------------------------------//
+#pragma mark -  Decoding Function Starts
+//----------------------------------------------------------------------------//
+
+//|++++++++++++++++++++++++++++++++++++|//
+void
+mk_function_starts_decoder_init(mk_function_starts_decoder_t *decoder, mk_vm_address_t text_address)
+{
+    decoder->address = text_address;
+    decoder->value = 0;
+    decoder->shift = 0;
+    decoder->finished = false;
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+static inline size_t
+__mk_function_starts_decode(mk_function_starts_decoder_t *decoder, const uint8_t *data, size_t length, mk_vm_address_t *addresses, uint32_t capacity, uint32_t *count, mk_error_t *error, bool fast)
+{
+    const uint8_t *p = data;
+    const uint8_t *end = data + length;
+    mk_vm_address_t address = decoder->address;
+    uint64_t value = decoder->value;
+    uint32_t shift = decoder->shift;
+    uint32_t written = 0;
+    
+    if (error) *error = MK_ESUCCESS;
+    
+    while (!decoder->finished && p < end && written < capacity)
+    {
+        // Decode the run of single byte deltas at the start of the next
+        // eight bytes at once.  A run ends at the first byte with the high
+        // bit set, which continues a multi-byte delta, or the first zero
+        // byte, which ends the table.  The function starts of most images
+        // are predominantly short deltas.
+        if (fast && shift == 0 && end - p >= 8 && capacity - written >= 8) {
+            uint64_t word;
+            __builtin_memcpy(&word, p, sizeof(word));
+            
+            uint64_t continuation = word & 0x8080808080808080ULL;
+            uint64_t zero = (word - 0x0101010101010101ULL) & ~word & 0x8080808080808080ULL;
+            uint64_t stop = continuation | zero;
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+            unsigned run = stop ? (unsigned)__builtin_ctzll(stop) / 8 : 8;
+#else
+            unsigned run = stop ? (unsigned)__builtin_clzll(stop) / 8 : 8;
+#endif
+            // Always store eight running sums; entries past the end of the
+            // run are overwritten by the addresses decoded after it.
+            mk_vm_address_t sum = address;
+            for (unsigned i = 0; i < 8; i++) {
+                sum += p[i];
+                addresses[written + i] = sum;
+            }
+            if (run > 0)
+                address = addresses[written + run - 1];
+            p += run;
+            written += run;
+            if (run == 8 || p == end)
+                continue;
+        }
+        
+        uint8_t byte = *p++;
+        
+        if (shift >= 64 || (shift == 63 && (byte & 0x7F) > 1)) {
+            if (error) *error = MK_EOVERFLOW;
+            break;
+        }
+        
+        value |= (uint64_t)(byte & 0x7F) << shift;
+        if (byte & 0x80) {
+            shift += 7;
+            continue;
+        }
+        
+        if (value == 0) {
+            decoder->finished = true;
+        } else {
+            address += value;
+            addresses[written++] = address;
+        }
+        
+        value = 0;
+        shift = 0;
+    }
+    
+    decoder->address = address;
+    decoder->value = value;
+    decoder->shift = shift;
+    
+    if (count) *count = written;
+    return (size_t)(p - data);
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+size_t
+mk_function_starts_decode(mk_function_starts_decoder_t *decoder, const uint8_t *data, size_t length, mk_vm_address_t *addresses, uint32_t capacity, uint32_t *count, mk_error_t *error)
+{ return __mk_function_starts_decode(decoder, data, length, addresses, capacity, count, error, true); }
+
+//|++++++++++++++++++++++++++++++++++++|//
+size_t
+mk_function_starts_decode_scalar(mk_function_starts_decoder_t *decoder, const uint8_t *data, size_t length, mk_vm_address_t *addresses, uint32_t capacity, uint32_t *count, mk_error_t *error)
+{ return __mk_function_starts_decode(decoder, data, length, addresses, capacity, count, error, false); }
+
+//|++++++++++++++++++++++++++++++++++++|//
+mk_error_t
+mk_function_starts_copy_addresses(mk_load_command_ref load_command, mk_segment_ref link_edit, mk_vm_address_t *addresses, uint32_t capacity, uint32_t *count)
+{
+    if (load_command.load_command == NULL) return MK_EINVAL;
+    if (mk_load_command_id(load_command) != mk_load_command_function_starts_id()) return MK_EINVAL;
+    if (link_edit.segment == NULL) return MK_EINVAL;
+    if (count == NULL) return MK_EINVAL;
+    
+    mk_macho_ref image = mk_load_command_get_macho(load_command);
+    mk_context_t *context = mk_type_get_context(load_command.load_command);
+    mk_error_t err;
+    
+    if (mk_segment_get_macho(link_edit).macho != image.macho)
+        return MK_EINVAL;
+    
+    // Find the start of __TEXT.
+    mk_vm_address_t text_address = MK_VM_ADDRESS_INVALID;
+    {
+        bool is_64_bit = mk_macho_is_64_bit(image);
+        struct load_command *lc = NULL;
+        
+        while ((lc = mk_macho_next_command_type(image, lc, is_64_bit ? LC_SEGMENT_64 : LC_SEGMENT, NULL)))
+        {
+            mk_load_command_t segment;
+            char seg_name[17] = {0x0};
+            
+            if (mk_load_command_init(image, lc, &segment))
+                continue;
+            
+            if (is_64_bit)
+                mk_load_command_segment_64_copy_name(&segment, seg_name);
+            else
+                mk_load_command_segment_copy_name(&segment, seg_name);
+            
+            if (strncmp(seg_name, SEG_TEXT, sizeof(seg_name)))
+                continue;
+            
+            text_address = is_64_bit ? mk_load_command_segment_64_get_vmaddr(&segment) : mk_load_command_segment_get_vmaddr(&segment);
+            break;
+        }
+        
+        if (text_address == MK_VM_ADDRESS_INVALID) {
+            _mkl_error(context, "No __TEXT segment in %s", mk_macho_get_name(image));
+            return MK_ENOT_FOUND;
+        }
+        
+        if ((err = mk_vm_address_apply_offset(text_address, mk_macho_get_slide(image), &text_address)))
+            return err;
+    }
+    
+    // Locate the table in __LINKEDIT, in the same way as the symbol table.
+    uint32_t dataoff = mk_load_command_function_starts_get_dataoff(load_command);
+    uint32_t datasize = mk_load_command_function_starts_get_datasize(load_command);
+    mk_vm_address_t vm_address = mk_segment_get_range(link_edit).location;
+    
+    if ((err = mk_vm_address_add(vm_address, dataoff, &vm_address))) {
+        _mkl_error(context, "Arithmetic error %s while adding offset (%" PRIi32 ") to __LINKEDIT vm_address (0x%" MK_VM_PRIxADDR ")", mk_error_string(err), dataoff, vm_address);
+        return err;
+    }
+    
+    if ((err = mk_vm_address_substract(vm_address, mk_segment_get_fileoff(link_edit), &vm_address))) {
+        _mkl_error(context, "Arithmetic error %s while subtracting __LINKEDIT file offset (0x%" MK_VM_PRIxADDR ") from (0x%" MK_VM_PRIxADDR ")", mk_error_string(err), mk_segment_get_fileoff(link_edit), vm_address);
+        return err;
+    }
+    
+    *count = 0;
+    if (datasize == 0)
+        return MK_ESUCCESS;
+    
+    vm_address_t data = mk_memory_object_remap_address(mk_segment_get_mobj(link_edit), 0, vm_address, datasize, &err);
+    if (data == UINTPTR_MAX) {
+        _mkl_error(context, "__LINKEDIT segment does not fully contain the function starts table.");
+        return err;
+    }
+    
+    mk_function_starts_decoder_t decoder;
+    mk_function_starts_decoder_init(&decoder, text_address);
+    
+    const uint8_t *p = (const uint8_t*)data;
+    size_t remaining = datasize;
+    uint32_t total = 0;
+    
+    // Decode directly into the caller's buffer, then continue decoding into
+    // scratch space to count any function starts that did not fit.
+    if (addresses && capacity > 0) {
+        uint32_t decoded;
+        size_t consumed = mk_function_starts_decode(&decoder, p, remaining, addresses, capacity, &decoded, &err);
+        if (err) return err;
+        p += consumed;
+        remaining -= consumed;
+        total += decoded;
+    }
+    
+    while (!decoder.finished && remaining > 0) {
+        mk_vm_address_t scratch[64];
+        uint32_t decoded;
+        size_t consumed = mk_function_starts_decode(&decoder, p, remaining, scratch, 64, &decoded, &err);
+        if (err) return err;
+        p += consumed;
+        remaining -= consumed;
+        total += decoded;
+    }
+    
+    *count = total;
+    return MK_ESUCCESS;
+}
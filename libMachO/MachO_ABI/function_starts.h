@@ -0,0 +1,92 @@
+//----------------------------------------------------------------------------//
+//|
+//|             MachOKit - A Lightweight Mach-O Parsing Library
+//! @file       function_starts.h
+//!
+//! @author     D.V.
+//! @copyright  Copyright (c) 2014-2015 D.V. All rights reserved.
+//|
+//| Permission is hereby granted, free of charge, to any person obtaining a
+//| copy of this software and associated documentation files (the "Software"),
+//| to deal in the Software without restriction, including without limitation
+//| the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//| and/or sell copies of the Software, and to permit persons to whom the
+//| Software is furnished to do so, subject to the following conditions:
+//|
+//| The above copyright notice and this permission notice shall be included
+//| in all copies or substantial portions of the Software.
+//|
+//| THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+//| OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+//| MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+//| IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+//| CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+//| TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//| SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//----------------------------------------------------------------------------//
+
+#ifndef _function_starts_h
+#define _function_starts_h
+
+//! @addtogroup MACH
+//! @{
+//!
+
+//----------------------------------------------------------------------------//
+#pragma mark -  Decoding Function Starts
+//! @name       Decoding Function Starts
+//!
+//! The function starts table is a sequence of ULEB128 encoded deltas,
+//! terminated by a zero delta.  The first delta is from the start of the
+//! \c __TEXT segment, and each subsequent delta is from the previous
+//! function start.
+//----------------------------------------------------------------------------//
+
+//◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
+//! State of a streaming decode of a function starts table.  The table may
+//! be passed to the decoder in pieces of any size.
+//
+typedef struct mk_function_starts_decoder_s {
+    //! The most recently decoded function start.
+    mk_vm_address_t address;
+    //! Bits of a ULEB128 value that was split between two pieces.
+    uint64_t value;
+    //! Number of bits in \c value.
+    uint32_t shift;
+    //! Set once the terminating zero delta has been decoded.
+    bool finished;
+} mk_function_starts_decoder_t;
+
+//! Initializes \a decoder to decode a function starts table for an image
+//! whose \c __TEXT segment starts at \a text_address.
+_mk_export void
+mk_function_starts_decoder_init(mk_function_starts_decoder_t *decoder, mk_vm_address_t text_address);
+
+//! Decodes function starts from the \a length bytes at \a data into
+//! \a addresses, stopping when \a capacity addresses have been decoded,
+//! the input is exhausted, or the end of the table is reached.  Returns the
+//! number of bytes consumed.  \a count is set to the number of addresses
+//! written to \a addresses.
+//!
+//! Runs of single byte deltas are decoded up to eight at a time.  Entries of
+//! \a addresses beyond \a count may be overwritten.
+_mk_export size_t
+mk_function_starts_decode(mk_function_starts_decoder_t *decoder, const uint8_t *data, size_t length, mk_vm_address_t *addresses, uint32_t capacity, uint32_t *count, mk_error_t *error);
+
+//! Equivalent to \ref mk_function_starts_decode, but decodes one byte at a
+//! time.
+_mk_export size_t
+mk_function_starts_decode_scalar(mk_function_starts_decoder_t *decoder, const uint8_t *data, size_t length, mk_vm_address_t *addresses, uint32_t capacity, uint32_t *count, mk_error_t *error);
+
+//! Decodes the function starts table referenced by \a load_command, which
+//! resides in \a link_edit, into \a addresses.  Addresses include the slide
+//! of the image.  If \a addresses is \c NULL, only counts the function
+//! starts.  \a count is set to the total number of function starts in the
+//! table, which may be greater than \a capacity.
+_mk_export mk_error_t
+mk_function_starts_copy_addresses(mk_load_command_ref load_command, mk_segment_ref link_edit, mk_vm_address_t *addresses, uint32_t capacity, uint32_t *count);
+
+
+//! @} MACH !//
+
+#endif /* _function_starts_h */
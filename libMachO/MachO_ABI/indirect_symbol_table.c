@@ -34,7 +34,7 @@
 //|++++++++++++++++++++++++++++++++++++|//
 static mk_context_t*
 __mk_indirect_symbol_table_get_context(mk_type_ref self)
-{ return mk_type_get_context( &((mk_symbol_table_t*)self)->link_edit ); }
+{ return mk_type_get_context( ((mk_indirect_symbol_table_t*)self)->link_edit.segment ); }
 
 const struct _mk_indirect_symbol_table_vtable _mk_indirect_symbol_table_class = {
     .base.super                 = &_mk_type_class,
@@ -184,7 +184,7 @@ mk_mach_load_command_id(mk_macho_ref image, struct load_command* lc)
         return 0;
     }
     
-    return mk_macho_get_byte_order(image)->swap32( lc->cmd );
+    return mk_byteorder_swap32(mk_macho_get_byte_order(image), lc->cmd);
 }
 
 //----------------------------------------------------------------------------//
@@ -204,7 +204,7 @@ mk_load_command_init(const mk_macho_ref image, struct load_command* lc, mk_load_
         _mkl_error(mk_type_get_context(image.macho), "Header mapping does not entirely contain load command %d in image %s", lc->cmd, image.macho->name);
         return MK_EINVALID_DATA;
     }
-    if (!mk_memory_object_verify_local_pointer(&image.macho->header_mapping, 0, (vm_address_t)lc, mk_macho_get_byte_order(image)->swap32(lc->cmdsize), NULL)) {
+    if (!mk_memory_object_verify_local_pointer(&image.macho->header_mapping, 0, (vm_address_t)lc, mk_byteorder_swap32(mk_macho_get_byte_order(image), lc->cmdsize), NULL)) {
         _mkl_error(mk_type_get_context(image.macho), "Header mapping does not entirely contain load command %d in image %s", lc->cmd, image.macho->name);
         return MK_EINVALID_DATA;
     }
@@ -407,7 +407,7 @@ mk_load_command_id(mk_load_command_ref load_command)
 
 //|++++++++++++++++++++++++++++++++++++|//
 mk_vm_size_t mk_load_command_size(mk_load_command_ref load_command)
-{ return (mk_vm_size_t)mk_macho_get_byte_order(load_command.load_command->image)->swap32( load_command.load_command->mach_load_command->cmdsize ); }
+{ return (mk_vm_size_t)mk_byteorder_swap32(mk_macho_get_byte_order(load_command.load_command->image), load_command.load_command->mach_load_command->cmdsize); }
 
 //|++++++++++++++++++++++++++++++++++++|//
 size_t
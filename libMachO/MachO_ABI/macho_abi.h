@@ -43,6 +43,11 @@
 #include "segment.h"
 #include "string_table.h"
 #include "symbol_table.h"
+#include "symbol_index.h"
+#include "symbol_address_index.h"
+#include "nlist_columns.h"
+#include "function_starts.h"
+#include "dyld_info.h"
 #include "indirect_symbol_table.h"
 
 #endif /* _macho_abi_h */
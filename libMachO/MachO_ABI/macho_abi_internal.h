@@ -40,6 +40,8 @@
 #include "symbol_internal.h"
 #include "string_table_internal.h"
 #include "symbol_table_internal.h"
+#include "symbol_index_internal.h"
+#include "symbol_address_index_internal.h"
 #include "indirect_symbol_table_internal.h"
 
 #endif /* _macho_abi_internal_h */
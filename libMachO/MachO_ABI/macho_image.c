@@ -27,6 +27,8 @@
 
 #include "macho_abi_internal.h"
 
+#include <stdlib.h>
+
 //----------------------------------------------------------------------------//
 #pragma mark -  Classes
 //----------------------------------------------------------------------------//
@@ -48,6 +50,9 @@ intptr_t mk_macho_image_type = (intptr_t)&_mk_macho_image_class;
 #pragma mark -  Working With MachO Binaries
 //----------------------------------------------------------------------------//
 
+static void __mk_macho_build_load_command_index(mk_macho_t *image);
+static void __mk_macho_build_section_table(mk_macho_t *image);
+
 //|++++++++++++++++++++++++++++++++++++|//
 mk_error_t
 mk_macho_init(mk_context_t *ctx, const char *name, intptr_t slide, mk_vm_address_t header_addr,
@@ -85,8 +90,10 @@ mk_macho_init(mk_context_t *ctx, const char *name, intptr_t slide, mk_vm_address
             return MK_EINVAL;
     }
     
-    header.filetype = mk_data_model_get_byte_order(image->data_model)->swap32(header.filetype);
-    header.sizeofcmds = mk_data_model_get_byte_order(image->data_model)->swap32(header.sizeofcmds);
+    image->byte_order = mk_data_model_get_byte_order(image->data_model);
+    
+    header.filetype = mk_byteorder_swap32(image->byte_order, header.filetype);
+    header.sizeofcmds = mk_byteorder_swap32(image->byte_order, header.sizeofcmds);
     
     // Only support a subset of the MachO types at this time
     switch (header.filetype) {
@@ -114,6 +121,10 @@ mk_macho_init(mk_context_t *ctx, const char *name, intptr_t slide, mk_vm_address
     }
     
     image->vtable = &_mk_macho_image_class;
+    
+    __mk_macho_build_load_command_index(image);
+    __mk_macho_build_section_table(image);
+    
     return MK_ESUCCESS;
 }
 
@@ -124,6 +135,15 @@ void mk_macho_free(mk_macho_ref image)
     image.macho->vtable = NULL;
     image.macho->context = NULL;
     image.macho->header = NULL;
+    image.macho->byte_order = NULL;
+    image.macho->load_command_index_valid = false;
+    image.macho->load_command_count = 0;
+    free(image.macho->load_commands);
+    image.macho->load_commands = NULL;
+    image.macho->section_count = 0;
+    free(image.macho->sections);
+    image.macho->sections = NULL;
+    image.macho->sections_by_address = NULL;
 }
 
 //|++++++++++++++++++++++++++++++++++++|//
@@ -136,7 +156,7 @@ mk_data_model_ref mk_macho_get_data_model(mk_macho_ref image)
 
 //|++++++++++++++++++++++++++++++++++++|//
 const mk_byteorder_t* mk_macho_get_byte_order(mk_macho_ref image)
-{ return mk_data_model_get_byte_order(image.macho->data_model); }
+{ return image.macho->byte_order; }
 
 //|++++++++++++++++++++++++++++++++++++|//
 bool mk_macho_is_64_bit(mk_macho_ref image)
@@ -160,27 +180,27 @@ mk_vm_address_t mk_macho_get_address(mk_macho_ref image)
 
 //|++++++++++++++++++++++++++++++++++++|//
 cpu_type_t mk_macho_get_cpu_type(mk_macho_ref image)
-{ return mk_macho_get_byte_order(image)->swap32( image.macho->header->cputype ); }
+{ return mk_byteorder_swap32(image.macho->byte_order, image.macho->header->cputype); }
 
 //|++++++++++++++++++++++++++++++++++++|//
 cpu_subtype_t mk_macho_get_cpu_subtype(mk_macho_ref image)
-{ return mk_macho_get_byte_order(image)->swap32( image.macho->header->cpusubtype ); }
+{ return mk_byteorder_swap32(image.macho->byte_order, image.macho->header->cpusubtype); }
 
 //|++++++++++++++++++++++++++++++++++++|//
 uint32_t mk_macho_get_filetype(mk_macho_ref image)
-{ return mk_macho_get_byte_order(image)->swap32( image.macho->header->filetype ); }
+{ return mk_byteorder_swap32(image.macho->byte_order, image.macho->header->filetype); }
 
 //|++++++++++++++++++++++++++++++++++++|//
 uint32_t mk_macho_get_ncmds(mk_macho_ref image)
-{ return mk_macho_get_byte_order(image)->swap32( image.macho->header->ncmds ); }
+{ return mk_byteorder_swap32(image.macho->byte_order, image.macho->header->ncmds); }
 
 //|++++++++++++++++++++++++++++++++++++|//
 uint32_t mk_macho_get_sizeofcmds(mk_macho_ref image)
-{ return mk_macho_get_byte_order(image)->swap32( image.macho->header->sizeofcmds ); }
+{ return mk_byteorder_swap32(image.macho->byte_order, image.macho->header->sizeofcmds); }
 
 //|++++++++++++++++++++++++++++++++++++|//
 uint32_t mk_macho_get_flags(mk_macho_ref image)
-{ return mk_macho_get_byte_order(image)->swap32( image.macho->header->flags ); }
+{ return mk_byteorder_swap32(image.macho->byte_order, image.macho->header->flags); }
 
 //|++++++++++++++++++++++++++++++++++++|//
 bool mk_macho_is_from_shared_cache(mk_macho_ref image)
@@ -191,8 +211,10 @@ bool mk_macho_is_from_shared_cache(mk_macho_ref image)
 //----------------------------------------------------------------------------//
 
 //|++++++++++++++++++++++++++++++++++++|//
-struct load_command*
-mk_macho_next_command(mk_macho_ref image, struct load_command* previous, mk_vm_address_t* host_address)
+//! Returns the load command following \a previous by walking the load
+//! commands, verifying each pointer against the header mapping.
+static struct load_command*
+__mk_macho_next_command_linear(mk_macho_t *image, struct load_command* previous, mk_vm_address_t* host_address)
 {
     struct load_command *cmd;
     
@@ -202,47 +224,47 @@ mk_macho_next_command(mk_macho_ref image, struct load_command* previous, mk_vm_a
             return NULL;
         
         // Sanity Check
-        if (mk_macho_get_byte_order(image)->swap32(image.macho->header->sizeofcmds) < sizeof(struct load_command)) {
-            _mkl_error(mk_type_get_context(image.macho), "Mach-O sizeofcmds is less than sizeof(struct load_command) in %s", image.macho->name);
+        if (mk_byteorder_swap32(image->byte_order, image->header->sizeofcmds) < sizeof(struct load_command)) {
+            _mkl_error(mk_type_get_context(image), "Mach-O sizeofcmds is less than sizeof(struct load_command) in %s", image->name);
             return NULL;
         }
         
-        cmd = (typeof(cmd))((uintptr_t)image.macho->header + image.macho->header_size);
+        cmd = (typeof(cmd))((uintptr_t)image->header + image->header_size);
     }
     else
     {
         // We need the size from the previous load command; first, verify the pointer.
         cmd = previous;
-        if (!mk_memory_object_verify_local_pointer(&image.macho->header_mapping, 0, (vm_address_t)cmd, sizeof(*cmd), NULL)) {
-            _mkl_error(mk_type_get_context(image.macho), "LC_CMD at address %p is not in: %s", cmd, image.macho->name);
+        if (!mk_memory_object_verify_local_pointer(&image->header_mapping, 0, (vm_address_t)cmd, sizeof(*cmd), NULL)) {
+            _mkl_error(mk_type_get_context(image), "LC_CMD at address %p is not in: %s", cmd, image->name);
             return NULL;
         }
         
         // Advance to the next command
-        uint32_t cmdsize = mk_macho_get_byte_order(image)->swap32(cmd->cmdsize);
+        uint32_t cmdsize = mk_byteorder_swap32(image->byte_order, cmd->cmdsize);
         cmd = (typeof(cmd))( ((uintptr_t)previous) + cmdsize );
     }
     
     // Avoid walking off the end of the cmd buffer
-    if ((uintptr_t)cmd >= mk_memory_object_address(&image.macho->header_mapping) + image.macho->header_size + mk_macho_get_sizeofcmds(image))
+    if ((uintptr_t)cmd >= mk_memory_object_address(&image->header_mapping) + image->header_size + mk_macho_get_sizeofcmds(image))
         return NULL;
     
     // Verify that the header mapping holds at least the new load_command
-    if (!mk_memory_object_verify_local_pointer(&image.macho->header_mapping, 0, (vm_address_t)cmd, sizeof(*cmd), NULL)) {
-        _mkl_error(mk_type_get_context(image.macho), "Failed to map LC_CMD at address %p in: %s", cmd, image.macho->name);
+    if (!mk_memory_object_verify_local_pointer(&image->header_mapping, 0, (vm_address_t)cmd, sizeof(*cmd), NULL)) {
+        _mkl_error(mk_type_get_context(image), "Failed to map LC_CMD at address %p in: %s", cmd, image->name);
         return NULL;
     }
     
     // Verify that the actual size
-    if (!mk_memory_object_verify_local_pointer(&image.macho->header_mapping, 0, (vm_address_t)cmd, mk_macho_get_byte_order(image)->swap32(cmd->cmdsize), NULL)) {
-        _mkl_error(mk_type_get_context(image.macho), "Failed to map LC_CMD at address %p in: %s", cmd, image.macho->name);
+    if (!mk_memory_object_verify_local_pointer(&image->header_mapping, 0, (vm_address_t)cmd, mk_byteorder_swap32(image->byte_order, cmd->cmdsize), NULL)) {
+        _mkl_error(mk_type_get_context(image), "Failed to map LC_CMD at address %p in: %s", cmd, image->name);
         return NULL;
     }
     
     if (host_address)
     {
         mk_error_t err;
-        *host_address = mk_memory_object_unmap_address(&image.macho->header_mapping, 0, (vm_address_t)cmd, sizeof(*cmd), &err);
+        *host_address = mk_memory_object_unmap_address(&image->header_mapping, 0, (vm_address_t)cmd, sizeof(*cmd), &err);
         if (err != MK_ESUCCESS)
             return NULL;
     }
@@ -250,6 +272,141 @@ mk_macho_next_command(mk_macho_ref image, struct load_command* previous, mk_vm_a
     return cmd;
 }
 
+//|++++++++++++++++++++++++++++++++++++|//
+//! Records the offset, cmd and cmdsize of each load command in \a image.
+//! The load commands are verified once, here, rather than on every step of
+//! an enumeration.
+static void
+__mk_macho_build_load_command_index(mk_macho_t *image)
+{
+    mk_context_t *ctx = mk_type_get_context(image);
+    uint16_t tails[MK_MACHO_LOAD_COMMAND_INDEX_BUCKETS];
+    struct load_command *cmd = NULL;
+    uint32_t capacity = 0;
+    uint32_t count = 0;
+    
+    for (size_t i = 0; i < MK_MACHO_LOAD_COMMAND_INDEX_BUCKETS; i++)
+        image->load_command_buckets[i] = tails[i] = UINT16_MAX;
+    
+    image->load_command_index_valid = false;
+    image->load_command_count = 0;
+    image->load_commands = NULL;
+    
+    // Size the index from the load commands that are actually present,
+    // rather than from ncmds.
+    while ((cmd = __mk_macho_next_command_linear(image, cmd, NULL)))
+    {
+        if (++capacity > MK_MACHO_LOAD_COMMAND_INDEX_CAPACITY) {
+            _mkl_inform(ctx, "%s has more than %i load commands.  Load commands will not be indexed.", image->name, MK_MACHO_LOAD_COMMAND_INDEX_CAPACITY);
+            return;
+        }
+        
+        // The walk would not advance past this command.
+        if (mk_byteorder_swap32(image->byte_order, cmd->cmdsize) < sizeof(struct load_command))
+            break;
+    }
+    
+    // Owned by the image, and released by mk_macho_free().
+    image->load_commands = calloc(capacity ?: 1, sizeof(*image->load_commands));
+    if (image->load_commands == NULL) {
+        _mkl_inform(ctx, "Could not allocate an index for the %" PRIu32 " load commands of %s.  Load commands will not be indexed.", capacity, image->name);
+        return;
+    }
+    
+    cmd = NULL;
+    while (count < capacity && (cmd = __mk_macho_next_command_linear(image, cmd, NULL)))
+    {
+        mk_macho_load_command_index_entry_t *entry = &image->load_commands[count];
+        entry->offset = (uint32_t)((uintptr_t)cmd - (uintptr_t)image->header);
+        entry->cmd = mk_byteorder_swap32(image->byte_order, cmd->cmd);
+        entry->cmdsize = mk_byteorder_swap32(image->byte_order, cmd->cmdsize);
+        entry->next = UINT16_MAX;
+        
+        uint32_t bucket = entry->cmd & (MK_MACHO_LOAD_COMMAND_INDEX_BUCKETS - 1);
+        if (tails[bucket] == UINT16_MAX)
+            image->load_command_buckets[bucket] = (uint16_t)count;
+        else
+            image->load_commands[tails[bucket]].next = (uint16_t)count;
+        tails[bucket] = (uint16_t)count;
+        
+        count++;
+        
+        // The walk would not advance past this command.
+        if (entry->cmdsize < sizeof(struct load_command)) {
+            _mkl_error(ctx, "LC_CMD at offset %" PRIu32 " in %s has an invalid size: %" PRIu32 "", entry->offset, image->name, entry->cmdsize);
+            break;
+        }
+    }
+    
+    image->load_command_count = count;
+    image->load_command_index_valid = true;
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+//! Locates the index entry for \a cmd, which must point to the start of a
+//! load command in \a image.
+static bool
+__mk_macho_find_load_command_index(mk_macho_t *image, struct load_command *cmd, uint32_t *index)
+{
+    if ((uintptr_t)cmd < (uintptr_t)image->header)
+        return false;
+    
+    uintptr_t offset = (uintptr_t)cmd - (uintptr_t)image->header;
+    uint32_t low = 0, high = image->load_command_count;
+    
+    // The entries are sorted by offset.
+    while (low < high) {
+        uint32_t mid = low + (high - low) / 2;
+        if (image->load_commands[mid].offset < offset)
+            low = mid + 1;
+        else
+            high = mid;
+    }
+    
+    if (low >= image->load_command_count || image->load_commands[low].offset != offset)
+        return false;
+    
+    *index = low;
+    return true;
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+static struct load_command*
+__mk_macho_load_command_at_index(mk_macho_t *image, uint32_t index, mk_vm_address_t* host_address)
+{
+    uint32_t offset = image->load_commands[index].offset;
+    
+    // The header is at the start of the header mapping.  This was verified
+    // by mk_macho_init().
+    if (host_address)
+        *host_address = mk_memory_object_host_address(&image->header_mapping) + offset;
+    
+    return (struct load_command*)((uintptr_t)image->header + offset);
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+struct load_command*
+mk_macho_next_command(mk_macho_ref image, struct load_command* previous, mk_vm_address_t* host_address)
+{
+    uint32_t index = 0;
+    
+    if (!image.macho->load_command_index_valid)
+        return __mk_macho_next_command_linear(image.macho, previous, host_address);
+    
+    if (previous) {
+        // A pointer that is not the start of an indexed load command is
+        // handled by the walker, which performs the full verification.
+        if (!__mk_macho_find_load_command_index(image.macho, previous, &index))
+            return __mk_macho_next_command_linear(image.macho, previous, host_address);
+        index++;
+    }
+    
+    if (index >= image.macho->load_command_count)
+        return NULL;
+    
+    return __mk_macho_load_command_at_index(image.macho, index, host_address);
+}
+
 //|++++++++++++++++++++++++++++++++++++|//
 #if __BLOCKS__
 void mk_macho_enumerate_commands(mk_macho_ref image, void (^enumerator)(struct load_command* command, uint32_t index, mk_vm_address_t host_address))
@@ -269,11 +426,26 @@ struct load_command*
 mk_macho_next_command_type(mk_macho_ref image, struct load_command* previous, uint32_t expected_command, mk_vm_address_t* host_address)
 {
     struct load_command *cmd = previous;
+    uint32_t start = 0;
+    
+    if (image.macho->load_command_index_valid && (previous == NULL || __mk_macho_find_load_command_index(image.macho, previous, &start)))
+    {
+        if (previous)
+            start++;
+        
+        uint16_t i = image.macho->load_command_buckets[expected_command & (MK_MACHO_LOAD_COMMAND_INDEX_BUCKETS - 1)];
+        for (; i != UINT16_MAX; i = image.macho->load_commands[i].next) {
+            if (i >= start && image.macho->load_commands[i].cmd == expected_command)
+                return __mk_macho_load_command_at_index(image.macho, i, host_address);
+        }
+        
+        return NULL;
+    }
     
     // Iterate commands until we either find a match, or reach the end
     while ((cmd = mk_macho_next_command(image, cmd, host_address)) != NULL) {
         // Return a match
-        if (mk_macho_get_byte_order(image)->swap32(cmd->cmd) == expected_command) {
+        if (mk_byteorder_swap32(image.macho->byte_order, cmd->cmd) == expected_command) {
             return cmd;
         }
     }
@@ -286,3 +458,230 @@ mk_macho_next_command_type(mk_macho_ref image, struct load_command* previous, ui
 struct load_command* mk_macho_find_command(mk_macho_ref image, uint32_t expected_command, mk_vm_address_t* host_address)
 { return mk_macho_next_command_type(image, NULL, expected_command, host_address); }
 
+
+//----------------------------------------------------------------------------//
+#pragma mark -  Looking Up Sections
+//----------------------------------------------------------------------------//
+
+//◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
+// Position of a walk through the sections of the segment load commands.
+typedef struct {
+    struct load_command *segment;
+    uint32_t nsects;
+    uint32_t index;
+    uint32_t n_sect;
+    // Whether malformed segment load commands are logged.  They are logged
+    // once, when the section table is built.
+    bool verbose;
+} __mk_macho_section_cursor_t;
+
+//|++++++++++++++++++++++++++++++++++++|//
+//! Reads the next section of the segment load commands of \a image into
+//! \a entry.  The section structures are validated against the size of
+//! their segment load command.  Stops after the
+//! \ref MK_MACHO_SECTION_TABLE_CAPACITY sections a symbol can reference.
+static bool
+__mk_macho_next_section(mk_macho_t *image, __mk_macho_section_cursor_t *cursor, mk_macho_section_entry_t *entry)
+{
+    const mk_byteorder_t *byte_order = image->byte_order;
+    bool is_64_bit = mk_macho_is_64_bit(image);
+    size_t segment_size = is_64_bit ? sizeof(struct segment_command_64) : sizeof(struct segment_command);
+    size_t section_size = is_64_bit ? sizeof(struct section_64) : sizeof(struct section);
+    
+    if (cursor->n_sect >= MK_MACHO_SECTION_TABLE_CAPACITY) {
+        if (cursor->verbose && (cursor->index < cursor->nsects || mk_macho_next_command_type(image, cursor->segment, is_64_bit ? LC_SEGMENT_64 : LC_SEGMENT, NULL)))
+            _mkl_debug(mk_type_get_context(image), "%s has more than %i sections.  The remaining sections will not be recorded.", image->name, MK_MACHO_SECTION_TABLE_CAPACITY);
+        return false;
+    }
+    
+    while (cursor->segment == NULL || cursor->index >= cursor->nsects)
+    {
+        cursor->segment = mk_macho_next_command_type(image, cursor->segment, is_64_bit ? LC_SEGMENT_64 : LC_SEGMENT, NULL);
+        cursor->nsects = 0;
+        cursor->index = 0;
+        
+        if (cursor->segment == NULL)
+            return false;
+        
+        uint32_t cmdsize = mk_byteorder_swap32(byte_order, cursor->segment->cmdsize);
+        if (cmdsize < segment_size) {
+            if (cursor->verbose)
+                _mkl_error(mk_type_get_context(image), "Segment load command in %s is smaller than a segment command.", image->name);
+            continue;
+        }
+        
+        cursor->nsects = is_64_bit ? mk_byteorder_swap32(byte_order, ((struct segment_command_64*)cursor->segment)->nsects) : mk_byteorder_swap32(byte_order, ((struct segment_command*)cursor->segment)->nsects);
+        if (cursor->nsects > (cmdsize - segment_size) / section_size) {
+            if (cursor->verbose)
+                _mkl_error(mk_type_get_context(image), "The %" PRIu32 " sections of a segment load command in %s do not fit in the load command.", cursor->nsects, image->name);
+            cursor->nsects = (uint32_t)((cmdsize - segment_size) / section_size);
+        }
+    }
+    
+    uintptr_t sect = (uintptr_t)cursor->segment + segment_size + cursor->index * section_size;
+    
+    if (is_64_bit) {
+        struct section_64 *section = (struct section_64*)sect;
+        entry->addr = mk_byteorder_swap64(byte_order, section->addr);
+        entry->size = mk_byteorder_swap64(byte_order, section->size);
+        entry->offset = mk_byteorder_swap32(byte_order, section->offset);
+        entry->flags = mk_byteorder_swap32(byte_order, section->flags);
+    } else {
+        struct section *section = (struct section*)sect;
+        entry->addr = mk_byteorder_swap32(byte_order, section->addr);
+        entry->size = mk_byteorder_swap32(byte_order, section->size);
+        entry->offset = mk_byteorder_swap32(byte_order, section->offset);
+        entry->flags = mk_byteorder_swap32(byte_order, section->flags);
+    }
+    
+    entry->segment_offset = (uint32_t)((uintptr_t)cursor->segment - (uintptr_t)image->header);
+    entry->section_offset = (uint32_t)(sect - (uintptr_t)image->header);
+    
+    cursor->index++;
+    cursor->n_sect++;
+    return true;
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+//! Records the sections of each segment load command in \a image, in
+//! storage owned by the image.
+static void
+__mk_macho_build_section_table(mk_macho_t *image)
+{
+    mk_context_t *ctx = mk_type_get_context(image);
+    __mk_macho_section_cursor_t cursor = { .verbose = true };
+    mk_macho_section_entry_t entry;
+    uint32_t count = 0;
+    
+    image->section_count = 0;
+    image->sections = NULL;
+    image->sections_by_address = NULL;
+    
+    while (__mk_macho_next_section(image, &cursor, &entry))
+        count++;
+    
+    image->section_count = count;
+    
+    // The table and its address ordering share one allocation, which is
+    // released by mk_macho_free().  count is at most MAX_SECT.
+    image->sections = calloc(1, (count ?: 1) * (sizeof(mk_macho_section_entry_t) + sizeof(uint8_t)));
+    if (image->sections == NULL) {
+        _mkl_inform(ctx, "Could not allocate a table for the %" PRIu32 " sections of %s.  Sections will be located by walking the segment load commands.", count, image->name);
+        return;
+    }
+    image->sections_by_address = (uint8_t*)(image->sections + (count ?: 1));
+    
+    cursor = (__mk_macho_section_cursor_t){ .verbose = false };
+    for (uint32_t i = 0; i < count; i++)
+        __mk_macho_next_section(image, &cursor, &image->sections[i]);
+    
+    // Sections are almost always laid out in address order, so an insertion
+    // sort finishes in a single pass.
+    for (uint32_t i = 0; i < count; i++)
+    {
+        uint8_t index = (uint8_t)i;
+        uint32_t j = i;
+        
+        while (j > 0 && image->sections[image->sections_by_address[j - 1]].addr > image->sections[index].addr) {
+            image->sections_by_address[j] = image->sections_by_address[j - 1];
+            j--;
+        }
+        
+        image->sections_by_address[j] = index;
+    }
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+uint32_t
+mk_macho_get_section_count(mk_macho_ref image)
+{ return image.macho->section_count; }
+
+//|++++++++++++++++++++++++++++++++++++|//
+mk_error_t
+mk_macho_get_section(mk_macho_ref image, uint32_t n_sect, mk_macho_section_entry_t *entry)
+{
+    if (entry == NULL) return MK_EINVAL;
+    
+    if (n_sect == NO_SECT || n_sect > image.macho->section_count)
+        return MK_ENOT_FOUND;
+    
+    if (image.macho->sections) {
+        *entry = image.macho->sections[n_sect - 1];
+        return MK_ESUCCESS;
+    }
+    
+    __mk_macho_section_cursor_t cursor = { .verbose = false };
+    while (__mk_macho_next_section(image.macho, &cursor, entry)) {
+        if (cursor.n_sect == n_sect)
+            return MK_ESUCCESS;
+    }
+    
+    return MK_ENOT_FOUND;
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+mk_error_t
+mk_macho_find_section_for_address(mk_macho_ref image, mk_vm_address_t address, mk_macho_section_entry_t *entry, uint32_t *n_sect)
+{
+    const mk_macho_t *macho = image.macho;
+    
+    if (entry == NULL) return MK_EINVAL;
+    
+    if (macho->sections == NULL)
+    {
+        // Select the same section as the table would: the last non-empty
+        // section, in address and then load command order, which starts at
+        // or before address.
+        __mk_macho_section_cursor_t cursor = { .verbose = false };
+        mk_macho_section_entry_t candidate;
+        uint32_t found = NO_SECT;
+        
+        while (__mk_macho_next_section(image.macho, &cursor, &candidate)) {
+            if (candidate.size == 0 || candidate.addr > address)
+                continue;
+            if (found == NO_SECT || candidate.addr >= entry->addr) {
+                *entry = candidate;
+                found = cursor.n_sect;
+            }
+        }
+        
+        if (found == NO_SECT || address - entry->addr >= entry->size)
+            return MK_ENOT_FOUND;
+        
+        if (n_sect)
+            *n_sect = found;
+        return MK_ESUCCESS;
+    }
+    
+    uint32_t low = 0, high = macho->section_count;
+    
+    // Find the first section which starts after address.
+    while (low < high) {
+        uint32_t mid = low + (high - low) / 2;
+        if (macho->sections[macho->sections_by_address[mid]].addr <= address)
+            low = mid + 1;
+        else
+            high = mid;
+    }
+    
+    // The candidate is the last non-empty section which starts at or before
+    // address.  Sections in a well-formed image do not overlap.
+    while (low > 0)
+    {
+        uint8_t index = macho->sections_by_address[--low];
+        const mk_macho_section_entry_t *candidate = &macho->sections[index];
+        
+        if (candidate->size == 0)
+            continue;
+        
+        if (address - candidate->addr >= candidate->size)
+            break;
+        
+        *entry = *candidate;
+        if (n_sect)
+            *n_sect = (uint32_t)index + 1;
+        return MK_ESUCCESS;
+    }
+    
+    return MK_ENOT_FOUND;
+}
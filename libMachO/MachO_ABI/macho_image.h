@@ -40,6 +40,53 @@
 //! @name       Types
 //----------------------------------------------------------------------------//
 
+//! The maximum number of load commands recorded in the load command index of
+//! a \ref mk_macho_t.  Load commands in images with more commands than this
+//! are located by walking the load commands.
+#define MK_MACHO_LOAD_COMMAND_INDEX_CAPACITY    (UINT16_MAX - 1)
+//! The number of per-command buckets in the load command index.  Must be a
+//! power of two.
+#define MK_MACHO_LOAD_COMMAND_INDEX_BUCKETS     64
+//! The maximum number of sections recorded in the section table of a
+//! \ref mk_macho_t.  This is the largest section number that can be encoded
+//! in the \c n_sect field of a symbol.
+#define MK_MACHO_SECTION_TABLE_CAPACITY         MAX_SECT
+
+//◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
+//! @internal
+//
+typedef struct {
+    // Offset of the load command from the start of the Mach-O header.
+    uint32_t offset;
+    // The load command's cmd, in host byte order.
+    uint32_t cmd;
+    // The load command's cmdsize, in host byte order.
+    uint32_t cmdsize;
+    // Index of the next entry in the same bucket, or UINT16_MAX.
+    uint16_t next;
+} mk_macho_load_command_index_entry_t;
+
+//◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
+//! An entry in the section table of a \ref mk_macho_t.  Values are in host
+//! byte order.
+//
+typedef struct {
+    //! The address of the section, not adjusted for the slide of the image.
+    mk_vm_address_t addr;
+    //! The size of the section, in bytes.
+    mk_vm_size_t size;
+    //! The file offset of the section.
+    uint32_t offset;
+    //! The section type and attributes.
+    uint32_t flags;
+    //! Offset of the owning segment load command from the start of the
+    //! Mach-O header.
+    uint32_t segment_offset;
+    //! Offset of the section or section_64 structure from the start of the
+    //! Mach-O header.
+    uint32_t section_offset;
+} mk_macho_section_entry_t;
+
 //◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
 //! @internal
 //
@@ -53,6 +100,9 @@ typedef struct mk_macho_s {
     mk_memory_map_ref memory_map;
     // See \ref mk_data_model
     mk_data_model_ref data_model;
+    // The byte order of data_model, resolved once at initialization so that
+    // accessors do not call through the data model on every read.
+    const mk_byteorder_t *byte_order;
     
     // The binary's dyld-reported reported vmaddr slide.  This will be zero
     // for binaries on disk.
@@ -71,6 +121,30 @@ typedef struct mk_macho_s {
     // header field above, as the above field does not include the full
     // mach_header_64 extensions to the mach_header.
     mk_vm_size_t header_size;
+    
+    // Index of the load commands, built and validated by mk_macho_init().
+    // The entries are owned by the image, one per load command, and are
+    // released by mk_macho_free().  If the entries can not be allocated, or
+    // the image has more than MK_MACHO_LOAD_COMMAND_INDEX_CAPACITY load
+    // commands, load_command_index_valid is false and the load commands are
+    // walked instead.
+    bool load_command_index_valid;
+    uint32_t load_command_count;
+    // Index of the first entry for each bucket, or UINT16_MAX.  The bucket
+    // for a command is (cmd & (MK_MACHO_LOAD_COMMAND_INDEX_BUCKETS - 1)).
+    uint16_t load_command_buckets[MK_MACHO_LOAD_COMMAND_INDEX_BUCKETS];
+    mk_macho_load_command_index_entry_t *load_commands;
+    
+    // Table of the sections, built by mk_macho_init().  Entry i describes
+    // the section numbered i + 1 by the n_sect field of a symbol.  The
+    // entries are owned by the image, one per section, and are released by
+    // mk_macho_free().  If the entries can not be allocated, sections is
+    // NULL and the segment load commands are walked on each lookup.
+    uint32_t section_count;
+    mk_macho_section_entry_t *sections;
+    // Indices into sections, ordered by address.  Shares the allocation of
+    // sections.
+    uint8_t *sections_by_address;
 } mk_macho_t;
 
     
@@ -91,6 +165,9 @@ _mk_export intptr_t mk_macho_image_type;
 //----------------------------------------------------------------------------//
 
 //! Initializes a new MachO image.
+//!
+//! The load commands and sections of the image are indexed once, in storage
+//! owned by the image, which is released by \ref mk_macho_free.
 _mk_export mk_error_t
 mk_macho_init(mk_context_t* ctx, const char* name, intptr_t slide, mk_vm_address_t header_addr,
               mk_memory_map_ref memory_map, mk_macho_t* image);
@@ -223,6 +300,38 @@ _mk_export struct load_command*
 mk_macho_find_command(mk_macho_ref image, uint32_t expected_command, mk_vm_address_t* host_address);
 
 
+//----------------------------------------------------------------------------//
+#pragma mark -  Looking Up Sections
+//! @name       Looking Up Sections
+//!
+//! The section table of an image is built once, by \ref mk_macho_init, in
+//! storage owned by the image.  It holds the first
+//! \ref MK_MACHO_SECTION_TABLE_CAPACITY sections in load command order,
+//! which are all the sections a symbol can reference.  Images without a
+//! section table walk their segment load commands on each lookup.
+//----------------------------------------------------------------------------//
+
+//! Returns the number of sections a symbol of \a image can reference.
+_mk_export uint32_t
+mk_macho_get_section_count(mk_macho_ref image);
+
+//! Copies the section table entry for the section numbered \a n_sect, as
+//! found in the \c n_sect field of a symbol, to \a entry.  Sections are
+//! numbered from \c 1.  Returns \ref MK_ENOT_FOUND for \c NO_SECT and
+//! numbers beyond the last section.
+_mk_export mk_error_t
+mk_macho_get_section(mk_macho_ref image, uint32_t n_sect, mk_macho_section_entry_t *entry);
+
+//! Copies the section table entry for the section containing the unslid
+//! \a address to \a entry.  Returns \ref MK_ENOT_FOUND if no section
+//! contains \a address.
+//!
+//! @param  n_sect [out]
+//!         If not \c NULL, set to the number of the returned section.
+_mk_export mk_error_t
+mk_macho_find_section_for_address(mk_macho_ref image, mk_vm_address_t address, mk_macho_section_entry_t *entry, uint32_t *n_sect);
+
+
 //! @} MACH !//
 
 #endif /* _macho_image_h */
@@ -0,0 +1,304 @@
+//----------------------------------------------------------------------------//
+//|
+//|             MachOKit - A Lightweight Mach-O Parsing Library
+//|             nlist_columns.c
+//|
+//|             D.V.
+//|             Copyright (c) 2014-2015 D.V. All rights reserved.
+//|
+//| Permission is hereby granted, free of charge, to any person obtaining a
+//| copy of this software and associated documentation files (the "Software"),
+//| to deal in the Software without restriction, including without limitation
+//| the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//| and/or sell copies of the Software, and to permit persons to whom the
+//| Software is furnished to do so, subject to the following conditions:
+//|
+//| The above copyright notice and this permission notice shall be included
+//| in all copies or substantial portions of the Software.
+//|
+//| THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+//| OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+//| MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+//| IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+//| CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+//| TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//| SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//----------------------------------------------------------------------------//
+
+#include "macho_abi_internal.h"
+
+#if defined(__SSSE3__)
+#   include <tmmintrin.h>
+#   define MK_NLIST_COLUMNS_SSSE3 1
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#   include <arm_neon.h>
+#   define MK_NLIST_COLUMNS_NEON 1
+#endif
+
+//----------------------------------------------------------------------------//
+#pragma mark -  Shuffles
+//----------------------------------------------------------------------------//
+
+#if MK_NLIST_COLUMNS_SSSE3 || MK_NLIST_COLUMNS_NEON
+
+// Each kernel loads one nlist(_64) structure into the low bytes of a
+// 16 byte vector.  The first shuffle byte swaps the n_strx, n_desc and
+// n_value fields in place.  For a 32-bit nlist, the upper four bytes of the
+// vector belong to the next structure and are ignored.
+static const uint8_t __mk_nlist_64_swap[16] = { 3, 2, 1, 0, 4, 5, 7, 6, 15, 14, 13, 12, 11, 10, 9, 8 };
+static const uint8_t __mk_nlist_swap[16]    = { 3, 2, 1, 0, 4, 5, 7, 6, 11, 10, 9, 8, 12, 13, 14, 15 };
+static const uint8_t __mk_nlist_direct[16]  = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 };
+
+// After the n_type, n_sect and n_desc fields of four structures have been
+// gathered into the 32-bit lanes of a vector, this shuffle moves the four
+// n_desc fields to bytes 0-7, the n_type fields to bytes 8-11 and the
+// n_sect fields to bytes 12-15.
+static const uint8_t __mk_nlist_split[16] = { 2, 3, 6, 7, 10, 11, 14, 15, 0, 4, 8, 12, 1, 5, 9, 13 };
+
+#endif
+
+//----------------------------------------------------------------------------//
+#pragma mark -  Kernels
+//----------------------------------------------------------------------------//
+
+//|++++++++++++++++++++++++++++++++++++|//
+static void
+__mk_nlist_columns_decode_scalar(const uint8_t *nlists, uint32_t start, uint32_t end, bool is_64_bit, const mk_byteorder_t *byte_order, mk_nlist_columns_t *columns)
+{
+    for (uint32_t i = start; i < end; i++)
+    {
+        if (is_64_bit) {
+            struct nlist_64 entry;
+            memcpy(&entry, nlists + (size_t)i * sizeof(entry), sizeof(entry));
+            
+            columns->strx[i] = mk_byteorder_swap32(byte_order, entry.n_un.n_strx);
+            columns->type[i] = entry.n_type;
+            columns->sect[i] = entry.n_sect;
+            columns->desc[i] = mk_byteorder_swap16(byte_order, entry.n_desc);
+            columns->value[i] = mk_byteorder_swap64(byte_order, entry.n_value);
+        } else {
+            struct nlist entry;
+            memcpy(&entry, nlists + (size_t)i * sizeof(entry), sizeof(entry));
+            
+            columns->strx[i] = mk_byteorder_swap32(byte_order, entry.n_un.n_strx);
+            columns->type[i] = entry.n_type;
+            columns->sect[i] = entry.n_sect;
+            columns->desc[i] = mk_byteorder_swap16(byte_order, (uint16_t)entry.n_desc);
+            columns->value[i] = mk_byteorder_swap32(byte_order, entry.n_value);
+        }
+    }
+}
+
+#if MK_NLIST_COLUMNS_SSSE3
+
+//|++++++++++++++++++++++++++++++++++++|//
+//! Decodes the structures in [0, end), four at a time, and returns the
+//! index of the first structure that was not decoded.
+static uint32_t
+__mk_nlist_columns_decode_vector(const uint8_t *nlists, uint32_t end, bool is_64_bit, bool swap, mk_nlist_columns_t *columns)
+{
+    const size_t stride = is_64_bit ? sizeof(struct nlist_64) : sizeof(struct nlist);
+    const __m128i fields = _mm_loadu_si128((const __m128i*)(swap ? (is_64_bit ? __mk_nlist_64_swap : __mk_nlist_swap) : __mk_nlist_direct));
+    const __m128i split = _mm_loadu_si128((const __m128i*)__mk_nlist_split);
+    const __m128i zero = _mm_setzero_si128();
+    uint32_t i = 0;
+    
+    // A 16 byte load of a 32-bit nlist reads four bytes of the following
+    // structure.  Stop while there is still a following structure.
+    const uint32_t limit = is_64_bit ? end : (end > 0 ? end - 1 : 0);
+    
+    for (; limit >= 4 && i <= limit - 4; i += 4)
+    {
+        const uint8_t *p = nlists + (size_t)i * stride;
+        __m128i r0 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(p + 0 * stride)), fields);
+        __m128i r1 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(p + 1 * stride)), fields);
+        __m128i r2 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(p + 2 * stride)), fields);
+        __m128i r3 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(p + 3 * stride)), fields);
+        
+        // The first eight bytes of every structure hold n_strx, n_type,
+        // n_sect and n_desc.
+        __m128 lo01 = _mm_castsi128_ps(_mm_unpacklo_epi64(r0, r1));
+        __m128 lo23 = _mm_castsi128_ps(_mm_unpacklo_epi64(r2, r3));
+        __m128i strx = _mm_castps_si128(_mm_shuffle_ps(lo01, lo23, _MM_SHUFFLE(2, 0, 2, 0)));
+        __m128i rest = _mm_shuffle_epi8(_mm_castps_si128(_mm_shuffle_ps(lo01, lo23, _MM_SHUFFLE(3, 1, 3, 1))), split);
+        
+        _mm_storeu_si128((__m128i*)&columns->strx[i], strx);
+        _mm_storel_epi64((__m128i*)&columns->desc[i], rest);
+        uint32_t types = (uint32_t)_mm_cvtsi128_si32(_mm_srli_si128(rest, 8));
+        uint32_t sects = (uint32_t)_mm_cvtsi128_si32(_mm_srli_si128(rest, 12));
+        memcpy(&columns->type[i], &types, sizeof(types));
+        memcpy(&columns->sect[i], &sects, sizeof(sects));
+        
+        // The n_value field follows.
+        __m128i hi01 = _mm_unpackhi_epi64(r0, r1);
+        __m128i hi23 = _mm_unpackhi_epi64(r2, r3);
+        if (is_64_bit) {
+            _mm_storeu_si128((__m128i*)&columns->value[i + 0], hi01);
+            _mm_storeu_si128((__m128i*)&columns->value[i + 2], hi23);
+        } else {
+            __m128i values = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(hi01), _mm_castsi128_ps(hi23), _MM_SHUFFLE(2, 0, 2, 0)));
+            _mm_storeu_si128((__m128i*)&columns->value[i + 0], _mm_unpacklo_epi32(values, zero));
+            _mm_storeu_si128((__m128i*)&columns->value[i + 2], _mm_unpackhi_epi32(values, zero));
+        }
+    }
+    
+    return i;
+}
+
+#elif MK_NLIST_COLUMNS_NEON
+
+//|++++++++++++++++++++++++++++++++++++|//
+//! Decodes the structures in [0, end), four at a time, and returns the
+//! index of the first structure that was not decoded.
+static uint32_t
+__mk_nlist_columns_decode_vector(const uint8_t *nlists, uint32_t end, bool is_64_bit, bool swap, mk_nlist_columns_t *columns)
+{
+    const size_t stride = is_64_bit ? sizeof(struct nlist_64) : sizeof(struct nlist);
+    const uint8x16_t fields = vld1q_u8(swap ? (is_64_bit ? __mk_nlist_64_swap : __mk_nlist_swap) : __mk_nlist_direct);
+    const uint8x16_t split = vld1q_u8(__mk_nlist_split);
+    uint32_t i = 0;
+    
+    // A 16 byte load of a 32-bit nlist reads four bytes of the following
+    // structure.  Stop while there is still a following structure.
+    const uint32_t limit = is_64_bit ? end : (end > 0 ? end - 1 : 0);
+    
+    for (; limit >= 4 && i <= limit - 4; i += 4)
+    {
+        const uint8_t *p = nlists + (size_t)i * stride;
+        uint8x16_t r0 = vqtbl1q_u8(vld1q_u8(p + 0 * stride), fields);
+        uint8x16_t r1 = vqtbl1q_u8(vld1q_u8(p + 1 * stride), fields);
+        uint8x16_t r2 = vqtbl1q_u8(vld1q_u8(p + 2 * stride), fields);
+        uint8x16_t r3 = vqtbl1q_u8(vld1q_u8(p + 3 * stride), fields);
+        
+        // The first eight bytes of every structure hold n_strx, n_type,
+        // n_sect and n_desc.
+        uint32x4_t lo01 = vreinterpretq_u32_u8(vcombine_u8(vget_low_u8(r0), vget_low_u8(r1)));
+        uint32x4_t lo23 = vreinterpretq_u32_u8(vcombine_u8(vget_low_u8(r2), vget_low_u8(r3)));
+        uint8x16_t rest = vqtbl1q_u8(vreinterpretq_u8_u32(vuzp2q_u32(lo01, lo23)), split);
+        
+        vst1q_u32(&columns->strx[i], vuzp1q_u32(lo01, lo23));
+        vst1_u16(&columns->desc[i], vreinterpret_u16_u8(vget_low_u8(rest)));
+        vst1q_lane_u32((uint32_t*)(void*)&columns->type[i], vreinterpretq_u32_u8(rest), 2);
+        vst1q_lane_u32((uint32_t*)(void*)&columns->sect[i], vreinterpretq_u32_u8(rest), 3);
+        
+        // The n_value field follows.
+        uint8x16_t hi01 = vcombine_u8(vget_high_u8(r0), vget_high_u8(r1));
+        uint8x16_t hi23 = vcombine_u8(vget_high_u8(r2), vget_high_u8(r3));
+        if (is_64_bit) {
+            vst1q_u64(&columns->value[i + 0], vreinterpretq_u64_u8(hi01));
+            vst1q_u64(&columns->value[i + 2], vreinterpretq_u64_u8(hi23));
+        } else {
+            uint32x4_t values = vuzp1q_u32(vreinterpretq_u32_u8(hi01), vreinterpretq_u32_u8(hi23));
+            vst1q_u64(&columns->value[i + 0], vmovl_u32(vget_low_u32(values)));
+            vst1q_u64(&columns->value[i + 2], vmovl_high_u32(values));
+        }
+    }
+    
+    return i;
+}
+
+#endif
+
+//----------------------------------------------------------------------------//
+#pragma mark -  Decoding nlist Structures
+//----------------------------------------------------------------------------//
+
+//|++++++++++++++++++++++++++++++++++++|//
+size_t
+mk_nlist_columns_storage_size(uint32_t nlist_count)
+{
+    return (size_t)nlist_count * (sizeof(uint64_t) + sizeof(uint32_t) + sizeof(uint16_t) + 2 * sizeof(uint8_t));
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+mk_error_t
+mk_nlist_columns_init(const void *nlists, uint32_t nlist_count, bool is_64_bit, const mk_byteorder_t *byte_order, void *storage, size_t storage_size, mk_nlist_columns_t *columns)
+{
+    if (columns == NULL) return MK_EINVAL;
+    if (byte_order == NULL) return MK_EINVAL;
+    if (nlists == NULL && nlist_count > 0) return MK_EINVAL;
+    if (storage == NULL && nlist_count > 0) return MK_EINVAL;
+    if ((uintptr_t)storage % sizeof(uint64_t) != 0) return MK_EINVAL;
+    if (storage_size < mk_nlist_columns_storage_size(nlist_count)) return MK_EINVAL;
+    
+    // Widest column first, to keep every column aligned.
+    uint8_t *cursor = storage;
+    columns->count = nlist_count;
+    columns->value = (uint64_t*)(void*)cursor;
+    cursor += (size_t)nlist_count * sizeof(uint64_t);
+    columns->strx = (uint32_t*)(void*)cursor;
+    cursor += (size_t)nlist_count * sizeof(uint32_t);
+    columns->desc = (uint16_t*)(void*)cursor;
+    cursor += (size_t)nlist_count * sizeof(uint16_t);
+    columns->type = cursor;
+    cursor += nlist_count;
+    columns->sect = cursor;
+    
+    uint32_t decoded = 0;
+#if MK_NLIST_COLUMNS_SSSE3 || MK_NLIST_COLUMNS_NEON
+    // Byte orders other than these two go through the byte order's
+    // functions.
+    if (byte_order->kind == MK_BYTEORDER_DIRECT || byte_order->kind == MK_BYTEORDER_SWAPPED)
+        decoded = __mk_nlist_columns_decode_vector(nlists, nlist_count, is_64_bit, (byte_order->kind == MK_BYTEORDER_SWAPPED), columns);
+#endif
+    
+    __mk_nlist_columns_decode_scalar(nlists, decoded, nlist_count, is_64_bit, byte_order, columns);
+    
+    return MK_ESUCCESS;
+}
+
+//----------------------------------------------------------------------------//
+#pragma mark -  Selecting Symbols
+//----------------------------------------------------------------------------//
+
+//|++++++++++++++++++++++++++++++++++++|//
+uint32_t
+mk_nlist_columns_select_type(const mk_nlist_columns_t *columns, uint8_t mask, uint8_t value, uint32_t *indices, uint32_t capacity)
+{
+    uint32_t found = 0;
+    
+    for (uint32_t i = 0; i < columns->count; i++) {
+        if ((columns->type[i] & mask) != value)
+            continue;
+        if (found < capacity)
+            indices[found] = i;
+        found++;
+    }
+    
+    return found;
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+uint32_t
+mk_nlist_columns_select_section(const mk_nlist_columns_t *columns, uint8_t n_sect, uint32_t *indices, uint32_t capacity)
+{
+    uint32_t found = 0;
+    
+    for (uint32_t i = 0; i < columns->count; i++) {
+        if (columns->sect[i] != n_sect)
+            continue;
+        if (found < capacity)
+            indices[found] = i;
+        found++;
+    }
+    
+    return found;
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+uint32_t
+mk_nlist_columns_select_value(const mk_nlist_columns_t *columns, mk_vm_range_t range, uint32_t *indices, uint32_t capacity)
+{
+    uint32_t found = 0;
+    
+    for (uint32_t i = 0; i < columns->count; i++) {
+        // Wraps for values below the start of the range.
+        if (columns->value[i] - range.location >= range.length)
+            continue;
+        if (found < capacity)
+            indices[found] = i;
+        found++;
+    }
+    
+    return found;
+}
@@ -0,0 +1,120 @@
+//----------------------------------------------------------------------------//
+//|
+//|             MachOKit - A Lightweight Mach-O Parsing Library
+//! @file       nlist_columns.h
+//!
+//! @author     D.V.
+//! @copyright  Copyright (c) 2014-2015 D.V. All rights reserved.
+//|
+//| Permission is hereby granted, free of charge, to any person obtaining a
+//| copy of this software and associated documentation files (the "Software"),
+//| to deal in the Software without restriction, including without limitation
+//| the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//| and/or sell copies of the Software, and to permit persons to whom the
+//| Software is furnished to do so, subject to the following conditions:
+//|
+//| The above copyright notice and this permission notice shall be included
+//| in all copies or substantial portions of the Software.
+//|
+//| THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+//| OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+//| MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+//| IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+//| CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+//| TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//| SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//----------------------------------------------------------------------------//
+
+
+#ifndef _nlist_columns_h
+#define _nlist_columns_h
+
+//! @addtogroup MACH
+//! @{
+//!
+
+//----------------------------------------------------------------------------//
+#pragma mark -  Types
+//! @name       Types
+//----------------------------------------------------------------------------//
+
+//◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
+//! The fields of a run of nlist or nlist_64 structures, byte swapped and
+//! stored in one array per field.  The fields of the symbol at index \c i
+//! are at index \c i of each array.
+//
+typedef struct mk_nlist_columns_s {
+    //! Number of symbols.
+    uint32_t count;
+    //! The \c n_un.n_strx field of each symbol.
+    uint32_t *strx;
+    //! The \c n_type field of each symbol.
+    uint8_t *type;
+    //! The \c n_sect field of each symbol.
+    uint8_t *sect;
+    //! The \c n_desc field of each symbol.
+    uint16_t *desc;
+    //! The \c n_value field of each symbol, zero extended for nlist
+    //! structures.
+    uint64_t *value;
+} mk_nlist_columns_t;
+
+
+//----------------------------------------------------------------------------//
+#pragma mark -  Decoding nlist Structures
+//! @name       Decoding nlist Structures
+//!
+//! Symbol table consumers which filter by type, by section, or by address
+//! read one or two fields of every symbol.  Converting the symbol table to
+//! columns once lets them scan a dense array of the field instead of every
+//! 12 or 16 byte nlist structure.
+//!
+//! Where the target supports it, byte swapping is done with SSSE3 or NEON
+//! shuffles, several symbols at a time.
+//!
+//! Like the rest of libMachO, the columns do not allocate memory.  The
+//! caller provides a single buffer of at least
+//! \ref mk_nlist_columns_storage_size bytes, aligned to 8 bytes, which must
+//! remain valid for the lifetime of the columns.
+//----------------------------------------------------------------------------//
+
+//! Returns the size of the storage that must be provided to decode
+//! \a nlist_count symbols.
+_mk_export size_t
+mk_nlist_columns_storage_size(uint32_t nlist_count);
+
+//! Decodes \a nlist_count nlist, or nlist_64 if \a is_64_bit is \c true,
+//! structures starting at \a nlists into \a columns.  The structures are
+//! byte swapped according to \a byte_order.
+_mk_export mk_error_t
+mk_nlist_columns_init(const void *nlists, uint32_t nlist_count, bool is_64_bit, const mk_byteorder_t *byte_order, void *storage, size_t storage_size, mk_nlist_columns_t *columns);
+
+
+//----------------------------------------------------------------------------//
+#pragma mark -  Selecting Symbols
+//! @name       Selecting Symbols
+//!
+//! These functions write the index of each matching symbol, in order, to
+//! \a indices, and return the number of matching symbols.  At most
+//! \a capacity indices are written; a return value larger than \a capacity
+//! indicates that \a indices was too small.
+//----------------------------------------------------------------------------//
+
+//! Selects the symbols whose \c n_type field, masked with \a mask, is equal
+//! to \a value.  For example, a \a mask and \a value of \c N_EXT selects the
+//! external symbols.
+_mk_export uint32_t
+mk_nlist_columns_select_type(const mk_nlist_columns_t *columns, uint8_t mask, uint8_t value, uint32_t *indices, uint32_t capacity);
+
+//! Selects the symbols whose \c n_sect field is \a n_sect.
+_mk_export uint32_t
+mk_nlist_columns_select_section(const mk_nlist_columns_t *columns, uint8_t n_sect, uint32_t *indices, uint32_t capacity);
+
+//! Selects the symbols whose \c n_value field is within \a range.
+_mk_export uint32_t
+mk_nlist_columns_select_value(const mk_nlist_columns_t *columns, mk_vm_range_t range, uint32_t *indices, uint32_t capacity);
+
+
+//! @} MACH !//
+
+#endif /* _nlist_columns_h */
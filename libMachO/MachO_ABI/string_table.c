@@ -34,7 +34,7 @@
 //|++++++++++++++++++++++++++++++++++++|//
 static mk_context_t*
 __mk_string_table_get_context(mk_type_ref self)
-{ return mk_type_get_context( &((mk_string_table_t*)self)->link_edit ); }
+{ return mk_type_get_context( ((mk_string_table_t*)self)->link_edit.segment ); }
 
 const struct _mk_string_table_vtable _mk_string_table_class = {
     .base.super                 = &_mk_type_class,
@@ -70,7 +70,7 @@ mk_string_table_init(mk_segment_ref link_edit, mk_load_command_ref symtab_cmd, m
     
     // This already include the slide.
     if ((err = mk_vm_address_add(vm_address, stroff, &vm_address))) {
-        _mkl_error(mk_type_get_context(link_edit.segment), "Arithmetic error %s while adding offset (%" PRIi32 ") to __LINKEDIT vm_address (0x%" MK_VM_PRIxADDR ")", mk_error_string(err), stroff, vm_address);
+        _mkl_error_record(mk_type_get_context(link_edit.segment), MK_LOG_RECORD_OFFSET_OVERFLOW, err, vm_address, stroff, link_edit.segment);
         return err;
     }
     
@@ -86,7 +86,7 @@ mk_string_table_init(mk_segment_ref link_edit, mk_load_command_ref symtab_cmd, m
     
     // Make sure we are fully within the link_edit segment
     if ((err = mk_vm_range_contains_range(mk_segment_get_range(link_edit), string_table->range, false))) {
-        _mkl_error(mk_type_get_context(link_edit.segment), "__LINKEDIT segment does not fully contain the string table.");
+        _mkl_error_record(mk_type_get_context(link_edit.segment), MK_LOG_RECORD_RANGE_NOT_WITHIN, err, string_table->range.location, string_table->range.length, link_edit.segment);
         return err;
     }
     
@@ -209,13 +209,13 @@ mk_string_table_next_string(mk_string_table_ref string_table, const char* previo
     mk_vm_size_t len;
     mk_vm_address_t addr = mk_memory_object_unmap_address(mk_segment_get_mobj(string_table.string_table->link_edit), 0, (vm_address_t)previous, 1, NULL);
     if (addr == MK_VM_ADDRESS_INVALID) {
-        _mkl_error(mk_type_get_context(string_table.string_table), "Previous value %p is not within <mk_string_table %p>", previous, string_table.string_table);
+        _mkl_error_record(mk_type_get_context(string_table.string_table), MK_LOG_RECORD_RANGE_NOT_WITHIN, MK_EOUT_OF_RANGE, (uintptr_t)previous, 1, string_table.string_table);
         return NULL;
     }
     
     // Verify that addr is within the string table.
     if (mk_vm_range_contains_address(string_table.string_table->range, 0, addr)) {
-        _mkl_error(mk_type_get_context(string_table.string_table), "Previous value %p is not within <mk_string_table %p>", previous, string_table.string_table);
+        _mkl_error_record(mk_type_get_context(string_table.string_table), MK_LOG_RECORD_RANGE_NOT_WITHIN, MK_EOUT_OF_RANGE, (uintptr_t)previous, 1, string_table.string_table);
         return NULL;
     }
     
@@ -0,0 +1,318 @@
+//----------------------------------------------------------------------------//
+//|
+//|             MachOKit - A Lightweight Mach-O Parsing Library
+//|             symbol_address_index.c
+//|
+//|             D.V.
+//|             Copyright (c) 2014-2015 D.V. All rights reserved.
+//|
+//| Permission is hereby granted, free of charge, to any person obtaining a
+//| copy of this software and associated documentation files (the "Software"),
+//| to deal in the Software without restriction, including without limitation
+//| the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//| and/or sell copies of the Software, and to permit persons to whom the
+//| Software is furnished to do so, subject to the following conditions:
+//|
+//| The above copyright notice and this permission notice shall be included
+//| in all copies or substantial portions of the Software.
+//|
+//| THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+//| OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+//| MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+//| IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+//| CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+//| TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//| SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//----------------------------------------------------------------------------//
+
+
+#include "macho_abi_internal.h"
+
+//----------------------------------------------------------------------------//
+#pragma mark -  Classes
+//----------------------------------------------------------------------------//
+
+//|++++++++++++++++++++++++++++++++++++|//
+static mk_context_t*
+__mk_symbol_address_index_get_context(mk_type_ref self)
+{
+    mk_symbol_table_ref symbol_table = ((mk_symbol_address_index_t*)self)->symbol_table;
+    return symbol_table.symbol_table ? mk_type_get_context(symbol_table.symbol_table) : NULL;
+}
+
+const struct _mk_symbol_address_index_vtable _mk_symbol_address_index_class = {
+    .base.super                 = &_mk_type_class,
+    .base.name                  = "symbol address index",
+    .base.get_context           = &__mk_symbol_address_index_get_context
+};
+
+intptr_t mk_symbol_address_index_type = (intptr_t)&_mk_symbol_address_index_class;
+
+//----------------------------------------------------------------------------//
+#pragma mark -  Sorting
+//----------------------------------------------------------------------------//
+
+//|++++++++++++++++++++++++++++++++++++|//
+static inline uint8_t
+__mk_symbol_address_index_get_type(mk_symbol_address_index_t *self, uint32_t index)
+{
+    // n_type immediately follows n_strx in both nlist and nlist_64.
+    return ((const uint8_t*)self->nlists)[(size_t)index * self->nlist_size + sizeof(uint32_t)];
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+//! Orders by address, then external symbols before non-external symbols,
+//! then by position in the symbol table.
+static inline bool
+__mk_symbol_address_index_less(mk_symbol_address_index_t *self, uint32_t lhs, uint32_t rhs)
+{
+    if (self->addresses[lhs] != self->addresses[rhs])
+        return self->addresses[lhs] < self->addresses[rhs];
+    
+    // The size field holds the N_EXT bit of the symbol while sorting.
+    if (self->entries[lhs].size != self->entries[rhs].size)
+        return self->entries[lhs].size > self->entries[rhs].size;
+    
+    return self->entries[lhs].symbol_index < self->entries[rhs].symbol_index;
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+static inline void
+__mk_symbol_address_index_swap(mk_symbol_address_index_t *self, uint32_t lhs, uint32_t rhs)
+{
+    mk_vm_address_t address = self->addresses[lhs];
+    self->addresses[lhs] = self->addresses[rhs];
+    self->addresses[rhs] = address;
+    
+    mk_symbol_address_index_entry_t entry = self->entries[lhs];
+    self->entries[lhs] = self->entries[rhs];
+    self->entries[rhs] = entry;
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+static void
+__mk_symbol_address_index_sift_down(mk_symbol_address_index_t *self, uint32_t root, uint32_t count)
+{
+    while (2 * (uint64_t)root + 1 < count) {
+        uint32_t child = 2 * root + 1;
+        if (child + 1 < count && __mk_symbol_address_index_less(self, child, child + 1))
+            child++;
+        if (!__mk_symbol_address_index_less(self, root, child))
+            return;
+        
+        __mk_symbol_address_index_swap(self, root, child);
+        root = child;
+    }
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+//! Heap sort, which sorts in place and without recursion.
+static void
+__mk_symbol_address_index_sort(mk_symbol_address_index_t *self)
+{
+    uint32_t count = self->count;
+    if (count < 2)
+        return;
+    
+    for (uint32_t i = count / 2; i-- > 0; )
+        __mk_symbol_address_index_sift_down(self, i, count);
+    
+    for (uint32_t end = count - 1; end > 0; end--) {
+        __mk_symbol_address_index_swap(self, 0, end);
+        __mk_symbol_address_index_sift_down(self, 0, end);
+    }
+}
+
+//----------------------------------------------------------------------------//
+#pragma mark -  Working With The Symbol Address Index
+//----------------------------------------------------------------------------//
+
+//|++++++++++++++++++++++++++++++++++++|//
+size_t
+mk_symbol_address_index_storage_size(uint32_t symbol_count)
+{ return (size_t)symbol_count * (sizeof(mk_vm_address_t) + sizeof(mk_symbol_address_index_entry_t)); }
+
+//|++++++++++++++++++++++++++++++++++++|//
+mk_error_t
+mk_symbol_address_index_init_with_nlists(const void *nlists, uint32_t nlist_count, bool is_64_bit, const mk_byteorder_t *byte_order, mk_vm_offset_t slide, const mk_vm_range_t *sections, uint32_t section_count, void *storage, size_t storage_size, mk_symbol_address_index_t *symbol_address_index)
+{
+    if (symbol_address_index == NULL) return MK_EINVAL;
+    if (nlists == NULL && nlist_count > 0) return MK_EINVAL;
+    if (byte_order == NULL) return MK_EINVAL;
+    if (storage == NULL && nlist_count > 0) return MK_EINVAL;
+    if ((uintptr_t)storage % __alignof__(mk_vm_address_t)) return MK_EINVAL;
+    if (storage_size < mk_symbol_address_index_storage_size(nlist_count)) return MK_EINVAL;
+    
+    mk_symbol_address_index_t *self = symbol_address_index;
+    
+    self->symbol_table.symbol_table = NULL;
+    self->nlists = nlists;
+    self->nlist_size = (uint32_t)(is_64_bit ? sizeof(struct nlist_64) : sizeof(struct nlist));
+    self->count = 0;
+    self->addresses = (mk_vm_address_t*)storage;
+    self->entries = (mk_symbol_address_index_entry_t*)(self->addresses + nlist_count);
+    
+    for (uint32_t index = 0; index < nlist_count; index++)
+    {
+        const uint8_t *nlist = (const uint8_t*)nlists + (size_t)index * self->nlist_size;
+        uint8_t type = nlist[offsetof(struct nlist, n_type)];
+        
+        if ((type & N_STAB) || (type & N_TYPE) != N_SECT)
+            continue;
+        
+        uint64_t value;
+        if (is_64_bit) {
+            uint64_t value64;
+            __builtin_memcpy(&value64, nlist + offsetof(struct nlist_64, n_value), sizeof(value64));
+            value = mk_byteorder_swap64(byte_order, value64);
+        } else {
+            uint32_t value32;
+            __builtin_memcpy(&value32, nlist + offsetof(struct nlist, n_value), sizeof(value32));
+            value = mk_byteorder_swap32(byte_order, value32);
+        }
+        
+        mk_vm_address_t address;
+        if (mk_vm_address_apply_offset(value, slide, &address))
+            continue;
+        
+        self->addresses[self->count] = address;
+        self->entries[self->count].symbol_index = index;
+        self->entries[self->count].size = (type & N_EXT) ? 1 : 0;
+        self->count++;
+    }
+    
+    __mk_symbol_address_index_sort(self);
+    
+    // Keep one symbol per address, then infer the size of each symbol from
+    // the start of the next.
+    uint32_t unique = 0;
+    for (uint32_t i = 0; i < self->count; i++) {
+        if (unique > 0 && self->addresses[unique - 1] == self->addresses[i])
+            continue;
+        self->addresses[unique] = self->addresses[i];
+        self->entries[unique] = self->entries[i];
+        unique++;
+    }
+    self->count = unique;
+    
+    for (uint32_t i = 0; i < self->count; i++)
+    {
+        mk_vm_address_t start = self->addresses[i];
+        mk_vm_address_t end = (i + 1 < self->count) ? self->addresses[i + 1] : start;
+        
+        if (sections) {
+            const uint8_t *nlist = (const uint8_t*)nlists + (size_t)self->entries[i].symbol_index * self->nlist_size;
+            uint8_t sect = nlist[offsetof(struct nlist, n_sect)];
+            
+            if (sect != NO_SECT && sect <= section_count) {
+                mk_vm_range_t section = sections[sect - 1];
+                if (mk_vm_range_contains_address(section, 0, start) == MK_ESUCCESS) {
+                    mk_vm_address_t section_end = section.location + section.length;
+                    if (i + 1 == self->count || section_end < end)
+                        end = section_end;
+                }
+            }
+        }
+        
+        mk_vm_size_t size = end - start;
+        self->entries[i].size = (size > UINT32_MAX) ? UINT32_MAX : (uint32_t)size;
+    }
+    
+    self->vtable = &_mk_symbol_address_index_class;
+    return MK_ESUCCESS;
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+mk_error_t
+mk_symbol_address_index_init(mk_symbol_table_ref symbol_table, void *storage, size_t storage_size, mk_symbol_address_index_t *symbol_address_index)
+{
+    if (symbol_table.symbol_table == NULL) return MK_EINVAL;
+    if (symbol_address_index == NULL) return MK_EINVAL;
+    
+    mk_macho_ref image = mk_symbol_table_get_macho(symbol_table);
+    mk_context_t *context = mk_type_get_context(symbol_table.symbol_table);
+    bool is_64_bit = mk_macho_is_64_bit(image);
+    uint32_t symbol_count = mk_symbol_table_get_count(symbol_table);
+    mk_error_t err = MK_ESUCCESS;
+    
+    // Map the symbols once.
+    const void *nlists = NULL;
+    if (symbol_count > 0) {
+        mk_vm_range_t range = mk_symbol_table_get_range(symbol_table);
+        vm_address_t address = mk_memory_object_remap_address(mk_segment_get_mobj(mk_symbol_table_get_seg_link_edit(symbol_table)), 0, range.location, range.length, &err);
+        if (address == UINTPTR_MAX) {
+            _mkl_error(context, "Failed to map the symbols of <mk_symbol_table %p>.  Error %s.", symbol_table.symbol_table, mk_error_string(err));
+            return err;
+        }
+        nlists = (const void*)address;
+    }
+    
+    // The ranges of the sections, in the order they are numbered by the
+    // n_sect field of the symbols.
+    mk_vm_range_t sections[MAX_SECT];
+    uint32_t section_count = mk_macho_get_section_count(image);
+    
+    for (uint32_t i = 0; i < section_count; i++) {
+        mk_macho_section_entry_t section;
+        if (mk_macho_get_section(image, i + 1, &section)) {
+            sections[i] = mk_vm_range_make(0, 0);
+            continue;
+        }
+        sections[i] = mk_vm_range_make(section.addr, section.size);
+        
+        // Slide the section.
+        if (mk_vm_address_apply_offset(sections[i].location, mk_macho_get_slide(image), &sections[i].location))
+            sections[i] = mk_vm_range_make(0, 0);
+    }
+    
+    err = mk_symbol_address_index_init_with_nlists(nlists, symbol_count, is_64_bit, mk_macho_get_byte_order(image), mk_macho_get_slide(image), sections, section_count, storage, storage_size, symbol_address_index);
+    if (err) {
+        _mkl_error(context, "Failed to index the symbols of <mk_symbol_table %p>.  Error %s.", symbol_table.symbol_table, mk_error_string(err));
+        return err;
+    }
+    
+    symbol_address_index->symbol_table = symbol_table;
+    return MK_ESUCCESS;
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+uint32_t mk_symbol_address_index_get_count(mk_symbol_address_index_ref symbol_address_index)
+{ return symbol_address_index.symbol_address_index->count; }
+
+//----------------------------------------------------------------------------//
+#pragma mark -  Looking Up Symbols
+//----------------------------------------------------------------------------//
+
+//|++++++++++++++++++++++++++++++++++++|//
+mk_mach_nlist
+mk_symbol_address_index_find(mk_symbol_address_index_ref symbol_address_index, mk_vm_address_t address, uint32_t *index, mk_vm_range_t *range)
+{
+    mk_symbol_address_index_t *self = symbol_address_index.symbol_address_index;
+    mk_mach_nlist symbol; symbol.any = NULL;
+    
+    uint32_t count = self->count;
+    if (count == 0 || address < self->addresses[0])
+        return symbol;
+    
+    // Branch-free binary search for the last address not greater than
+    // the target.  The loop runs a fixed number of iterations for a given
+    // count, and the conditional compiles to a select.
+    const mk_vm_address_t *base = self->addresses;
+    while (count > 1) {
+        uint32_t half = count / 2;
+        base = (base[half] <= address) ? base + half : base;
+        count -= half;
+    }
+    
+    uint32_t position = (uint32_t)(base - self->addresses);
+    mk_symbol_address_index_entry_t entry = self->entries[position];
+    
+    // A symbol with no inferred size contains only its start address.
+    if (address - *base >= entry.size && address != *base)
+        return symbol;
+    
+    if (index) *index = entry.symbol_index;
+    if (range) *range = mk_vm_range_make(*base, entry.size);
+    symbol.any = (void*)((uintptr_t)self->nlists + (size_t)entry.symbol_index * self->nlist_size);
+    return symbol;
+}
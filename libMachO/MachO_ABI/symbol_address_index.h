@@ -0,0 +1,144 @@
+//----------------------------------------------------------------------------//
+//|
+//|             MachOKit - A Lightweight Mach-O Parsing Library
+//! @file       symbol_address_index.h
+//!
+//! @author     D.V.
+//! @copyright  Copyright (c) 2014-2015 D.V. All rights reserved.
+//|
+//| Permission is hereby granted, free of charge, to any person obtaining a
+//| copy of this software and associated documentation files (the "Software"),
+//| to deal in the Software without restriction, including without limitation
+//| the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//| and/or sell copies of the Software, and to permit persons to whom the
+//| Software is furnished to do so, subject to the following conditions:
+//|
+//| The above copyright notice and this permission notice shall be included
+//| in all copies or substantial portions of the Software.
+//|
+//| THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+//| OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+//| MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+//| IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+//| CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+//| TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//| SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//----------------------------------------------------------------------------//
+
+
+#ifndef _symbol_address_index_h
+#define _symbol_address_index_h
+
+//! @addtogroup MACH
+//! @{
+//!
+
+//----------------------------------------------------------------------------//
+#pragma mark -  Types
+//! @name       Types
+//----------------------------------------------------------------------------//
+
+//◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
+//! @internal
+//
+typedef struct mk_symbol_address_index_entry_s {
+    //! Index of the symbol in the symbol table.
+    uint32_t symbol_index;
+    //! Number of bytes from the start of the symbol to the start of the next
+    //! symbol or the end of its section, whichever comes first.  Clamped to
+    //! \c UINT32_MAX.
+    uint32_t size;
+} mk_symbol_address_index_entry_t;
+
+//◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
+//! @internal
+//
+typedef struct mk_symbol_address_index_s {
+    __MK_RUNTIME_BASE
+    //! The indexed symbol table.  May be \c NULL if the index was initialized
+    //! with \ref mk_symbol_address_index_init_with_nlists.
+    mk_symbol_table_ref symbol_table;
+    //! Host pointer to the first nlist(_64) structure.
+    const void *nlists;
+    //! Size of an nlist(_64) structure.
+    uint32_t nlist_size;
+    //! Number of symbols that were indexed.
+    uint32_t count;
+    //! Start address of each indexed symbol, in ascending order.
+    mk_vm_address_t *addresses;
+    //! The symbol starting at the address at the same position in
+    //! \c addresses.
+    mk_symbol_address_index_entry_t *entries;
+} mk_symbol_address_index_t;
+
+
+//◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
+//! The Symbol Address Index type.
+//
+typedef union {
+    struct mk_symbol_address_index_s *symbol_address_index;
+} mk_symbol_address_index_ref __attribute__((__transparent_union__));
+
+//! The identifier for the Symbol Address Index type.
+_mk_export intptr_t mk_symbol_address_index_type;
+
+
+//----------------------------------------------------------------------------//
+#pragma mark -  Working With The Symbol Address Index
+//! @name       Working With The Symbol Address Index
+//!
+//! A symbol address index holds the start address of every symbol defined
+//! in a section (\c N_SECT), sorted, for looking up the symbol containing an
+//! address.  Debugging (\c N_STAB) entries are not indexed.  Where several
+//! symbols start at the same address, the first external symbol is kept, or
+//! the first symbol if none are external.
+//!
+//! Like the rest of libMachO, the index does not allocate memory.  The
+//! caller provides a single buffer of at least
+//! \ref mk_symbol_address_index_storage_size bytes which must remain valid
+//! for the lifetime of the index.
+//----------------------------------------------------------------------------//
+
+//! Returns the size of the storage that must be provided to initialize a
+//! symbol address index for \a symbol_count symbols.
+_mk_export size_t
+mk_symbol_address_index_storage_size(uint32_t symbol_count);
+
+//! Initializes the provided \ref mk_symbol_address_index_t with the symbols
+//! of \a symbol_table.  Addresses in the index include the slide of the
+//! image.
+_mk_export mk_error_t
+mk_symbol_address_index_init(mk_symbol_table_ref symbol_table, void *storage, size_t storage_size, mk_symbol_address_index_t *symbol_address_index);
+
+//! Initializes the provided \ref mk_symbol_address_index_t with
+//! \a nlist_count nlist, or nlist_64 if \a is_64_bit is \c true, structures
+//! starting at \a nlists, which must remain valid for the lifetime of the
+//! index.  \a slide is added to the value of each symbol.
+//!
+//! The size of a symbol is bounded by the end of its section if
+//! \a sections, the host-relative ranges of the sections of the image in
+//! load command order, is not \c NULL.
+_mk_export mk_error_t
+mk_symbol_address_index_init_with_nlists(const void *nlists, uint32_t nlist_count, bool is_64_bit, const mk_byteorder_t *byte_order, mk_vm_offset_t slide, const mk_vm_range_t *sections, uint32_t section_count, void *storage, size_t storage_size, mk_symbol_address_index_t *symbol_address_index);
+
+//! Returns the number of symbols in \a symbol_address_index.
+_mk_export uint32_t
+mk_symbol_address_index_get_count(mk_symbol_address_index_ref symbol_address_index);
+
+
+//----------------------------------------------------------------------------//
+#pragma mark -  Looking Up Symbols
+//! @name       Looking Up Symbols
+//----------------------------------------------------------------------------//
+
+//! Returns a pointer to the symbol containing \a address, or \c NULL if no
+//! symbol contains \a address.  If \a index is not \c NULL, it is set to the
+//! index of the symbol in the symbol table.  If \a range is not \c NULL, it
+//! is set to the range of addresses covered by the symbol.
+_mk_export mk_mach_nlist
+mk_symbol_address_index_find(mk_symbol_address_index_ref symbol_address_index, mk_vm_address_t address, uint32_t *index, mk_vm_range_t *range);
+
+
+//! @} MACH !//
+
+#endif /* _symbol_address_index_h */
@@ -0,0 +1,389 @@
+//----------------------------------------------------------------------------//
+//|
+//|             MachOKit - A Lightweight Mach-O Parsing Library
+//|             symbol_index.c
+//|
+//|             D.V.
+//|             Copyright (c) 2014-2015 D.V. All rights reserved.
+//|
+//| Permission is hereby granted, free of charge, to any person obtaining a
+//| copy of this software and associated documentation files (the "Software"),
+//| to deal in the Software without restriction, including without limitation
+//| the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//| and/or sell copies of the Software, and to permit persons to whom the
+//| Software is furnished to do so, subject to the following conditions:
+//|
+//| The above copyright notice and this permission notice shall be included
+//| in all copies or substantial portions of the Software.
+//|
+//| THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+//| OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+//| MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+//| IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+//| CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+//| TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//| SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//----------------------------------------------------------------------------//
+
+
+#include "macho_abi_internal.h"
+
+//----------------------------------------------------------------------------//
+#pragma mark -  Classes
+//----------------------------------------------------------------------------//
+
+//|++++++++++++++++++++++++++++++++++++|//
+static mk_context_t*
+__mk_symbol_index_get_context(mk_type_ref self)
+{ return mk_type_get_context( ((mk_symbol_index_t*)self)->symbol_table.symbol_table ); }
+
+const struct _mk_symbol_index_vtable _mk_symbol_index_class = {
+    .base.super                 = &_mk_type_class,
+    .base.name                  = "symbol index",
+    .base.get_context           = &__mk_symbol_index_get_context
+};
+
+intptr_t mk_symbol_index_type = (intptr_t)&_mk_symbol_index_class;
+
+//----------------------------------------------------------------------------//
+#pragma mark -  Names
+//----------------------------------------------------------------------------//
+
+//|++++++++++++++++++++++++++++++++++++|//
+static inline uint32_t
+__mk_symbol_index_get_strx(mk_symbol_index_t *symbol_index, uint32_t index)
+{
+    const uint8_t *nlist = (const uint8_t*)symbol_index->nlists + (size_t)index * symbol_index->nlist_size;
+    // n_strx is the first member of both nlist and nlist_64.
+    uint32_t strx;
+    __builtin_memcpy(&strx, nlist, sizeof(strx));
+    return mk_byteorder_swap32(mk_macho_get_byte_order(mk_symbol_table_get_macho(symbol_index->symbol_table)), strx);
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+//! FNV-1a over the string at \a name, reading no more than \a max_length
+//! bytes.
+static inline uint32_t
+__mk_symbol_index_hash(const char *name, size_t max_length)
+{
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < max_length && name[i] != '\0'; i++) {
+        hash ^= (uint8_t)name[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+//! Compares the name at \a strx in the string table against the first
+//! \a length bytes of \a name, or all of \a name if \a length is
+//! \c SIZE_MAX.  Table strings that are not terminated within the string
+//! table are treated as ending at the end of the table.
+static int
+__mk_symbol_index_compare_name(mk_symbol_index_t *symbol_index, uint32_t strx, const char *name, size_t length)
+{
+    const char *string = symbol_index->strings + strx;
+    size_t max_length = symbol_index->strings_size - strx;
+    
+    for (size_t i = 0; i < length; i++) {
+        uint8_t c1 = (i < max_length) ? (uint8_t)string[i] : 0;
+        uint8_t c2 = (uint8_t)name[i];
+        if (c1 != c2)
+            return (int)c1 - (int)c2;
+        if (c1 == 0)
+            break;
+    }
+    
+    return 0;
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+static int
+__mk_symbol_index_compare_symbols(mk_symbol_index_t *symbol_index, uint32_t lhs, uint32_t rhs)
+{
+    uint32_t lhs_strx = __mk_symbol_index_get_strx(symbol_index, lhs);
+    uint32_t rhs_strx = __mk_symbol_index_get_strx(symbol_index, rhs);
+    
+    const char *lhs_name = symbol_index->strings + lhs_strx;
+    const char *rhs_name = symbol_index->strings + rhs_strx;
+    size_t lhs_length = strnlen(lhs_name, symbol_index->strings_size - lhs_strx);
+    size_t rhs_length = strnlen(rhs_name, symbol_index->strings_size - rhs_strx);
+    
+    int result = memcmp(lhs_name, rhs_name, (lhs_length < rhs_length) ? lhs_length : rhs_length);
+    if (result == 0)
+        result = (lhs_length < rhs_length) ? -1 : (lhs_length > rhs_length);
+    
+    // Keep symbols with the same name in symbol table order.
+    if (result == 0)
+        result = (lhs < rhs) ? -1 : (lhs > rhs);
+    
+    return result;
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+static void
+__mk_symbol_index_sift_down(mk_symbol_index_t *symbol_index, uint32_t root, uint32_t count)
+{
+    uint32_t *sorted = symbol_index->sorted;
+    
+    while (2 * (uint64_t)root + 1 < count) {
+        uint32_t child = 2 * root + 1;
+        if (child + 1 < count && __mk_symbol_index_compare_symbols(symbol_index, sorted[child], sorted[child + 1]) < 0)
+            child++;
+        if (__mk_symbol_index_compare_symbols(symbol_index, sorted[root], sorted[child]) >= 0)
+            return;
+        
+        uint32_t tmp = sorted[root];
+        sorted[root] = sorted[child];
+        sorted[child] = tmp;
+        root = child;
+    }
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+//! Heap sort, which sorts in place and without recursion.
+static void
+__mk_symbol_index_sort(mk_symbol_index_t *symbol_index)
+{
+    uint32_t count = symbol_index->count;
+    if (count < 2)
+        return;
+    
+    for (uint32_t i = count / 2; i-- > 0; )
+        __mk_symbol_index_sift_down(symbol_index, i, count);
+    
+    for (uint32_t end = count - 1; end > 0; end--) {
+        uint32_t tmp = symbol_index->sorted[0];
+        symbol_index->sorted[0] = symbol_index->sorted[end];
+        symbol_index->sorted[end] = tmp;
+        __mk_symbol_index_sift_down(symbol_index, 0, end);
+    }
+}
+
+//----------------------------------------------------------------------------//
+#pragma mark -  Working With The Symbol Index
+//----------------------------------------------------------------------------//
+
+//|++++++++++++++++++++++++++++++++++++|//
+static uint32_t
+__mk_symbol_index_slot_count(uint32_t symbol_count)
+{
+    // Keep the load factor at or below 50%.
+    uint64_t slot_count = 8;
+    while (slot_count < 2 * (uint64_t)symbol_count)
+        slot_count <<= 1;
+    return (slot_count > UINT32_MAX) ? 0 : (uint32_t)slot_count;
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+size_t
+mk_symbol_index_storage_size(mk_symbol_table_ref symbol_table, uint32_t options)
+{
+    uint32_t symbol_count = mk_symbol_table_get_count(symbol_table);
+    uint32_t slot_count = __mk_symbol_index_slot_count(symbol_count);
+    if (slot_count == 0)
+        return SIZE_MAX;
+    
+    size_t size = (size_t)slot_count * sizeof(mk_symbol_index_slot_t);
+    if (options & MK_SYMBOL_INDEX_PREFIX_SEARCH)
+        size += (size_t)symbol_count * sizeof(uint32_t);
+    return size;
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+mk_error_t
+mk_symbol_index_init(mk_symbol_table_ref symbol_table, mk_string_table_ref string_table, uint32_t options, void *storage, size_t storage_size, mk_symbol_index_t *symbol_index)
+{
+    if (symbol_index == NULL) return MK_EINVAL;
+    if (symbol_table.symbol_table == NULL) return MK_EINVAL;
+    if (string_table.string_table == NULL) return MK_EINVAL;
+    if (storage == NULL) return MK_EINVAL;
+    if ((uintptr_t)storage % __alignof__(mk_symbol_index_slot_t)) return MK_EINVAL;
+    
+    if (mk_symbol_table_get_macho(symbol_table).macho != mk_string_table_get_macho(string_table).macho)
+        return MK_EINVAL;
+    
+    mk_context_t *context = mk_type_get_context(symbol_table.symbol_table);
+    
+    if (storage_size < mk_symbol_index_storage_size(symbol_table, options)) {
+        _mkl_error(context, "Storage of size %zu is too small to index <mk_symbol_table %p>.", storage_size, symbol_table.symbol_table);
+        return MK_EINVAL;
+    }
+    
+    mk_vm_range_t symbols_range = mk_symbol_table_get_range(symbol_table);
+    mk_vm_range_t strings_range = mk_string_table_get_range(string_table);
+    uint32_t symbol_count = mk_symbol_table_get_count(symbol_table);
+    mk_error_t err = MK_ESUCCESS;
+    
+    if (strings_range.length > UINT32_MAX)
+        return MK_EINVALID_DATA;
+    
+    symbol_index->symbol_table = symbol_table;
+    symbol_index->string_table = string_table;
+    symbol_index->nlist_size = (uint32_t)(mk_data_model_is_64_bit(mk_macho_get_data_model(mk_symbol_table_get_macho(symbol_table))) ? sizeof(struct nlist_64) : sizeof(struct nlist));
+    symbol_index->nlists = NULL;
+    symbol_index->strings = NULL;
+    symbol_index->strings_size = (uint32_t)strings_range.length;
+    symbol_index->count = 0;
+    symbol_index->slot_count = __mk_symbol_index_slot_count(symbol_count);
+    symbol_index->slots = (mk_symbol_index_slot_t*)storage;
+    symbol_index->sorted = (options & MK_SYMBOL_INDEX_PREFIX_SEARCH) ? (uint32_t*)(symbol_index->slots + symbol_index->slot_count) : NULL;
+    
+    for (uint32_t i = 0; i < symbol_index->slot_count; i++) {
+        symbol_index->slots[i].hash = 0;
+        symbol_index->slots[i].symbol_index = UINT32_MAX;
+    }
+    
+    // Map the symbols and strings once.  Everything after this point reads
+    // directly from the mapped memory.
+    if (symbol_count > 0) {
+        vm_address_t nlists = mk_memory_object_remap_address(mk_segment_get_mobj(mk_symbol_table_get_seg_link_edit(symbol_table)), 0, symbols_range.location, symbols_range.length, &err);
+        if (nlists == UINTPTR_MAX) {
+            _mkl_error(context, "Failed to map the symbols of <mk_symbol_table %p>.  Error %s.", symbol_table.symbol_table, mk_error_string(err));
+            return err;
+        }
+        symbol_index->nlists = (const void*)nlists;
+    }
+    
+    if (strings_range.length > 0) {
+        vm_address_t strings = mk_memory_object_remap_address(mk_segment_get_mobj(mk_string_table_get_seg_link_edit(string_table)), 0, strings_range.location, strings_range.length, &err);
+        if (strings == UINTPTR_MAX) {
+            _mkl_error(context, "Failed to map the strings of <mk_string_table %p>.  Error %s.", string_table.string_table, mk_error_string(err));
+            return err;
+        }
+        symbol_index->strings = (const char*)strings;
+    }
+    
+    uint32_t mask = symbol_index->slot_count - 1;
+    
+    for (uint32_t index = 0; index < symbol_count; index++)
+    {
+        uint32_t strx = __mk_symbol_index_get_strx(symbol_index, index);
+        
+        // Symbols without a name are not indexed.
+        if (strx == 0 || strx >= symbol_index->strings_size || symbol_index->strings[strx] == '\0')
+            continue;
+        
+        uint32_t hash = __mk_symbol_index_hash(symbol_index->strings + strx, symbol_index->strings_size - strx);
+        uint32_t slot = hash & mask;
+        
+        // Linear probing.  There is always an empty slot because the table
+        // is at most half full.
+        while (symbol_index->slots[slot].symbol_index != UINT32_MAX)
+            slot = (slot + 1) & mask;
+        
+        symbol_index->slots[slot].hash = hash;
+        symbol_index->slots[slot].symbol_index = index;
+        
+        if (symbol_index->sorted)
+            symbol_index->sorted[symbol_index->count] = index;
+        symbol_index->count++;
+    }
+    
+    if (symbol_index->sorted)
+        __mk_symbol_index_sort(symbol_index);
+    
+    symbol_index->vtable = &_mk_symbol_index_class;
+    return MK_ESUCCESS;
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+mk_symbol_table_ref mk_symbol_index_get_symbol_table(mk_symbol_index_ref symbol_index)
+{ return symbol_index.symbol_index->symbol_table; }
+
+//|++++++++++++++++++++++++++++++++++++|//
+mk_string_table_ref mk_symbol_index_get_string_table(mk_symbol_index_ref symbol_index)
+{ return symbol_index.symbol_index->string_table; }
+
+//|++++++++++++++++++++++++++++++++++++|//
+uint32_t mk_symbol_index_get_count(mk_symbol_index_ref symbol_index)
+{ return symbol_index.symbol_index->count; }
+
+//----------------------------------------------------------------------------//
+#pragma mark -  Looking Up Symbols
+//----------------------------------------------------------------------------//
+
+//|++++++++++++++++++++++++++++++++++++|//
+mk_mach_nlist
+mk_symbol_index_find(mk_symbol_index_ref symbol_index, const char *name, uint32_t *index)
+{
+    mk_symbol_index_t *self = symbol_index.symbol_index;
+    mk_mach_nlist symbol; symbol.any = NULL;
+    
+    if (name == NULL || self->count == 0)
+        return symbol;
+    
+    uint32_t hash = __mk_symbol_index_hash(name, SIZE_MAX);
+    uint32_t mask = self->slot_count - 1;
+    uint32_t slot = hash & mask;
+    
+    // Symbols were inserted in symbol table order so the first match along
+    // the probe sequence is the first symbol with this name.
+    while (self->slots[slot].symbol_index != UINT32_MAX)
+    {
+        if (self->slots[slot].hash == hash) {
+            uint32_t candidate = self->slots[slot].symbol_index;
+            if (__mk_symbol_index_compare_name(self, __mk_symbol_index_get_strx(self, candidate), name, SIZE_MAX) == 0) {
+                if (index) *index = candidate;
+                symbol.any = (void*)((uintptr_t)self->nlists + (size_t)candidate * self->nlist_size);
+                return symbol;
+            }
+        }
+        
+        slot = (slot + 1) & mask;
+    }
+    
+    return symbol;
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+mk_error_t
+mk_symbol_index_find_prefix(mk_symbol_index_ref symbol_index, const char *prefix, uint32_t *first, uint32_t *count)
+{
+    mk_symbol_index_t *self = symbol_index.symbol_index;
+    
+    if (prefix == NULL || first == NULL || count == NULL) return MK_EINVAL;
+    if (self->sorted == NULL) return MK_EUNAVAILABLE;
+    
+    size_t prefix_length = strlen(prefix);
+    uint32_t lower = 0, upper = self->count;
+    
+    // First symbol whose name is not less than the prefix.
+    while (lower < upper) {
+        uint32_t middle = lower + (upper - lower) / 2;
+        if (__mk_symbol_index_compare_name(self, __mk_symbol_index_get_strx(self, self->sorted[middle]), prefix, prefix_length) < 0)
+            lower = middle + 1;
+        else
+            upper = middle;
+    }
+    *first = lower;
+    
+    // First symbol whose name is greater than the prefix.
+    upper = self->count;
+    while (lower < upper) {
+        uint32_t middle = lower + (upper - lower) / 2;
+        if (__mk_symbol_index_compare_name(self, __mk_symbol_index_get_strx(self, self->sorted[middle]), prefix, prefix_length) <= 0)
+            lower = middle + 1;
+        else
+            upper = middle;
+    }
+    *count = lower - *first;
+    
+    return MK_ESUCCESS;
+}
+
+//|++++++++++++++++++++++++++++++++++++|//
+mk_mach_nlist
+mk_symbol_index_get_sorted_symbol(mk_symbol_index_ref symbol_index, uint32_t position, uint32_t *index)
+{
+    mk_symbol_index_t *self = symbol_index.symbol_index;
+    mk_mach_nlist symbol; symbol.any = NULL;
+    
+    if (self->sorted == NULL || position >= self->count)
+        return symbol;
+    
+    uint32_t candidate = self->sorted[position];
+    if (index) *index = candidate;
+    symbol.any = (void*)((uintptr_t)self->nlists + (size_t)candidate * self->nlist_size);
+    return symbol;
+}
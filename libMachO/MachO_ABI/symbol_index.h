@@ -0,0 +1,166 @@
+//----------------------------------------------------------------------------//
+//|
+//|             MachOKit - A Lightweight Mach-O Parsing Library
+//! @file       symbol_index.h
+//!
+//! @author     D.V.
+//! @copyright  Copyright (c) 2014-2015 D.V. All rights reserved.
+//|
+//| Permission is hereby granted, free of charge, to any person obtaining a
+//| copy of this software and associated documentation files (the "Software"),
+//| to deal in the Software without restriction, including without limitation
+//| the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//| and/or sell copies of the Software, and to permit persons to whom the
+//| Software is furnished to do so, subject to the following conditions:
+//|
+//| The above copyright notice and this permission notice shall be included
+//| in all copies or substantial portions of the Software.
+//|
+//| THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+//| OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+//| MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+//| IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+//| CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+//| TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//| SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//----------------------------------------------------------------------------//
+
+
+#ifndef _symbol_index_h
+#define _symbol_index_h
+
+//! @addtogroup MACH
+//! @{
+//!
+
+//----------------------------------------------------------------------------//
+#pragma mark -  Types
+//! @name       Types
+//----------------------------------------------------------------------------//
+
+//! Options for \ref mk_symbol_index_init.
+enum {
+    //! Additionally sort the indexed symbols by name, enabling
+    //! \ref mk_symbol_index_find_prefix.
+    MK_SYMBOL_INDEX_PREFIX_SEARCH         = 1 << 0
+};
+
+//◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
+//! @internal
+//
+typedef struct mk_symbol_index_slot_s {
+    //! Hash of the symbol name.
+    uint32_t hash;
+    //! Index of the symbol in the symbol table, or \c UINT32_MAX if the slot
+    //! is empty.
+    uint32_t symbol_index;
+} mk_symbol_index_slot_t;
+
+//◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
+//! @internal
+//
+typedef struct mk_symbol_index_s {
+    __MK_RUNTIME_BASE
+    //! The indexed symbol table.
+    mk_symbol_table_ref symbol_table;
+    //! The string table holding the names of the symbols in \c symbol_table.
+    mk_string_table_ref string_table;
+    //! Host pointer to the first nlist(_64) structure.
+    const void *nlists;
+    //! Size of an nlist(_64) structure.
+    uint32_t nlist_size;
+    //! Host pointer to the first byte of the string table.
+    const char *strings;
+    //! Size of the string table.
+    uint32_t strings_size;
+    //! Number of symbols that were indexed.
+    uint32_t count;
+    //! Number of slots in \c slots.  Always a power of two.
+    uint32_t slot_count;
+    //! Open addressing hash table of symbol names.
+    mk_symbol_index_slot_t *slots;
+    //! Indexes of the indexed symbols, sorted by name.  \c NULL unless the
+    //! index was initialized with \ref MK_SYMBOL_INDEX_PREFIX_SEARCH.
+    uint32_t *sorted;
+} mk_symbol_index_t;
+
+
+//◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦◦//
+//! The Symbol Index type.
+//
+typedef union {
+    struct mk_symbol_index_s *symbol_index;
+} mk_symbol_index_ref __attribute__((__transparent_union__));
+
+//! The identifier for the Symbol Index type.
+_mk_export intptr_t mk_symbol_index_type;
+
+
+//----------------------------------------------------------------------------//
+#pragma mark -  Working With The Symbol Index
+//! @name       Working With The Symbol Index
+//!
+//! A symbol index is built with a single pass over the symbols and strings
+//! of a symbol table.  Like the rest of libMachO, it does not allocate
+//! memory.  The caller provides a single buffer of at least
+//! \ref mk_symbol_index_storage_size bytes which must remain valid for the
+//! lifetime of the index.
+//----------------------------------------------------------------------------//
+
+//! Returns the size of the storage that must be provided to
+//! \ref mk_symbol_index_init in order to index \a symbol_table.
+_mk_export size_t
+mk_symbol_index_storage_size(mk_symbol_table_ref symbol_table, uint32_t options);
+
+//! Initializes the provided \ref mk_symbol_index_t with the symbols of
+//! \a symbol_table, whose names are in \a string_table.
+_mk_export mk_error_t
+mk_symbol_index_init(mk_symbol_table_ref symbol_table, mk_string_table_ref string_table, uint32_t options, void *storage, size_t storage_size, mk_symbol_index_t *symbol_index);
+
+//! Returns the symbol table that was used to initialize \a symbol_index.
+_mk_export mk_symbol_table_ref
+mk_symbol_index_get_symbol_table(mk_symbol_index_ref symbol_index);
+
+//! Returns the string table that was used to initialize \a symbol_index.
+_mk_export mk_string_table_ref
+mk_symbol_index_get_string_table(mk_symbol_index_ref symbol_index);
+
+//! Returns the number of symbols in \a symbol_index.  Symbols without a name
+//! are not indexed.
+_mk_export uint32_t
+mk_symbol_index_get_count(mk_symbol_index_ref symbol_index);
+
+
+//----------------------------------------------------------------------------//
+#pragma mark -  Looking Up Symbols
+//! @name       Looking Up Symbols
+//----------------------------------------------------------------------------//
+
+//! Returns a pointer to the first symbol in the symbol table named \a name,
+//! or \c NULL if there is no such symbol.  If \a index is not \c NULL, it is
+//! set to the index of the symbol in the symbol table.  The returned pointer
+//! should be considered valid for the lifetime of the symbol table.
+_mk_export mk_mach_nlist
+mk_symbol_index_find(mk_symbol_index_ref symbol_index, const char *name, uint32_t *index);
+
+//! Finds the symbols with names beginning with \a prefix.  On success,
+//! \a first is set to the position of the first matching symbol in the
+//! name-sorted order of \a symbol_index and \a count to the number of
+//! matching symbols.  Use \ref mk_symbol_index_get_sorted_symbol to retrieve
+//! the symbols.
+//!
+//! Returns \ref MK_EUNAVAILABLE if \a symbol_index was not initialized with
+//! \ref MK_SYMBOL_INDEX_PREFIX_SEARCH.
+_mk_export mk_error_t
+mk_symbol_index_find_prefix(mk_symbol_index_ref symbol_index, const char *prefix, uint32_t *first, uint32_t *count);
+
+//! Returns a pointer to the symbol at \a position in the name-sorted order of
+//! \a symbol_index.  If \a index is not \c NULL, it is set to the index of
+//! the symbol in the symbol table.
+_mk_export mk_mach_nlist
+mk_symbol_index_get_sorted_symbol(mk_symbol_index_ref symbol_index, uint32_t position, uint32_t *index);
+
+
+//! @} MACH !//
+
+#endif /* _symbol_index_h */
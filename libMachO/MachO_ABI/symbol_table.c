@@ -34,7 +34,7 @@
 //|++++++++++++++++++++++++++++++++++++|//
 static mk_context_t*
 __mk_symbol_table_get_context(mk_type_ref self)
-{ return mk_type_get_context( &((mk_symbol_table_t*)self)->link_edit ); }
+{ return mk_type_get_context( ((mk_symbol_table_t*)self)->link_edit.segment ); }
 
 const struct _mk_symbol_table_vtable _mk_symbol_table_class = {
     .base.super                 = &_mk_type_class,
@@ -78,7 +78,7 @@ mk_symbol_table_init(mk_segment_ref link_edit, mk_load_command_ref symtab_cmd, m
     
     // This already include the slide.
     if ((err = mk_vm_address_add(vm_address, symoff, &vm_address))) {
-        _mkl_error(mk_type_get_context(link_edit.segment), "Arithmetic error %s while adding offset (%" PRIi32 ") to __LINKEDIT vm_address (0x%" MK_VM_PRIxADDR ")", mk_error_string(err), symoff, vm_address);
+        _mkl_error_record(mk_type_get_context(link_edit.segment), MK_LOG_RECORD_OFFSET_OVERFLOW, err, vm_address, symoff, link_edit.segment);
         return err;
     }
     
@@ -95,7 +95,7 @@ mk_symbol_table_init(mk_segment_ref link_edit, mk_load_command_ref symtab_cmd, m
     
     // Make sure we are fully within the link_edit segment
     if ((err = mk_vm_range_contains_range(mk_segment_get_range(link_edit), symbol_table->range, false))) {
-        _mkl_error(mk_type_get_context(link_edit.segment), "__LINKEDIT segment does not fully contain the symbol table.");
+        _mkl_error_record(mk_type_get_context(link_edit.segment), MK_LOG_RECORD_RANGE_NOT_WITHIN, err, symbol_table->range.location, symbol_table->range.length, link_edit.segment);
         return err;
     }
     
@@ -213,13 +213,13 @@ mk_symbol_table_next_mach_symbol(mk_symbol_table_ref symbol_table, const mk_mach
     
     sym_addr = mk_memory_object_unmap_address(mk_segment_get_mobj(symbol_table.symbol_table->link_edit), 0, (vm_address_t)previous.any, 1, NULL);
     if (sym_addr == MK_VM_ADDRESS_INVALID) {
-        _mkl_error(mk_type_get_context(symbol_table.symbol_table), "Previous value %p is not within <mk_symbol_table %p>", previous.any, symbol_table.symbol_table);
+        _mkl_error_record(mk_type_get_context(symbol_table.symbol_table), MK_LOG_RECORD_RANGE_NOT_WITHIN, MK_EOUT_OF_RANGE, (uintptr_t)previous.any, 1, symbol_table.symbol_table);
         return symbol;
     }
     
     // Verify that previous is within the symbol table.
     if (mk_vm_range_contains_address(symbol_table.symbol_table->range, 0, sym_addr)) {
-        _mkl_error(mk_type_get_context(symbol_table.symbol_table), "Previous value %p is not within <mk_symbol_table %p>", previous.any, symbol_table.symbol_table);
+        _mkl_error_record(mk_type_get_context(symbol_table.symbol_table), MK_LOG_RECORD_RANGE_NOT_WITHIN, MK_EOUT_OF_RANGE, (uintptr_t)previous.any, 1, symbol_table.symbol_table);
         return symbol;
     }
     